@@ -1,8 +1,34 @@
+// also builds outside of visual studio, e.g. g++ -std=c++20 -pthread Catch_text_parsing_tests.cpp
 #define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 
 #include "catch.hpp"
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#endif
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
 #include <string>
-#include "..\display_testbed\printui_utility.hpp"
+#include "../display_testbed/printui_animation.cpp"
+#include "../display_testbed/printui_arrangement_cache.cpp"
+#include "../display_testbed/printui_background_queue.cpp"
+#include "../display_testbed/printui_device_resources.cpp"
+#include "../display_testbed/printui_editable_text.cpp"
+#include "../display_testbed/printui_image_compare.cpp"
+#include "../display_testbed/printui_profiling.cpp"
+#include "../display_testbed/printui_text_bundle.cpp"
+#include "../display_testbed/printui_text_cache.cpp"
+#include "../display_testbed/printui_text_data.cpp"
+#include "../display_testbed/printui_text_numbers.cpp"
+#include "../display_testbed/printui_text_plurals.cpp"
+#include "../display_testbed/printui_text_segmentation.cpp"
+#include "plural_samples.hpp"
+#include "tile_compositor.cpp"
 
 
 TEST_CASE("match conditions", "[parsing_tests]") {
@@ -26,7 +52,7 @@ TEST_CASE("attributes", "[parsing_tests]") {
 
 	REQUIRE(res[0] == printui::text::other);
 	REQUIRE(res[1] == printui::text::last_predefined + 1);
-	REQUIRE(res[2] == -1ui16);
+	REQUIRE(res[2] == printui::text::attribute_type(-1));
 	REQUIRE(tm.attribute_name_to_id.size() == 1);
 	REQUIRE(tm.last_attribute_id_mapped == printui::text::last_predefined + 1);
 	REQUIRE(tm.attribute_name_to_id["masc"] == printui::text::last_predefined + 1);
@@ -40,9 +66,11 @@ TEST_CASE("simple entry", "[parsing_tests]") {
 
 	REQUIRE(res[0] == 's');
 	REQUIRE(tm.internal_text_name_map[std::string("first_entry")] == 0);
+	REQUIRE(tm.internal_text_name_map.find(std::string_view("first_entry")) != tm.internal_text_name_map.end());
+	REQUIRE(tm.internal_text_name_map.find(std::string_view("first")) == tm.internal_text_name_map.end());
 	REQUIRE(tm.stored_functions[0].pattern_count == 1);
 	REQUIRE(tm.stored_functions[0].begin_patterns == 0);
-	REQUIRE(tm.stored_functions[0].attributes[0] == -1i16);
+	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::attribute_type(-1));
 	REQUIRE(tm.static_matcher_storage.size() == 1);
 	REQUIRE(tm.static_matcher_storage[0].num_keys == 0);
 	REQUIRE(tm.static_matcher_storage[0].base_text.formatting_start == 0);
@@ -72,7 +100,7 @@ TEST_CASE("entry with attributes", "[parsing_tests]") {
 
 	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::other);
 	REQUIRE(tm.stored_functions[0].attributes[1] == printui::text::last_predefined + 1);
-	REQUIRE(tm.stored_functions[0].attributes[2] == -1ui16);
+	REQUIRE(tm.stored_functions[0].attributes[2] == printui::text::attribute_type(-1));
 	REQUIRE(tm.attribute_name_to_id.size() == 1);
 	REQUIRE(tm.last_attribute_id_mapped == printui::text::last_predefined + 1);
 	REQUIRE(tm.attribute_name_to_id["masc"] == printui::text::last_predefined + 1);
@@ -98,7 +126,7 @@ TEST_CASE("entry with spaces", "[parsing_tests]") {
 
 	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::other);
 	REQUIRE(tm.stored_functions[0].attributes[1] == printui::text::last_predefined + 1);
-	REQUIRE(tm.stored_functions[0].attributes[2] == -1ui16);
+	REQUIRE(tm.stored_functions[0].attributes[2] == printui::text::attribute_type(-1));
 	REQUIRE(tm.attribute_name_to_id.size() == 1);
 	REQUIRE(tm.last_attribute_id_mapped == printui::text::last_predefined + 1);
 	REQUIRE(tm.attribute_name_to_id["masc"] == printui::text::last_predefined + 1);
@@ -114,7 +142,7 @@ TEST_CASE("entry with italics", "[parsing_tests]") {
 	REQUIRE(tm.internal_text_name_map[std::string("first_entry")] == 0);
 	REQUIRE(tm.stored_functions[0].pattern_count == 1);
 	REQUIRE(tm.stored_functions[0].begin_patterns == 0);
-	REQUIRE(tm.stored_functions[0].attributes[0] == -1i16);
+	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::attribute_type(-1));
 	REQUIRE(tm.static_matcher_storage.size() == 1);
 	REQUIRE(tm.static_matcher_storage[0].num_keys == 0);
 	REQUIRE(tm.static_matcher_storage[0].base_text.formatting_start == 0);
@@ -141,7 +169,7 @@ TEST_CASE("entry with replacement", "[parsing_tests]") {
 	REQUIRE(tm.internal_text_name_map[std::string("first_entry")] == 0);
 	REQUIRE(tm.stored_functions[0].pattern_count == 1);
 	REQUIRE(tm.stored_functions[0].begin_patterns == 0);
-	REQUIRE(tm.stored_functions[0].attributes[0] == -1i16);
+	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::attribute_type(-1));
 	REQUIRE(tm.static_matcher_storage.size() == 1);
 	REQUIRE(tm.static_matcher_storage[0].num_keys == 0);
 	REQUIRE(tm.static_matcher_storage[0].base_text.formatting_start == 0);
@@ -165,7 +193,7 @@ TEST_CASE("entry two matches", "[parsing_tests]") {
 	REQUIRE(tm.internal_text_name_map[std::string("first_entry")] == 0);
 	REQUIRE(tm.stored_functions[0].pattern_count == 4);
 	REQUIRE(tm.stored_functions[0].begin_patterns == 0);
-	REQUIRE(tm.stored_functions[0].attributes[0] == -1i16);
+	REQUIRE(tm.stored_functions[0].attributes[0] == printui::text::attribute_type(-1));
 	REQUIRE(tm.static_matcher_storage.size() == 4);
 	REQUIRE(tm.static_matcher_storage[0].num_keys == 0);
 	REQUIRE(tm.static_matcher_storage[0].base_text.formatting_start == 0);
@@ -199,3 +227,1616 @@ TEST_CASE("entry two matches", "[parsing_tests]") {
 
 	REQUIRE(tm.codepoint_storage.substr(0, 16) == L"cont AAABBBB ent");
 }
+
+TEST_CASE("instantiate with match", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	printui::text::text_data_storage tm;
+
+	tm.consume_text_file("count { \\1 \\match{1.one}{ file }{}{ files } }", font_name_to_index);
+
+	printui::text::replaceable_instance param;
+	param.text_content.text = L"3";
+	param.attributes[0] = printui::text::other;
+
+	auto result = tm.stored_functions[0].instantiate(tm, &param, &param + 1);
+	result.text_content.make_substitutions(&param, &param + 1);
+
+	REQUIRE(result.text_content.text == L"3 files");
+	REQUIRE(result.text_content.formatting.size() == 2);
+	REQUIRE(result.text_content.formatting[0].position == 0);
+	REQUIRE(result.text_content.formatting[1].position == 1);
+	REQUIRE(std::holds_alternative<printui::text::substitution_mark>(result.text_content.formatting[0].format));
+}
+
+TEST_CASE("instantiate into matches instantiate", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	printui::text::text_data_storage tm;
+
+	tm.consume_text_file("a { \\it{\\1} of \\b{ \\2 } \\match{1.one}{ one }{}{ many } \\2_\\1 } b { \\3 plain }", font_name_to_index);
+
+	std::array<printui::text::replaceable_instance, 2> params;
+	params[0].text_content.text = L"12";
+	params[0].attributes[0] = printui::text::other;
+	params[1].text_content.text = L"folders";
+	params[1].text_content.formatting.push_back(printui::text::format_marker{ 0, printui::text::extra_formatting::small_caps });
+	params[1].text_content.formatting.push_back(printui::text::format_marker{ 3, printui::text::extra_formatting::small_caps });
+
+	printui::text::text_with_formatting fast;
+	for(auto const& [name, id] : tm.internal_text_name_map) {
+		auto expected = tm.stored_functions[id].instantiate(tm, params.data(), params.data() + params.size());
+		expected.text_content.make_substitutions(params.data(), params.data() + params.size());
+
+		fast.clear();
+		tm.stored_functions[id].instantiate_into(tm, params.data(), params.data() + params.size(), fast);
+
+		REQUIRE(fast.text == expected.text_content.text);
+		REQUIRE(fast.formatting.size() == expected.text_content.formatting.size());
+		for(size_t i = 0; i < fast.formatting.size(); ++i) {
+			REQUIRE(fast.formatting[i].position == expected.text_content.formatting[i].position);
+			REQUIRE(fast.formatting[i].format.index() == expected.text_content.formatting[i].format.index());
+		}
+	}
+}
+
+// arabic style cardinal plurals on the first parameter, crossed with slavic style gender agreement on the second
+std::string plural_heavy_text_file(uint32_t entries) {
+	std::string result;
+	for(uint32_t i = 0; i < entries; ++i) {
+		result += "plural_" + std::to_string(i) + " { \\match{1.zero}{ no \\2 }{1.one 2.fem}{ one \\2 (f) }{1.one 2.neut}{ one \\2 (n) }{1.one}{ one \\2 }"
+			"{1.two}{ two \\2 }{1.few 2.fem}{ \\1 \\2 (few f) }{1.few}{ \\1 \\2 (few) }{1.many 2.fem}{ \\1 \\2 (many f) }{1.many}{ \\1 \\2 (many) }{}{ \\1 \\2 } }\n";
+	}
+	return result;
+}
+
+TEST_CASE("compiled matchers", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	printui::text::text_data_storage tm;
+	tm.consume_text_file(plural_heavy_text_file(2), font_name_to_index);
+
+	REQUIRE(tm.compiled_matchers.size() == tm.static_matcher_storage.size());
+
+	auto scanning = tm;
+	scanning.compiled_matchers.clear();
+
+	std::array<printui::text::replaceable_instance, 2> params;
+	params[0].text_content.text = L"5";
+	params[1].text_content.text = L"book";
+	auto const fem = tm.attribute_name_to_id["fem"];
+	auto const neut = tm.attribute_name_to_id["neut"];
+
+	for(auto plural : { printui::text::zero, printui::text::one, printui::text::two, printui::text::few, printui::text::many, printui::text::other }) {
+		for(auto gender : { fem, neut, printui::text::attribute_type(-1) }) {
+			params[0].attributes[0] = plural;
+			params[1].attributes[3] = gender;
+
+			auto expected = scanning.stored_functions[1].instantiate(scanning, params.data(), params.data() + params.size());
+			auto actual = tm.stored_functions[1].instantiate(tm, params.data(), params.data() + params.size());
+			REQUIRE(actual.text_content.text == expected.text_content.text);
+		}
+	}
+
+	params[0].attributes[0] = printui::text::one;
+	params[1].attributes[3] = fem;
+	REQUIRE(tm.stored_functions[0].instantiate(tm, params.data(), params.data() + params.size()).text_content.text == L"one ? (f)");
+	// a pattern keyed on a missing parameter does not match
+	REQUIRE(tm.stored_functions[0].instantiate(tm, params.data(), params.data() + 1).text_content.text == L"one ?");
+}
+
+TEST_CASE("utf8 conversion", "[parsing_tests]") {
+	std::wstring out;
+	printui::text::append_utf8_as_utf16(out, "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xFFz");
+
+	REQUIRE(out.length() == 7);
+	REQUIRE(out[0] == L'a');
+	REQUIRE(out[1] == wchar_t(0x00E9));
+	REQUIRE(out[2] == wchar_t(0x20AC));
+	REQUIRE(out[3] == wchar_t(0xD83D));
+	REQUIRE(out[4] == wchar_t(0xDE00));
+	REQUIRE(out[5] == wchar_t(0xFFFD));
+	REQUIRE(out[6] == L'z');
+}
+
+TEST_CASE("edited paragraphs", "[parsing_tests]") {
+	auto check = [](std::wstring_view old_text, std::wstring_view new_text, uint32_t start, uint32_t old_end, uint32_t new_end) {
+		auto r = printui::text::find_edited_paragraphs(old_text, new_text);
+		REQUIRE(r.start == start);
+		REQUIRE(r.old_end == old_end);
+		REQUIRE(r.new_end == new_end);
+		// outside of the ranges the texts are the same
+		REQUIRE(old_text.substr(0, start) == new_text.substr(0, start));
+		REQUIRE(old_text.substr(old_end) == new_text.substr(new_end));
+	};
+
+	check(L"ab\ncd", L"ab\ncd", 5, 5, 5);
+	check(L"one\ntwo\nthree", L"one\ntwXo\nthree", 4, 8, 9);
+	check(L"one\ntwo\nthree", L"one\ntwo\nthreeX", 8, 13, 14);
+	check(L"xy", L"x\ny", 0, 2, 3);
+	check(L"x\ny", L"xy", 0, 3, 2);
+	check(L"a\r\nb\r\nc", L"a\r\nB\r\nc", 3, 6, 6);
+	check(L"abc", L"", 0, 3, 0);
+	check(L"", L"abc", 0, 0, 3);
+	check(L"p\u2029q\u2029r", L"p\u2029Q\u2029r", 2, 4, 4);
+}
+
+TEST_CASE("editable text buffer", "[parsing_tests]") {
+	std::mt19937 rng(7);
+	printui::text::editable_text_buffer buffer;
+	std::wstring expected;
+	std::wstring before_edits;
+
+	for(int i = 0; i < 2000; ++i) {
+		auto const length = uint32_t(expected.length());
+		auto start = uint32_t(rng() % (length + 1));
+		auto end = std::min(length, start + uint32_t(rng() % 4 == 0 ? rng() % 20 : 0));
+		std::wstring content(rng() % 3 == 0 ? 0 : rng() % (i % 100 == 0 ? 300 : 4), L'a' + wchar_t(i % 26));
+
+		buffer.replace(start, end, content);
+		expected.replace(start, end - start, content);
+
+		REQUIRE(buffer.length() == expected.length());
+		if(expected.length() > 0) {
+			auto p = uint32_t(rng() % expected.length());
+			REQUIRE(buffer[p] == expected[p]);
+			REQUIRE(buffer.substr(p, 10) == expected.substr(p, 10));
+		}
+		if(i % 7 == 0)
+			REQUIRE(buffer.view() == expected);
+
+		// the collected change turns the text as it was into the text as it is, and back again
+		if(i % 13 == 0) {
+			REQUIRE(buffer.to_string() == expected);
+			auto edit = buffer.take_edit();
+			std::wstring redone = before_edits;
+			redone.replace(edit.position, edit.removed.length(), edit.inserted);
+			REQUIRE(redone == expected);
+			std::wstring undone = expected;
+			undone.replace(edit.position, edit.inserted.length(), edit.removed);
+			REQUIRE(undone == before_edits);
+			before_edits = expected;
+			REQUIRE(!buffer.has_edit());
+		}
+	}
+
+	// typing a character and deleting it again is no change at all
+	buffer.take_edit();
+	buffer.replace(3, 3, L"x");
+	REQUIRE(buffer.has_edit());
+	buffer.replace(3, 4, L"");
+	REQUIRE(!buffer.has_edit());
+	buffer.replace(0, 1000000, L"new");
+	REQUIRE(buffer.view() == L"new");
+}
+
+// the files in conformance/ are written by display_testbed/unicode_table_generator.cpp in the formats of
+// GraphemeBreakTest.txt, WordBreakTest.txt and BidiCharacterTest.txt, and the files of the unicode character database
+// can be put in their place. What segment_text deliberately does differently is not checked:
+//  - there are no word stops before white space, as in uniscribe, so those boundaries of UAX #29 are skipped
+//  - numeric_word_stop adds word stops around numbers that UAX #29 does not have, so those are skipped too
+//  - soft breaks are only placed after white space rather than by UAX #14, so there is no line break conformance test
+//  - the paragraph level is always given, so the cases with an automatic paragraph direction (P2, P3) are skipped
+std::vector<std::string> read_conformance_lines(char const* name) {
+	std::string file_name = __FILE__;
+	auto slash = file_name.find_last_of("\\/");
+	file_name = (slash != std::string::npos ? file_name.substr(0, slash + 1) : std::string()) + "conformance/" + name;
+
+	std::vector<std::string> lines;
+	std::ifstream in(file_name, std::ios::binary);
+	std::string line;
+	while(std::getline(in, line)) {
+		auto comment = line.find('#');
+		if(comment != std::string::npos)
+			line.erase(comment);
+		while(!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+			line.pop_back();
+		if(!line.empty())
+			lines.push_back(std::move(line));
+	}
+	return lines;
+}
+
+// a line of hexadecimal codepoints as utf16, with the position of the first code unit of each codepoint
+struct conformance_text {
+	std::wstring text;
+	std::vector<size_t> starts;
+
+	void append(std::string_view hex) {
+		auto c = uint32_t(std::stoul(std::string(hex), nullptr, 16));
+		starts.push_back(text.length());
+		if(c < 0x10000) {
+			text += wchar_t(c);
+		} else {
+			auto p = printui::text::make_surrogate_pair(c);
+			text += wchar_t(p.high);
+			text += wchar_t(p.low);
+		}
+	}
+	// the index of the codepoint that the code unit is part of
+	size_t codepoint_of(size_t unit) const {
+		return size_t(std::upper_bound(starts.begin(), starts.end(), unit) - starts.begin()) - 1;
+	}
+};
+
+std::vector<std::string_view> split_conformance_line(std::string_view line, char separator) {
+	std::vector<std::string_view> result;
+	size_t start = 0;
+	while(start <= line.length()) {
+		auto end = line.find(separator, start);
+		if(end == std::string_view::npos)
+			end = line.length();
+		if(end != start || separator != ' ')
+			result.push_back(line.substr(start, end - start));
+		start = end + 1;
+	}
+	return result;
+}
+
+struct break_case {
+	std::string line;
+	conformance_text text;
+	std::vector<bool> boundaries; // whether there is a boundary before each codepoint, and at the end
+};
+
+std::vector<break_case> read_break_test(char const* name) {
+	std::vector<break_case> cases;
+	for(auto& line : read_conformance_lines(name)) {
+		break_case c;
+		for(auto token : split_conformance_line(line, ' ')) {
+			if(token == "\xC3\xB7" || token == "\xC3\x97") // division sign, multiplication sign
+				c.boundaries.push_back(token == "\xC3\xB7");
+			else
+				c.text.append(token);
+		}
+		REQUIRE(c.boundaries.size() == c.text.starts.size() + 1);
+		c.line = std::move(line);
+		cases.push_back(std::move(c));
+	}
+	return cases;
+}
+
+TEST_CASE("grapheme break conformance", "[parsing_tests]") {
+	auto cases = read_break_test("grapheme_break_test.txt");
+	REQUIRE(!cases.empty());
+
+	for(auto& c : cases) {
+		auto const& text = c.text;
+		std::vector<printui::text::logical_attributes> attributes(text.text.length());
+		printui::text::segment_text(attributes.data(), text.text, true, false);
+
+		INFO(c.line);
+		for(size_t i = 0; i < text.text.length(); ++i) {
+			auto const cp = text.codepoint_of(i);
+			bool const expected = text.starts[cp] == i && c.boundaries[cp];
+			REQUIRE(((attributes[i].flags & printui::text::logical_attributes::char_stop) != 0) == expected);
+		}
+	}
+}
+
+TEST_CASE("word break conformance", "[parsing_tests]") {
+	auto cases = read_break_test("word_break_test.txt");
+	REQUIRE(!cases.empty());
+
+	for(auto& c : cases) {
+		auto const& text = c.text;
+		std::vector<printui::text::logical_attributes> attributes(text.text.length());
+		printui::text::segment_text(attributes.data(), text.text, true, false);
+
+		INFO(c.line);
+		for(size_t i = 0; i < text.starts.size(); ++i) {
+			auto const flags = attributes[text.starts[i]].flags;
+			if((flags & (printui::text::logical_attributes::white_space | printui::text::logical_attributes::numeric_word_stop)) != 0)
+				continue;
+			REQUIRE(((flags & printui::text::logical_attributes::word_stop) != 0) == c.boundaries[i]);
+		}
+	}
+}
+
+TEST_CASE("bidi character conformance", "[parsing_tests]") {
+	auto lines = read_conformance_lines("bidi_character_test.txt");
+	REQUIRE(!lines.empty());
+
+	for(auto& line : lines) {
+		auto fields = split_conformance_line(line, ';');
+		REQUIRE(fields.size() == 5);
+		if(fields[1] == "2")
+			continue;
+
+		conformance_text c;
+		for(auto token : split_conformance_line(fields[0], ' '))
+			c.append(token);
+		auto levels = split_conformance_line(fields[3], ' ');
+		REQUIRE(levels.size() == c.starts.size());
+
+		std::vector<printui::text::logical_attributes> attributes(c.text.length());
+		printui::text::segment_text(attributes.data(), c.text, fields[1] == "0", false);
+
+		INFO(line);
+		for(size_t i = 0; i < c.text.length(); ++i) {
+			auto const level = levels[c.codepoint_of(i)];
+			if(level != "x") {
+				REQUIRE(unsigned(attributes[i].bidi_level) == std::stoul(std::string(level)));
+			}
+		}
+
+		// the visual order leaves out the characters removed by rule X9
+		std::string order;
+		size_t last = c.starts.size();
+		for(auto& run : printui::text::visual_runs(attributes.data(), uint32_t(attributes.size()))) {
+			for(uint32_t j = 0; j < run.end - run.start; ++j) {
+				auto const cp = c.codepoint_of((run.level & 1) != 0 ? run.end - 1 - j : run.start + j);
+				if(cp == last || levels[cp] == "x")
+					continue;
+				last = cp;
+				order += (order.empty() ? "" : " ") + std::to_string(cp);
+			}
+		}
+		REQUIRE(order == fields[4]);
+	}
+}
+
+TEST_CASE("segmentation beyond the conformance files", "[parsing_tests]") {
+	std::vector<printui::text::logical_attributes> attributes(2);
+	// a lone surrogate is a control
+	printui::text::segment_text(attributes.data(), std::wstring{ wchar_t(0xD800), L'a' }, true, false);
+	REQUIRE((attributes[1].flags & printui::text::logical_attributes::char_stop) != 0);
+
+	attributes.resize(6);
+	printui::text::segment_text(attributes.data(), L"ab \tcd", true, false);
+	REQUIRE(attributes[2].flags == (printui::text::logical_attributes::char_stop | printui::text::logical_attributes::white_space));
+	REQUIRE(attributes[3].flags == (printui::text::logical_attributes::char_stop | printui::text::logical_attributes::white_space));
+	REQUIRE(attributes[4].flags == (printui::text::logical_attributes::char_stop | printui::text::logical_attributes::word_stop | printui::text::logical_attributes::soft_break));
+	REQUIRE(attributes[5].flags == printui::text::logical_attributes::char_stop);
+
+	// each paragraph is resolved on its own
+	attributes.resize(3);
+	printui::text::segment_text(attributes.data(), std::wstring{ wchar_t(0x05D0), L'\n', L'a' }, false, false);
+	REQUIRE(attributes[0].bidi_level == 1);
+	REQUIRE(attributes[1].bidi_level == 1);
+	REQUIRE(attributes[2].bidi_level == 2);
+
+	// european digits without a strong character before them are arabic numbers in an arabic number context
+	printui::text::segment_text(attributes.data(), L"1 a", true, true);
+	REQUIRE(attributes[0].bidi_level == 2);
+	REQUIRE(attributes[2].bidi_level == 0);
+
+	// explicit embeddings deeper than 125 levels overflow and are ignored
+	std::wstring deep(130, wchar_t(0x202A));
+	deep += L'a';
+	attributes.resize(deep.length());
+	printui::text::segment_text(attributes.data(), deep, true, false);
+	REQUIRE(attributes.back().bidi_level == 124);
+
+	std::vector<printui::text::logical_attributes> levels(8);
+	uint8_t const line_levels[] = { 0, 0, 1, 1, 2, 2, 1, 0 };
+	for(size_t i = 0; i < levels.size(); ++i)
+		levels[i].bidi_level = line_levels[i];
+	auto runs = printui::text::visual_runs(levels.data(), uint32_t(levels.size()));
+	REQUIRE(runs.size() == 5);
+	REQUIRE(runs[0].start == 0);
+	REQUIRE(runs[1].start == 6);
+	REQUIRE(runs[2].start == 4);
+	REQUIRE(runs[3].start == 2);
+	REQUIRE(runs[4].start == 7);
+}
+
+TEST_CASE("text bundle round trip", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	std::string_view first_file = "shared { first \\it{version} } count {masc}{ \\1 \\match{1.one 1.masc}{ file }{}{ files } }";
+	std::string_view second_file = "shared { second version } extra {fem}{ \\match{1.fem}{ her }{}{ its } own }";
+
+	printui::text::text_data_storage parsed;
+	parsed.consume_text_file(first_file, font_name_to_index);
+	parsed.consume_text_file(second_file, font_name_to_index);
+
+	printui::text::text_data_storage first_compiled;
+	first_compiled.consume_text_file(first_file, font_name_to_index);
+	printui::text::text_data_storage second_compiled;
+	second_compiled.consume_text_file(second_file, font_name_to_index);
+
+	auto first_bundle = printui::text::serialize_text_bundle(first_compiled, 1);
+	auto second_bundle = printui::text::serialize_text_bundle(second_compiled, 2);
+
+	printui::text::text_data_storage loaded;
+	REQUIRE(printui::text::load_text_bundle(loaded, first_bundle, 1));
+	REQUIRE(printui::text::load_text_bundle(loaded, second_bundle, 2));
+
+	REQUIRE(loaded.internal_text_name_map.size() == parsed.internal_text_name_map.size());
+	REQUIRE(loaded.attribute_name_to_id == parsed.attribute_name_to_id);
+
+	printui::text::replaceable_instance param;
+	param.text_content.text = L"1";
+	param.attributes[0] = printui::text::one;
+	param.attributes[1] = parsed.attribute_name_to_id["masc"];
+
+	for(auto const& [name, id] : parsed.internal_text_name_map) {
+		auto loaded_id = loaded.internal_text_name_map[name];
+		auto expected = parsed.stored_functions[id].instantiate(parsed, &param, &param + 1);
+		auto actual = loaded.stored_functions[loaded_id].instantiate(loaded, &param, &param + 1);
+
+		REQUIRE(actual.text_content.text == expected.text_content.text);
+		REQUIRE(actual.text_content.formatting.size() == expected.text_content.formatting.size());
+		REQUIRE(actual.attributes == expected.attributes);
+	}
+
+	printui::text::text_data_storage rejected;
+	REQUIRE(!printui::text::load_text_bundle(rejected, first_bundle, 2));
+	REQUIRE(!printui::text::load_text_bundle(rejected, std::string_view(first_bundle).substr(0, first_bundle.length() - 1), 1));
+	REQUIRE(rejected.stored_functions.empty());
+	REQUIRE(rejected.codepoint_storage.empty());
+
+	auto listed_bundle = printui::text::serialize_text_bundle(first_compiled, 1, 7);
+	auto stamps = printui::text::read_text_bundle_stamps(listed_bundle);
+	REQUIRE(stamps);
+	REQUIRE(stamps->source == 1);
+	REQUIRE(stamps->listing == 7);
+	printui::text::restamp_text_bundle(listed_bundle, 8);
+	REQUIRE(printui::text::read_text_bundle_stamps(listed_bundle)->listing == 8);
+	printui::text::text_data_storage restamped;
+	REQUIRE(printui::text::load_text_bundle(restamped, listed_bundle, 1));
+	REQUIRE(!printui::text::read_text_bundle_stamps(std::string_view(listed_bundle).substr(0, 8)));
+}
+
+TEST_CASE("utf8 text storage", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	std::string_view first_file = "greeting { caf\xC3\xA9 \\it{\xE2\x82\xAC\\c{0x1F600}} \\1 \\b{na\xC3\xAFve} } bad { a\xE2\x82 b }";
+	std::string_view second_file = "count {masc}{ \\1 \\match{1.one 1.masc}{ \\sup{\xC3\xA9}l\xC3\xA9ment }{}{ \xC3\xA9l\xC3\xA9ments } }";
+
+	printui::text::text_data_storage wide;
+	wide.consume_text_file(first_file, font_name_to_index);
+	wide.consume_text_file(second_file, font_name_to_index);
+
+	printui::text::text_data_storage narrow;
+	narrow.encoding = printui::text::text_storage_encoding::utf8;
+	narrow.consume_text_file(first_file, font_name_to_index);
+	narrow.consume_text_file(second_file, font_name_to_index);
+
+	REQUIRE(narrow.codepoint_storage.empty());
+	REQUIRE(narrow.utf8_storage.length() < sizeof(wchar_t) * wide.codepoint_storage.length());
+
+	auto narrow_bundle = printui::text::serialize_text_bundle(narrow, 1);
+	REQUIRE(narrow_bundle.length() < printui::text::serialize_text_bundle(wide, 1).length());
+	printui::text::text_data_storage wide_loaded;
+	REQUIRE(!printui::text::load_text_bundle(wide_loaded, narrow_bundle, 1));
+	printui::text::text_data_storage narrow_loaded;
+	narrow_loaded.encoding = printui::text::text_storage_encoding::utf8;
+	REQUIRE(printui::text::load_text_bundle(narrow_loaded, narrow_bundle, 1));
+
+	printui::text::replaceable_instance param;
+	param.text_content.text = L"\u00E9";
+	param.text_content.formatting.push_back(printui::text::format_marker{ 0, printui::text::extra_formatting::bold });
+	param.attributes[0] = printui::text::one;
+	param.attributes[1] = wide.attribute_name_to_id["masc"];
+
+	auto same_positions = [](printui::text::text_with_formatting const& a, printui::text::text_with_formatting const& b) {
+		return std::equal(a.formatting.begin(), a.formatting.end(), b.formatting.begin(), b.formatting.end(), [](auto const& x, auto const& y) {
+			return x.position == y.position && x.format.index() == y.format.index();
+		});
+	};
+
+	for(auto const& [name, id] : wide.internal_text_name_map) {
+		auto expected = wide.stored_functions[id].instantiate(wide, &param, &param + 1);
+		for(auto* storage : { &narrow, &narrow_loaded }) {
+			auto actual = storage->stored_functions[storage->internal_text_name_map[name]].instantiate(*storage, &param, &param + 1);
+			REQUIRE(actual.text_content.text == expected.text_content.text);
+			REQUIRE(same_positions(actual.text_content, expected.text_content));
+		}
+
+		printui::text::text_with_formatting expected_unsubstituted;
+		expected_unsubstituted.append(wide, wide.static_matcher_storage[wide.stored_functions[id].begin_patterns].base_text);
+		printui::text::text_with_formatting actual_unsubstituted;
+		actual_unsubstituted.append(narrow, narrow.static_matcher_storage[narrow.stored_functions[narrow.internal_text_name_map[name]].begin_patterns].base_text);
+		REQUIRE(actual_unsubstituted.text == expected_unsubstituted.text);
+		REQUIRE(same_positions(actual_unsubstituted, expected_unsubstituted));
+	}
+
+	auto bad = narrow.stored_functions[narrow.internal_text_name_map["bad"]].instantiate(narrow, nullptr, nullptr);
+	REQUIRE(bad.text_content.text == L"a\uFFFD b");
+}
+
+TEST_CASE("parallel file loading", "[parsing_tests]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	std::array<std::string_view, 4> files = {
+		"shared { first \\it{version} } count {masc}{ \\1 \\match{1.one 1.masc}{ file }{}{ files } }",
+		"empty {} shared { second version } extra {fem}{ \\match{1.fem}{ her }{}{ its } own }",
+		"empty { now filled } other {neut masc}{ \\match{1.neut}{ it }{}{ they } }",
+		"extra { third version } last { \\b{done} }"
+	};
+
+	printui::text::text_data_storage parsed;
+	for(auto f : files) {
+		parsed.consume_text_file(f, font_name_to_index);
+	}
+
+	printui::text::text_data_storage loaded;
+	printui::text::consume_text_files(loaded, files.size(), [&](size_t i, printui::text::text_data_storage& partial) {
+		partial.consume_text_file(files[i], font_name_to_index);
+	}, 4);
+
+	REQUIRE(loaded.internal_text_name_map.size() == parsed.internal_text_name_map.size());
+	REQUIRE(loaded.attribute_name_to_id.size() == parsed.attribute_name_to_id.size());
+	REQUIRE(loaded.compiled_matchers.size() == loaded.static_matcher_storage.size());
+
+	for(auto const& [name, id] : parsed.internal_text_name_map) {
+		auto loaded_id = loaded.internal_text_name_map[name];
+		for(auto const& [attribute_name, attribute_id] : parsed.attribute_name_to_id) {
+			printui::text::replaceable_instance param;
+			param.text_content.text = L"1";
+			param.attributes[0] = printui::text::one;
+			param.attributes[1] = attribute_id;
+			printui::text::replaceable_instance loaded_param = param;
+			loaded_param.attributes[1] = loaded.attribute_name_to_id[attribute_name];
+
+			auto expected = parsed.stored_functions[id].instantiate(parsed, &param, &param + 1);
+			auto actual = loaded.stored_functions[loaded_id].instantiate(loaded, &loaded_param, &loaded_param + 1);
+
+			REQUIRE(actual.text_content.text == expected.text_content.text);
+			REQUIRE(actual.text_content.formatting.size() == expected.text_content.formatting.size());
+		}
+	}
+}
+
+TEST_CASE("instantiation cache", "[parsing_tests]") {
+	printui::text::instantiation_cache cache;
+	printui::text::text_with_formatting result;
+	result.text = L"cached";
+	result.formatting.push_back(printui::text::format_marker{ 2, printui::text::extra_formatting::bold });
+
+	std::array<printui::text::text_parameter, 2> params = { printui::text::int_param{ 12, 0 }, printui::text::fp_param{ 1.5, 2 } };
+	std::array<printui::text::text_parameter, 2> other_params = { printui::text::int_param{ 12, 0 }, printui::text::fp_param{ 1.5, 1 } };
+
+	printui::text::text_with_formatting out;
+	REQUIRE(!cache.retrieve(3, params.data(), params.data() + 2, 0, out));
+	cache.store(3, params.data(), params.data() + 2, 0, result);
+
+	REQUIRE(cache.retrieve(3, params.data(), params.data() + 2, 0, out));
+	REQUIRE(out.text == L"cached");
+	REQUIRE(out.formatting.size() == 1);
+	REQUIRE(!cache.retrieve(4, params.data(), params.data() + 2, 0, out));
+	REQUIRE(!cache.retrieve(3, other_params.data(), other_params.data() + 2, 0, out));
+	REQUIRE(!cache.retrieve(3, params.data(), params.data() + 1, 0, out));
+	REQUIRE(!cache.retrieve(3, params.data(), params.data() + 2, 1, out));
+
+	// more distinct keys than the cache can hold: it stays bounded and keeps answering correctly
+	for(int64_t i = 0; i < 1000; ++i) {
+		printui::text::text_parameter p = printui::text::int_param{ i, 0 };
+		result.text = std::to_wstring(i);
+		cache.store(1, &p, &p + 1, 0, result);
+	}
+	printui::text::text_parameter last = printui::text::int_param{ 999, 0 };
+	REQUIRE(cache.retrieve(1, &last, &last + 1, 0, out));
+	REQUIRE(out.text == L"999");
+
+	auto counters = cache.get_counters();
+	REQUIRE(counters.hits == 2);
+	REQUIRE(counters.misses == 5);
+
+	cache.clear();
+	REQUIRE(!cache.retrieve(1, &last, &last + 1, 0, out));
+}
+
+std::map<printui::text::arranged_text*, int32_t> arrangement_references;
+
+void count_retain(printui::text::arranged_text* ptr) {
+	++arrangement_references[ptr];
+}
+void count_release(printui::text::arranged_text* ptr) {
+	--arrangement_references[ptr];
+}
+
+printui::text::arranged_text* fake_arrangement(uintptr_t i) {
+	return reinterpret_cast<printui::text::arranged_text*>((i + 1) * 16);
+}
+
+TEST_CASE("arrangement cache", "[parsing_tests]") {
+	arrangement_references.clear();
+	printui::text::arrangement_cache cache(count_retain, count_release);
+
+	std::vector<printui::text::format_marker> formatting;
+	formatting.push_back(printui::text::format_marker{ 2, printui::text::extra_formatting::bold });
+
+	printui::text::arrangement_key key;
+	key.text = L"shared text";
+	key.formatting = &formatting;
+	key.max_width = 40;
+	key.layout_size = 20;
+
+	REQUIRE(cache.find(key).ptr == nullptr);
+	cache.insert(key, printui::text::arrangement_result{ fake_arrangement(0), 30, 2 });
+	REQUIRE(arrangement_references[fake_arrangement(0)] == 1);
+
+	// the key is copied into the cache, so an equal key built from other storage still finds it
+	std::wstring same_text = L"shared text";
+	auto same_formatting_copy = formatting;
+	auto other = key;
+	other.text = same_text;
+	other.formatting = &same_formatting_copy;
+	auto found = cache.find(other);
+	REQUIRE(found.ptr == fake_arrangement(0));
+	REQUIRE(found.width_used == 30);
+	REQUIRE(found.lines_used == 2);
+	REQUIRE(arrangement_references[fake_arrangement(0)] == 2);
+
+	auto text_differs = key;
+	text_differs.text = L"shared text.";
+	REQUIRE(cache.find(text_differs).ptr == nullptr);
+	auto formatting_differs = key;
+	formatting_differs.formatting = nullptr;
+	REQUIRE(cache.find(formatting_differs).ptr == nullptr);
+	auto region_differs = key;
+	region_differs.region = printui::screen_space_point{ 30, 2 };
+	REQUIRE(cache.find(region_differs).ptr == nullptr);
+	auto fonts_differ = key;
+	fonts_differ.font_generation = 1;
+	REQUIRE(cache.find(fonts_differ).ptr == nullptr);
+
+	// filling the cache evicts the least recently used arrangement, but only drops the cache's own reference to it
+	std::vector<std::wstring> texts;
+	for(uint32_t i = 0; i < printui::text::arrangement_cache::capacity; ++i) {
+		texts.push_back(L"text " + std::to_wstring(i));
+	}
+	for(uint32_t i = 0; i < printui::text::arrangement_cache::capacity; ++i) {
+		auto k = key;
+		k.text = texts[i];
+		cache.insert(k, printui::text::arrangement_result{ fake_arrangement(i + 1), 10, 1 });
+	}
+	REQUIRE(cache.size() == printui::text::arrangement_cache::capacity);
+	REQUIRE(cache.find(key).ptr == nullptr);
+	REQUIRE(arrangement_references[fake_arrangement(0)] == 1);
+
+	auto counters = cache.get_counters();
+	REQUIRE(counters.hits == 1);
+	REQUIRE(counters.misses == 6);
+	REQUIRE(counters.evictions == 1);
+
+	cache.clear();
+	REQUIRE(cache.size() == 0);
+	for(uint32_t i = 1; i <= printui::text::arrangement_cache::capacity; ++i) {
+		REQUIRE(arrangement_references[fake_arrangement(i)] == 0);
+	}
+
+	// an arrangement only its inserter has can be taken back to be adjusted; once it has been shared it stays in the cache
+	cache.insert(key, printui::text::arrangement_result{ fake_arrangement(0), 30, 2 });
+	cache.insert(text_differs, printui::text::arrangement_result{ fake_arrangement(1), 30, 2 });
+	REQUIRE(cache.take_exclusive(key, fake_arrangement(1)) == false);
+	REQUIRE(cache.take_exclusive(region_differs, fake_arrangement(0)) == false);
+	REQUIRE(cache.take_exclusive(key, fake_arrangement(0)));
+	REQUIRE(arrangement_references[fake_arrangement(0)] == 1);
+	REQUIRE(cache.size() == 1);
+	REQUIRE(cache.find(key).ptr == nullptr);
+	REQUIRE(cache.find(text_differs).ptr == fake_arrangement(1));
+	REQUIRE(cache.take_exclusive(text_differs, fake_arrangement(1)) == false);
+	cache.clear();
+	REQUIRE(arrangement_references[fake_arrangement(1)] == 1);
+
+	// placeholder sizes: ten glyphs half a line spacing wide fit in five layout units, longer text wraps at max_width
+	auto short_estimate = printui::text::estimate_arrangement(10, 20.0f, 20, 40, false);
+	REQUIRE(short_estimate.width_used == 5);
+	REQUIRE(short_estimate.lines_used == 1);
+	auto long_estimate = printui::text::estimate_arrangement(200, 20.0f, 20, 40, false);
+	REQUIRE(long_estimate.width_used == 40);
+	REQUIRE(long_estimate.lines_used == 3);
+	auto single_line_estimate = printui::text::estimate_arrangement(200, 20.0f, 20, 40, true);
+	REQUIRE(single_line_estimate.width_used == 100);
+	REQUIRE(single_line_estimate.lines_used == 1);
+}
+
+TEST_CASE("background queue", "[parsing_tests]") {
+	printui::background_queue queue(2);
+	std::atomic<uint32_t> jobs_run{ 0 };
+	std::atomic<uint32_t> completions{ 0 };
+	queue.on_job_complete = [&]() { ++completions; };
+
+	for(uint32_t i = 0; i < 100; ++i) {
+		queue.submit([&]() { ++jobs_run; });
+	}
+	queue.wait_until_idle();
+	REQUIRE(jobs_run == 100);
+	REQUIRE(completions == 100);
+
+	// a job that is running is waited for, the ones queued behind it are dropped
+	std::atomic<bool> started = false;
+	std::atomic<bool> go = false;
+	printui::background_queue single(1);
+	single.submit([&]() {
+		started = true;
+		while(!go)
+			std::this_thread::yield();
+	});
+	for(uint32_t i = 0; i < 10; ++i) {
+		single.submit([&]() { ++jobs_run; });
+	}
+	while(!started)
+		std::this_thread::yield();
+
+	std::thread release_job([&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		go = true;
+	});
+	auto const generation = single.generation();
+	single.cancel_pending();
+	release_job.join();
+	REQUIRE(go);
+	REQUIRE(jobs_run == 100);
+	REQUIRE(single.generation() != generation);
+
+	single.submit([&]() { ++jobs_run; });
+	single.wait_until_idle();
+	REQUIRE(jobs_run == 101);
+}
+
+printui::text::number_format make_number_format(uint32_t leading_zero, uint32_t grouping, uint32_t negative_order, std::wstring_view decimal, std::wstring_view thousand, std::wstring_view negative = L"-") {
+	printui::text::number_format result;
+	result.leading_zero = leading_zero;
+	result.grouping = grouping;
+	result.negative_order = negative_order;
+	decimal.copy(result.decimal_separator, 4);
+	result.decimal_separator[decimal.length()] = 0;
+	thousand.copy(result.thousand_separator, 4);
+	result.thousand_separator[thousand.length()] = 0;
+	negative.copy(result.negative_sign, 4);
+	result.negative_sign[negative.length()] = 0;
+	return result;
+}
+
+TEST_CASE("number formatting", "[parsing_tests]") {
+	// expected values follow the documented behaviour of GetNumberFormatEx for the same NUMBERFMTW and decimal string;
+	// the test below compares the formatter with GetNumberFormatEx itself, but only when built on windows
+	auto const en_us = make_number_format(1, 3, 1, L".", L",");
+	auto const de_de = make_number_format(1, 3, 1, L",", L".");
+	auto const fr_fr = make_number_format(1, 3, 1, L",", L"\u202F");
+	auto const hi_in = make_number_format(1, 32, 1, L".", L",");
+	auto const sv_se = make_number_format(1, 3, 1, L",", L"\u00A0", L"\u2212");
+
+	struct integer_case {
+		printui::text::number_format const& fmt;
+		int64_t value;
+		uint32_t decimal_places;
+		std::wstring_view expected;
+	};
+	integer_case const integer_cases[] = {
+		{ en_us, 0, 0, L"0" },
+		{ en_us, 7, 0, L"7" },
+		{ en_us, 999, 0, L"999" },
+		{ en_us, 1000, 0, L"1,000" },
+		{ en_us, 1234567, 0, L"1,234,567" },
+		{ en_us, 1234567, 2, L"1,234,567.00" },
+		{ en_us, -42, 0, L"-42" },
+		{ en_us, INT64_MIN, 0, L"-9,223,372,036,854,775,808" },
+		{ en_us, INT64_MAX, 0, L"9,223,372,036,854,775,807" },
+		{ de_de, 1234567, 1, L"1.234.567,0" },
+		{ fr_fr, -1234, 0, L"-1\u202F234" },
+		{ hi_in, 123456789, 0, L"12,34,56,789" },
+		{ hi_in, 1234, 0, L"1,234" },
+		{ sv_se, -3000, 0, L"\u22123\u00A0000" },
+		{ make_number_format(1, 30, 1, L".", L","), 123456789, 0, L"123456,789" },
+		{ make_number_format(1, 0, 1, L".", L","), 123456789, 0, L"123456789" },
+		{ make_number_format(1, 320, 1, L".", L","), 123456789, 0, L"1234,56,789" },
+		{ make_number_format(1, 3, 0, L".", L","), -15, 1, L"(15.0)" },
+		{ make_number_format(1, 3, 2, L".", L","), -15, 1, L"- 15.0" },
+		{ make_number_format(1, 3, 3, L".", L","), -15, 1, L"15.0-" },
+		{ make_number_format(1, 3, 4, L".", L","), -15, 1, L"15.0 -" },
+	};
+	for(auto const& c : integer_cases) {
+		std::wstring out = L"prefix ";
+		printui::text::append_formatted_integer(out, c.value, c.decimal_places, c.fmt);
+		REQUIRE(out == L"prefix " + std::wstring(c.expected));
+	}
+
+	struct decimal_case {
+		printui::text::number_format const& fmt;
+		double value;
+		uint32_t decimal_places;
+		std::wstring_view expected;
+	};
+	decimal_case const decimal_cases[] = {
+		{ en_us, 0.0, 0, L"0" },
+		{ en_us, 0.0, 2, L"0.00" },
+		{ en_us, 1234.5678, 2, L"1,234.57" },
+		{ en_us, 1234.5678, 0, L"1,235" },
+		{ en_us, 0.125, 2, L"0.13" },
+		{ en_us, 0.5, 0, L"1" },
+		{ en_us, 999.995, 2, L"1,000.00" },
+		{ en_us, 9.9999999, 3, L"10.000" },
+		{ en_us, 2.5, 9, L"2.500000000" },
+		{ en_us, -0.001, 2, L"0.00" }, // a value that rounds to zero loses its sign
+		{ en_us, -0.001, 3, L"-0.001" },
+		{ en_us, -1234.5, 1, L"-1,234.5" },
+		{ en_us, 1e20, 0, L"100,000,000,000,000,000,000" },
+		{ de_de, 1234567.891, 2, L"1.234.567,89" },
+		{ fr_fr, 1234.5, 1, L"1\u202F234,5" },
+		{ hi_in, 12345678.9, 1, L"1,23,45,678.9" },
+		{ make_number_format(0, 3, 1, L".", L","), 0.5, 2, L".50" },
+		{ make_number_format(0, 3, 1, L".", L","), -0.5, 2, L"-.50" },
+		{ make_number_format(0, 3, 1, L".", L","), 0.4, 0, L"0" },
+		{ make_number_format(1, 3, 0, L".", L","), -2.25, 1, L"(2.3)" },
+	};
+	for(auto const& c : decimal_cases) {
+		std::wstring out;
+		printui::text::append_formatted_decimal(out, c.value, c.decimal_places, c.fmt);
+		REQUIRE(out == c.expected);
+	}
+}
+
+#ifdef _WIN32
+TEST_CASE("number formatting against windows", "[parsing_tests]") {
+	// GetNumberFormatEx is handed what the text manager used to hand it: the locale's separators, grouping and
+	// negative sign, and the value printed as a plain decimal string, which for doubles is their %f representation
+	auto windows_format = [](wchar_t const* locale, std::wstring const& digits, uint32_t places, printui::text::number_format const& fmt) {
+		NUMBERFMTW nf{};
+		nf.NumDigits = places;
+		nf.LeadingZero = fmt.leading_zero;
+		nf.Grouping = fmt.grouping;
+		nf.lpDecimalSep = const_cast<wchar_t*>(fmt.decimal_separator);
+		nf.lpThousandSep = const_cast<wchar_t*>(fmt.thousand_separator);
+		nf.NegativeOrder = fmt.negative_order;
+		wchar_t buffer[128] = {};
+		auto written = GetNumberFormatEx(locale, 0, digits.c_str(), &nf, buffer, 128);
+		REQUIRE(written > 0);
+		return std::wstring(buffer, size_t(written - 1));
+	};
+	// LOCALE_SGROUPING as NUMBERFMTW encodes it: "3;2;0" is 32 and "3" is 30
+	auto locale_grouping = [](wchar_t const* locale) {
+		wchar_t text[32] = {};
+		if(!GetLocaleInfoEx(locale, LOCALE_SGROUPING, text, 32))
+			return uint32_t(3);
+		uint32_t result = 0;
+		for(auto c = text; ; ++c) {
+			if(*c == L'0') {
+				break;
+			} else if(*c >= L'1' && *c <= L'9') {
+				result = result * 10 + uint32_t(*c - L'0');
+			} else if(*c == 0) {
+				result = result * 10;
+				break;
+			}
+		}
+		return result;
+	};
+
+	wchar_t const* const locales[] = { L"en-US", L"de-DE", L"fr-FR", L"hi-IN", L"sv-SE", L"ar-SA", L"fa-IR" };
+	int64_t const integers[] = { 0, 7, -7, 999, 1000, -1000, 1234567, -1234567, 123456789, INT64_MIN, INT64_MAX };
+	double const decimals[] = { 0.0, 0.125, 0.5, -0.5, 0.4, -0.4, 1234.5678, 999.995, 9.9999999, -0.001, -0.004, -0.005, -0.0051, -1234.5, 1e20, 2.5, -2.25 };
+	uint32_t const places_tested[] = { 0, 1, 2, 3, 9 };
+	std::mt19937_64 random(20261020);
+	std::uniform_real_distribution<double> magnitude(-1.0e7, 1.0e7);
+
+	for(auto locale : locales) {
+		printui::text::number_format fmt;
+		fmt.grouping = locale_grouping(locale);
+		REQUIRE(GetLocaleInfoEx(locale, LOCALE_SDECIMAL, fmt.decimal_separator, 5) != 0);
+		REQUIRE(GetLocaleInfoEx(locale, LOCALE_STHOUSAND, fmt.thousand_separator, 5) != 0);
+		REQUIRE(GetLocaleInfoEx(locale, LOCALE_SNEGATIVESIGN, fmt.negative_sign, 5) != 0);
+
+		for(uint32_t negative_order = 0; negative_order <= 4; ++negative_order) {
+			for(uint32_t leading_zero = 0; leading_zero <= 1; ++leading_zero) {
+				fmt.negative_order = negative_order;
+				fmt.leading_zero = leading_zero;
+				for(auto places : places_tested) {
+					for(auto value : integers) {
+						INFO("integer " << value << ", " << places << " places, negative order " << negative_order << ", leading zero " << leading_zero);
+						std::wstring out;
+						printui::text::append_formatted_integer(out, value, places, fmt);
+						REQUIRE(out == windows_format(locale, std::to_wstring(value), places, fmt));
+					}
+					auto check_decimal = [&](double value) {
+						INFO("decimal " << value << ", " << places << " places, negative order " << negative_order << ", leading zero " << leading_zero);
+						std::wstring out;
+						printui::text::append_formatted_decimal(out, value, places, fmt);
+						REQUIRE(out == windows_format(locale, std::to_wstring(value), places, fmt));
+					};
+					for(auto value : decimals) {
+						check_decimal(value);
+					}
+					for(int32_t i = 0; i < 20; ++i) {
+						check_decimal(magnitude(random) / double(uint64_t(1) << (i % 24)));
+					}
+				}
+			}
+		}
+	}
+}
+#endif
+
+TEST_CASE("number parsing", "[parsing_tests]") {
+	auto const en_us = make_number_format(1, 3, 1, L".", L",");
+	auto const de_de = make_number_format(1, 3, 1, L",", L".");
+	auto const fr_fr = make_number_format(1, 3, 1, L",", L"\u202F");
+
+	REQUIRE(printui::text::parse_formatted_integer(L"1,234,567", en_us) == 1234567);
+	REQUIRE(printui::text::parse_formatted_integer(L" 1234567 ", en_us) == 1234567);
+	REQUIRE(printui::text::parse_formatted_integer(L"-42", en_us) == -42);
+	REQUIRE(printui::text::parse_formatted_integer(L"(42)", en_us) == -42);
+	REQUIRE(printui::text::parse_formatted_integer(L"42-", en_us) == -42);
+	REQUIRE(printui::text::parse_formatted_integer(L"+42", en_us) == 42);
+	REQUIRE(printui::text::parse_formatted_integer(L"2.5", en_us) == 2);
+	REQUIRE(printui::text::parse_formatted_integer(L"3.5", en_us) == 4);
+	REQUIRE(printui::text::parse_formatted_integer(L"9223372036854775807", en_us) == INT64_MAX);
+	REQUIRE(printui::text::parse_formatted_integer(L"9223372036854775808", en_us) == 0);
+	REQUIRE(printui::text::parse_formatted_integer(L"12abc", en_us) == 0);
+	REQUIRE(printui::text::parse_formatted_integer(L"", en_us) == 0);
+	REQUIRE(printui::text::parse_formatted_integer(L"-", en_us) == 0);
+
+	REQUIRE(printui::text::parse_formatted_decimal(L"1.234.567,25", de_de) == 1234567.25);
+	REQUIRE(printui::text::parse_formatted_decimal(L"1,5", de_de) == 1.5);
+	REQUIRE(printui::text::parse_formatted_decimal(L"1 234,5", fr_fr) == 1234.5);
+	REQUIRE(printui::text::parse_formatted_decimal(L"1.5e3", en_us) == 1500.0);
+	REQUIRE(printui::text::parse_formatted_decimal(L".5", en_us) == 0.5);
+	REQUIRE(printui::text::parse_formatted_decimal(L"1.5.5", en_us) == 0.0);
+	REQUIRE(printui::text::parse_formatted_decimal(L"1e", en_us) == 0.0);
+
+	// whatever the formatter writes, the parser reads back as the value rounded to the places written
+	std::mt19937_64 random(20261019);
+	printui::text::number_format const formats[] = {
+		en_us, de_de, fr_fr,
+		make_number_format(1, 32, 0, L".", L","),
+		make_number_format(0, 3, 3, L",", L"'"),
+		make_number_format(1, 30, 4, L".", L",", L"\u2212"),
+		make_number_format(1, 3, 2, L",", L"\u00A0"),
+	};
+	for(auto const& fmt : formats) {
+		for(uint32_t i = 0; i < 1000; ++i) {
+			auto const value = int64_t(random()) >> (random() % 63);
+			std::wstring text;
+			printui::text::append_formatted_integer(text, value, 0, fmt);
+			REQUIRE(printui::text::parse_formatted_integer(text, fmt) == value);
+
+			auto const places = uint32_t(random() % 7);
+			auto const decimal = double(int64_t(random()) >> (random() % 63)) / double(uint64_t(1) << (random() % 40));
+			text.clear();
+			printui::text::append_formatted_decimal(text, decimal, places, fmt);
+
+			char expected_text[400];
+			auto const end = std::to_chars(expected_text, expected_text + sizeof(expected_text), decimal, std::chars_format::fixed, 6).ptr;
+			double expected = 0.0;
+			std::from_chars(expected_text, end, expected);
+			auto const scale = std::pow(10.0, double(places));
+			auto const parsed = printui::text::parse_formatted_decimal(text, fmt);
+			REQUIRE(std::abs(parsed - expected) <= 0.5 / scale + std::abs(expected) * 1e-15);
+		}
+	}
+}
+
+TEST_CASE("plural rules", "[parsing_tests]") {
+	// sample values from the cldr plural rules; a number is given as its integer digits i, visible fraction digits f, and their count v
+	struct cardinal_sample {
+		std::wstring_view locale;
+		int64_t i;
+		int64_t f;
+		int32_t v;
+		printui::text::attribute_type expected;
+	};
+	cardinal_sample const cardinal_samples[] = {
+		{ L"en", 1, 0, 0, printui::text::one }, { L"en", 0, 0, 0, printui::text::other }, { L"en", 2, 0, 0, printui::text::other },
+		{ L"en", 16, 0, 0, printui::text::other }, { L"en", 1, 0, 1, printui::text::other }, { L"en", 0, 5, 1, printui::text::other },
+		{ L"de", 1, 0, 0, printui::text::one }, { L"de", 1000, 0, 0, printui::text::other },
+		{ L"fr", 0, 0, 0, printui::text::one }, { L"fr", 1, 0, 0, printui::text::one }, { L"fr", 1, 5, 1, printui::text::one },
+		{ L"fr", 2, 0, 0, printui::text::other }, { L"fr", 1000000, 0, 0, printui::text::many }, { L"fr", 100000, 0, 0, printui::text::other },
+		{ L"ru", 1, 0, 0, printui::text::one }, { L"ru", 21, 0, 0, printui::text::one }, { L"ru", 101, 0, 0, printui::text::one },
+		{ L"ru", 2, 0, 0, printui::text::few }, { L"ru", 24, 0, 0, printui::text::few }, { L"ru", 0, 0, 0, printui::text::many },
+		{ L"ru", 5, 0, 0, printui::text::many }, { L"ru", 11, 0, 0, printui::text::many }, { L"ru", 14, 0, 0, printui::text::many },
+		{ L"ru", 100, 0, 0, printui::text::many }, { L"ru", 1, 5, 1, printui::text::other }, { L"ru", 10, 0, 1, printui::text::other },
+		{ L"pl", 1, 0, 0, printui::text::one }, { L"pl", 22, 0, 0, printui::text::few }, { L"pl", 0, 0, 0, printui::text::many },
+		{ L"pl", 12, 0, 0, printui::text::many }, { L"pl", 21, 0, 0, printui::text::many }, { L"pl", 0, 5, 1, printui::text::other },
+		{ L"cs", 1, 0, 0, printui::text::one }, { L"cs", 3, 0, 0, printui::text::few }, { L"cs", 5, 0, 0, printui::text::other },
+		{ L"cs", 0, 5, 1, printui::text::many },
+		{ L"ar", 0, 0, 0, printui::text::zero }, { L"ar", 1, 0, 0, printui::text::one }, { L"ar", 2, 0, 0, printui::text::two },
+		{ L"ar", 3, 0, 0, printui::text::few }, { L"ar", 110, 0, 0, printui::text::few }, { L"ar", 11, 0, 0, printui::text::many },
+		{ L"ar", 1011, 0, 0, printui::text::many }, { L"ar", 100, 0, 0, printui::text::other }, { L"ar", 0, 1, 1, printui::text::other },
+		{ L"cy", 0, 0, 0, printui::text::zero }, { L"cy", 1, 0, 0, printui::text::one }, { L"cy", 2, 0, 0, printui::text::two },
+		{ L"cy", 3, 0, 0, printui::text::few }, { L"cy", 6, 0, 0, printui::text::many }, { L"cy", 4, 0, 0, printui::text::other },
+		{ L"lt", 1, 0, 0, printui::text::one }, { L"lt", 21, 0, 0, printui::text::one }, { L"lt", 2, 0, 0, printui::text::few },
+		{ L"lt", 29, 0, 0, printui::text::few }, { L"lt", 0, 1, 1, printui::text::many }, { L"lt", 10, 0, 0, printui::text::other },
+		{ L"lt", 11, 0, 0, printui::text::other },
+		{ L"is", 1, 0, 0, printui::text::one }, { L"is", 21, 0, 0, printui::text::one }, { L"is", 11, 0, 0, printui::text::other },
+		{ L"is", 5, 0, 0, printui::text::other },
+		{ L"pt-PT", 1, 0, 0, printui::text::one }, { L"pt-PT", 0, 0, 0, printui::text::other }, { L"pt", 0, 0, 0, printui::text::one },
+	};
+	for(auto const& c : cardinal_samples) {
+		auto fn = printui::text::find_cardinal_plural_rule(c.locale);
+		REQUIRE(fn != nullptr);
+		REQUIRE(fn(c.i, c.f, c.v) == c.expected);
+	}
+
+	struct ordinal_sample {
+		std::wstring_view locale;
+		int64_t n;
+		printui::text::attribute_type expected;
+	};
+	ordinal_sample const ordinal_samples[] = {
+		{ L"en", 1, printui::text::ord_one }, { L"en", 21, printui::text::ord_one }, { L"en", 2, printui::text::ord_two },
+		{ L"en", 22, printui::text::ord_two }, { L"en", 3, printui::text::ord_few }, { L"en", 103, printui::text::ord_few },
+		{ L"en", 0, printui::text::ord_other }, { L"en", 4, printui::text::ord_other }, { L"en", 11, printui::text::ord_other },
+		{ L"en", 12, printui::text::ord_other }, { L"en", 13, printui::text::ord_other },
+		{ L"sv", 1, printui::text::ord_one }, { L"sv", 22, printui::text::ord_one }, { L"sv", 12, printui::text::ord_other },
+		{ L"it", 8, printui::text::ord_many }, { L"it", 800, printui::text::ord_many }, { L"it", 9, printui::text::ord_other },
+		{ L"cy", 0, printui::text::ord_zero }, { L"cy", 9, printui::text::ord_zero }, { L"cy", 1, printui::text::ord_one },
+		{ L"cy", 2, printui::text::ord_two }, { L"cy", 4, printui::text::ord_few }, { L"cy", 6, printui::text::ord_many },
+		{ L"cy", 10, printui::text::ord_other },
+	};
+	for(auto const& c : ordinal_samples) {
+		auto fn = printui::text::find_ordinal_plural_rule(c.locale);
+		REQUIRE(fn != nullptr);
+		REQUIRE(fn(c.n) == c.expected);
+	}
+
+	REQUIRE(printui::text::find_cardinal_plural_rule(L"ja") == nullptr);
+	REQUIRE(printui::text::find_cardinal_plural_rule(L"") == nullptr);
+	REQUIRE(printui::text::find_ordinal_plural_rule(L"de") == nullptr);
+}
+
+TEST_CASE("plural rules conformance", "[parsing_tests]") {
+	// every locale icu has rules for, against the categories icu selected when the rules were generated
+	auto letter = [](printui::text::attribute_type a) { return "zotfmx"[a % 6]; };
+	for(auto const& s : plural_sample_categories) {
+		std::wstring locale;
+		for(auto c = s.locale; *c != 0; ++c) {
+			locale += wchar_t(*c);
+		}
+		// a region without rules of its own falls back to its language, as it does for the text manager
+		auto language = locale.substr(0, locale.find(L'-'));
+		auto cardinal = printui::text::find_cardinal_plural_rule(locale);
+		if(!cardinal)
+			cardinal = printui::text::find_cardinal_plural_rule(language);
+		auto ordinal = printui::text::find_ordinal_plural_rule(locale);
+		if(!ordinal)
+			ordinal = printui::text::find_ordinal_plural_rule(language);
+
+		size_t ordinal_index = 0;
+		for(size_t i = 0; i < std::size(plural_sample_inputs); ++i) {
+			auto const& in = plural_sample_inputs[i];
+			INFO(s.locale << " i = " << in.i << " f = " << in.f << " v = " << in.v);
+			REQUIRE(letter(cardinal ? cardinal(in.i, in.f, in.v) : printui::text::other) == s.cardinal[i]);
+			if(in.v == 0) {
+				REQUIRE(letter(ordinal ? ordinal(in.i) : printui::text::ord_other) == s.ordinal[ordinal_index]);
+				++ordinal_index;
+			}
+		}
+	}
+}
+
+std::string synthetic_text_file(uint32_t entries, uint32_t first_entry = 0) {
+	std::string result;
+	for(uint32_t i = first_entry; i < first_entry + entries; ++i) {
+		result += "entry_" + std::to_string(i) + " { \\it{Item} number \\1 \\match{1.one}{ file }{}{ files } in \\2 }\n";
+	}
+	return result;
+}
+
+TEST_CASE("text loading and instantiation", "[.][text_benchmarks]") {
+	std::unordered_map<std::string, uint32_t, printui::text::string_hash, std::equal_to<>> font_name_to_index;
+	auto const file = synthetic_text_file(5000);
+
+	BENCHMARK("consume_text_file, 5000 entries") {
+		printui::text::text_data_storage tm;
+		tm.consume_text_file(file, font_name_to_index);
+		return tm.stored_functions.size();
+	};
+
+	std::vector<std::string> split_files;
+	for(uint32_t i = 0; i < 16; ++i) {
+		split_files.push_back(synthetic_text_file(5000 / 16, i * (5000 / 16)));
+	}
+	BENCHMARK("consume_text_files, 16 files, 1 thread") {
+		printui::text::text_data_storage tm;
+		printui::text::consume_text_files(tm, split_files.size(), [&](size_t i, printui::text::text_data_storage& partial) {
+			partial.consume_text_file(split_files[i], font_name_to_index);
+		}, 1);
+		return tm.stored_functions.size();
+	};
+	BENCHMARK("consume_text_files, 16 files, all threads") {
+		printui::text::text_data_storage tm;
+		printui::text::consume_text_files(tm, split_files.size(), [&](size_t i, printui::text::text_data_storage& partial) {
+			partial.consume_text_file(split_files[i], font_name_to_index);
+		}, std::thread::hardware_concurrency());
+		return tm.stored_functions.size();
+	};
+
+	printui::text::text_data_storage tm;
+	tm.consume_text_file(file, font_name_to_index);
+
+	auto const bundle = printui::text::serialize_text_bundle(tm, 1);
+	BENCHMARK("load_text_bundle, 5000 entries") {
+		printui::text::text_data_storage loaded;
+		printui::text::load_text_bundle(loaded, bundle, 1);
+		return loaded.stored_functions.size();
+	};
+
+	std::array<printui::text::replaceable_instance, 2> params;
+	params[0].text_content.text = L"12";
+	params[0].attributes[0] = printui::text::other;
+	params[1].text_content.text = L"folder";
+
+	BENCHMARK("instantiate and substitute") {
+		auto result = tm.stored_functions[1234].instantiate(tm, params.data(), params.data() + params.size());
+		result.text_content.make_substitutions(params.data(), params.data() + params.size());
+		return result.text_content.text.length();
+	};
+
+	tm.consume_text_file("status_line { \\1 | \\2 | \\it{\\3} | \\4 | \\5 | \\b{\\6} | \\7 | \\8 | \\9 }", font_name_to_index);
+	auto const& status_line = tm.stored_functions[tm.internal_text_name_map[std::string("status_line")]];
+	std::array<printui::text::replaceable_instance, 9> row;
+	for(uint32_t i = 0; i < row.size(); ++i) {
+		row[i].text_content.text = L"column " + std::to_wstring(i);
+	}
+
+	BENCHMARK("make_substitutions, 9 parameters") {
+		auto result = status_line.instantiate(tm, row.data(), row.data() + row.size());
+		result.text_content.make_substitutions(row.data(), row.data() + row.size());
+		return result.text_content.text.length();
+	};
+
+	printui::text::text_data_storage plurals;
+	plurals.consume_text_file(plural_heavy_text_file(500), font_name_to_index);
+	auto plurals_scanning = plurals;
+	plurals_scanning.compiled_matchers.clear();
+
+	std::array<printui::text::replaceable_instance, 2> plural_params;
+	plural_params[0].text_content.text = L"12";
+	plural_params[0].attributes[0] = printui::text::other;
+	plural_params[1].text_content.text = L"books";
+	plural_params[1].attributes[0] = plurals.attribute_name_to_id["neut"];
+	printui::text::text_with_formatting plural_text;
+
+	BENCHMARK("plural selection, scanning keys") {
+		size_t total = 0;
+		for(uint32_t i = 0; i < 500; ++i) {
+			plural_text.clear();
+			plurals_scanning.stored_functions[i].instantiate_into(plurals_scanning, plural_params.data(), plural_params.data() + 2, plural_text);
+			total += plural_text.text.length();
+		}
+		return total;
+	};
+	BENCHMARK("plural selection, compiled") {
+		size_t total = 0;
+		for(uint32_t i = 0; i < 500; ++i) {
+			plural_text.clear();
+			plurals.stored_functions[i].instantiate_into(plurals, plural_params.data(), plural_params.data() + 2, plural_text);
+			total += plural_text.text.length();
+		}
+		return total;
+	};
+
+	printui::text::text_with_formatting reused;
+	BENCHMARK("instantiate_into reused buffer") {
+		reused.clear();
+		tm.stored_functions[1234].instantiate_into(tm, params.data(), params.data() + params.size(), reused);
+		return reused.text.length();
+	};
+
+	printui::text::number_format const de_de = make_number_format(1, 3, 1, L",", L".");
+	std::wstring number_text;
+	std::vector<std::wstring> formatted_numbers;
+	for(int64_t i = 0; i < 500; ++i) {
+		number_text.clear();
+		printui::text::append_formatted_decimal(number_text, double(i) * 1234.5678, 2, de_de);
+		formatted_numbers.push_back(number_text);
+	}
+	BENCHMARK("parse 500 numbers") {
+		double total = 0.0;
+		for(auto const& n : formatted_numbers) {
+			total += printui::text::parse_formatted_decimal(n, de_de);
+		}
+		return total;
+	};
+	std::wstring_view const plural_locales[] = { L"en", L"fr", L"ru", L"pl", L"ar", L"cy", L"lt", L"ga" };
+	BENCHMARK("find plural rules") {
+		size_t found = 0;
+		for(auto l : plural_locales) {
+			found += printui::text::find_cardinal_plural_rule(l) != nullptr ? 1 : 0;
+		}
+		return found;
+	};
+	auto const russian = printui::text::find_cardinal_plural_rule(L"ru");
+	auto const arabic = printui::text::find_cardinal_plural_rule(L"ar");
+	BENCHMARK("classify 2000 numbers") {
+		int32_t total = 0;
+		for(int64_t i = 0; i < 1000; ++i) {
+			total += russian(i, 0, 0);
+			total += arabic(i, 0, 0);
+		}
+		return total;
+	};
+	BENCHMARK("format 1000 numbers") {
+		size_t total = 0;
+		for(int64_t i = 0; i < 500; ++i) {
+			number_text.clear();
+			printui::text::append_formatted_integer(number_text, i * 7919 - 1000000, 0, de_de);
+			total += number_text.length();
+			number_text.clear();
+			printui::text::append_formatted_decimal(number_text, double(i) * 1234.5678, 2, de_de);
+			total += number_text.length();
+		}
+		return total;
+	};
+
+	std::wstring latin_text;
+	std::wstring mixed_text;
+	while(latin_text.length() < 2000) {
+		latin_text += L"The quick brown fox, can't jump 32.3 feet; right? ";
+		mixed_text += L"The word \u0627\u0644\u0639\u0631\u0628\u064A\u0629 (\u0661\u0662\u0663) means arabic. ";
+	}
+	std::vector<printui::text::logical_attributes> segmented(std::max(latin_text.length(), mixed_text.length()));
+	BENCHMARK("segment 2000 latin characters") {
+		printui::text::segment_text(segmented.data(), latin_text, true, false);
+		return segmented[latin_text.length() - 1].flags;
+	};
+	BENCHMARK("segment 2000 latin characters, right to left") {
+		printui::text::segment_text(segmented.data(), latin_text, false, false);
+		return segmented[latin_text.length() - 1].flags;
+	};
+	BENCHMARK("segment 2000 mixed arabic and latin characters") {
+		printui::text::segment_text(segmented.data(), mixed_text, true, false);
+		return segmented[mixed_text.length() - 1].flags;
+	};
+	printui::text::segment_text(segmented.data(), mixed_text, true, false);
+	BENCHMARK("visual runs of an 80 character mixed line") {
+		return printui::text::visual_runs(segmented.data(), 80).size();
+	};
+
+	printui::text::editable_text_buffer large_text;
+	large_text.assign(std::wstring(200000, L'x'));
+	// the control reads the whole text back after every edit to reshape it, so each edit is followed by a view
+	BENCHMARK("type 100 characters into the middle of 200000") {
+		size_t read = 0;
+		for(uint32_t i = 0; i < 100; ++i) {
+			wchar_t const c[] = { L'a' };
+			large_text.replace(100000 + i, 100000 + i, std::wstring_view(c, 1));
+			auto v = large_text.view();
+			read += v.length() + v.back();
+		}
+		for(uint32_t i = 100; i-- > 0; ) {
+			large_text.replace(100000 + i, 100000 + i + 1, std::wstring_view{});
+			auto v = large_text.view();
+			read += v.length() + v.back();
+		}
+		return read + large_text.take_edit().inserted.length();
+	};
+}
+
+std::vector<printui::ui_rectangle> synthetic_layout(uint32_t width, uint32_t height) {
+	std::vector<printui::ui_rectangle> rects;
+	for(uint32_t y = 0; y + 24 <= height; y += 24) {
+		for(uint32_t x = 0; x + 120 <= width; x += 120) {
+			printui::ui_rectangle r;
+			r.x_position = uint16_t(x);
+			r.y_position = uint16_t(y);
+			r.width = 120;
+			r.height = 24;
+			r.background_index = uint8_t((x / 120 + y / 24) % 3);
+			rects.push_back(r);
+		}
+	}
+	return rects;
+}
+
+TEST_CASE("animation frames", "[animation_tests]") {
+	// a fixed clock that the test advances by hand
+	auto const origin = std::chrono::steady_clock::time_point{} + std::chrono::hours(1);
+	auto clock = origin;
+
+	printui::animation_status_struct status;
+	status.description = printui::animation_description{ printui::screen_space_rect{ 100, 50, 200, 40 }, printui::animation_type::slide, printui::animation_direction::left, 0.5f, true };
+	status.start_time = clock;
+	status.is_running = true;
+
+	REQUIRE(status.percent_complete(clock) == 0.0f);
+	clock += std::chrono::milliseconds(250);
+	REQUIRE(status.percent_complete(clock) == Approx(0.5f));
+	clock += std::chrono::milliseconds(500);
+	REQUIRE(status.percent_complete(clock) == 1.0f);
+
+	// sliding in from the left: the revealed part of the new state grows from the left edge
+	auto frame = printui::compose_animation_frame(status.description, status.percent_complete(origin + std::chrono::milliseconds(250)));
+	REQUIRE(frame.count == 2);
+	REQUIRE(frame.operations[0].layer == printui::animation_layer::previous_state);
+	REQUIRE(frame.operations[0].destination.left == 100.0f);
+	REQUIRE(frame.operations[0].destination.right == 300.0f);
+	REQUIRE(frame.operations[1].layer == printui::animation_layer::current_state);
+	REQUIRE(frame.operations[1].destination.left == 100.0f);
+	REQUIRE(frame.operations[1].destination.right == Approx(200.0f));
+	REQUIRE(frame.operations[1].source.left == Approx(200.0f));
+	REQUIRE(frame.operations[1].source.right == 300.0f);
+	REQUIRE(frame.operations[1].linear_filtering);
+
+	// fading out: the previous state is drawn over the current one with decreasing opacity
+	status.description.type = printui::animation_type::fade;
+	status.description.animate_in = false;
+	frame = printui::compose_animation_frame(status.description, 0.25f);
+	REQUIRE(frame.count == 2);
+	REQUIRE(frame.operations[0].layer == printui::animation_layer::current_state);
+	REQUIRE(frame.operations[1].layer == printui::animation_layer::previous_state);
+	REQUIRE(frame.operations[1].opacity == Approx(0.75f));
+
+	// a flip that has completed covers the whole region
+	status.description.type = printui::animation_type::flip;
+	status.description.direction = printui::animation_direction::top;
+	status.description.animate_in = true;
+	frame = printui::compose_animation_frame(status.description, 1.0f);
+	REQUIRE(frame.operations[1].destination.top == 50.0f);
+	REQUIRE(frame.operations[1].destination.bottom == Approx(90.0f));
+
+	status.description.type = printui::animation_type::none;
+	REQUIRE(printui::compose_animation_frame(status.description, 0.5f).count == 0);
+
+	status.description.duration_seconds = 0.0f;
+	REQUIRE(status.percent_complete(origin) == 1.0f);
+}
+
+TEST_CASE("device loss recovery", "[device_tests]") {
+	using printui::device_resource;
+	using printui::resource_action;
+
+	printui::device_resource_tracker tracker;
+
+	// nothing has been created yet, so a loss leaves everything to the regular creation path
+	tracker.device_lost();
+	REQUIRE(tracker.required_action(device_resource::icons) == resource_action::none);
+	REQUIRE(tracker.needs_capture(device_resource::icons) == false);
+
+	// drawn, but not yet read back: a loss now has to rasterize again
+	tracker.rasterized(device_resource::icons);
+	tracker.rasterized(device_resource::interactable_tags);
+	REQUIRE(tracker.needs_capture(device_resource::icons));
+	REQUIRE(tracker.required_action(device_resource::icons) == resource_action::none);
+
+	tracker.captured(device_resource::icons);
+	REQUIRE(tracker.needs_capture(device_resource::icons) == false);
+	REQUIRE(tracker.needs_capture(device_resource::interactable_tags));
+
+	tracker.device_lost();
+	REQUIRE(tracker.required_action(device_resource::icons) == resource_action::upload_from_cache);
+	REQUIRE(tracker.required_action(device_resource::interactable_tags) == resource_action::rebuild);
+	// a copy can't be captured from a device that is gone
+	REQUIRE(tracker.needs_capture(device_resource::interactable_tags) == false);
+
+	// the recovery: the icons are uploaded from their copies and the tags are drawn again
+	tracker.uploaded(device_resource::icons);
+	tracker.rasterized(device_resource::interactable_tags);
+	REQUIRE(tracker.required_action(device_resource::icons) == resource_action::none);
+	REQUIRE(tracker.required_action(device_resource::interactable_tags) == resource_action::none);
+	REQUIRE(tracker.needs_capture(device_resource::icons) == false);
+	REQUIRE(tracker.needs_capture(device_resource::interactable_tags));
+	tracker.captured(device_resource::interactable_tags);
+
+	// a new icon makes the existing copy incomplete
+	tracker.invalidate_cache(device_resource::icons);
+	tracker.device_lost();
+	REQUIRE(tracker.required_action(device_resource::icons) == resource_action::rebuild);
+	REQUIRE(tracker.required_action(device_resource::interactable_tags) == resource_action::upload_from_cache);
+}
+
+TEST_CASE("frame profiler", "[profiler_tests]") {
+	using namespace std::chrono;
+	printui::frame_profiler profiler;
+	auto t = steady_clock::time_point{} + hours(1);
+
+	// frames are only kept while enabled
+	profiler.begin_frame(t);
+	profiler.end_frame(t + microseconds(100));
+	REQUIRE(profiler.records_stored == 0);
+
+	profiler.enabled = true;
+	auto record = [&](uint32_t layout_us, uint32_t present_us) {
+		profiler.begin_frame(t);
+		profiler.record_stage(printui::frame_stage::layout, t, t + microseconds(layout_us));
+		profiler.record_stage(printui::frame_stage::present, t + microseconds(layout_us), t + microseconds(layout_us + present_us));
+		profiler.end_frame(t + microseconds(layout_us + present_us));
+		t += milliseconds(20);
+	};
+
+	// one more frame than the history holds: the oldest is overwritten
+	for(uint32_t i = 0; i <= printui::frame_profiler::history_size; ++i) {
+		record(i + 1, 10);
+	}
+	REQUIRE(profiler.records_stored == printui::frame_profiler::history_size);
+	REQUIRE(profiler.next_record == 1);
+	REQUIRE(profiler.history[0].stage_duration[size_t(printui::frame_stage::layout)] == printui::frame_profiler::history_size + 1);
+
+	// layout times are now 2 through 257
+	auto layout = profiler.stage_statistics(printui::frame_stage::layout);
+	REQUIRE(layout.samples == 256);
+	REQUIRE(layout.p50 == 130);
+	REQUIRE(layout.p95 == 245);
+	REQUIRE(layout.p99 == 255);
+	REQUIRE(layout.maximum == 257);
+	auto present = profiler.stage_statistics(printui::frame_stage::present);
+	REQUIRE(present.p50 == 10);
+	REQUIRE(present.maximum == 10);
+	REQUIRE(profiler.total_statistics().maximum == 267);
+	REQUIRE(profiler.stage_statistics(printui::frame_stage::composite).maximum == 0);
+
+	// the trace starts at the oldest frame that is still stored
+	profiler.clear();
+	REQUIRE(profiler.to_chrome_trace() == "{\"traceEvents\":[]}");
+	record(5, 3);
+	record(7, 2);
+	auto trace = profiler.to_chrome_trace();
+	REQUIRE(trace == "{\"traceEvents\":["
+		"{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":0,\"dur\":8,\"args\":{\"draw_calls\":0,\"rectangles\":0,\"text_draws\":0}},"
+		"{\"name\":\"layout\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":0,\"dur\":5},"
+		"{\"name\":\"present\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":5,\"dur\":3},"
+		"{\"name\":\"frame\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":20000,\"dur\":9,\"args\":{\"draw_calls\":0,\"rectangles\":0,\"text_draws\":0}},"
+		"{\"name\":\"layout\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":20000,\"dur\":7},"
+		"{\"name\":\"present\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":20007,\"dur\":2}"
+		"]}");
+
+	auto report = profiler.statistics_report();
+	REQUIRE(report.find("layout\tp50 7\tp95 7\tp99 7\tmax 7\n") != std::string::npos);
+	REQUIRE(report.find("frame\tp50 9") != std::string::npos);
+	REQUIRE(report.find("2 frames\n") != std::string::npos);
+}
+
+TEST_CASE("image comparison", "[golden_tests]") {
+	printui::rgba_image expected;
+	expected.width = 3;
+	expected.height = 2;
+	expected.pixels = { 0xFF102030, 0xFF102030, 0xFF102030, 0xFF405060, 0xFF405060, 0xFF405060 };
+
+	auto actual = expected;
+	REQUIRE(printui::compare_images(expected, actual, 0).matches());
+
+	actual.pixels[4] = 0xFF405063;
+	auto within = printui::compare_images(expected, actual, 3);
+	REQUIRE(within.matches());
+	REQUIRE(within.largest_channel_difference == 3);
+	auto beyond = printui::compare_images(expected, actual, 2);
+	REQUIRE(beyond.matches() == false);
+	REQUIRE(beyond.differing_pixels == 1);
+	REQUIRE(beyond.matches(1));
+
+	auto diff = printui::difference_image(expected, actual, 2);
+	REQUIRE(diff.width == 3);
+	REQUIRE(diff.height == 2);
+	REQUIRE(diff.pixels[4] == 0xFFFF0000);
+	REQUIRE(diff.pixels[0] == (0xFF000000 | (0x00102030 >> 2 & 0x003F3F3F)));
+
+	// pixels outside of either image count as differences in the diff, and a size change never matches
+	auto wider = expected;
+	wider.width = 4;
+	wider.pixels = { 0xFF102030, 0xFF102030, 0xFF102030, 0xFF000000, 0xFF405060, 0xFF405060, 0xFF405060, 0xFF000000 };
+	REQUIRE(printui::compare_images(expected, wider, 255).size_mismatch);
+	REQUIRE(printui::compare_images(expected, wider, 255).matches() == false);
+	auto wider_diff = printui::difference_image(expected, wider, 0);
+	REQUIRE(wider_diff.width == 4);
+	REQUIRE(wider_diff.pixels[3] == 0xFFFF0000);
+	REQUIRE(wider_diff.pixels[2] != 0xFFFF0000);
+}
+
+// goldens are stored as binary PAM files, with the channels in RGBA order
+std::optional<printui::rgba_image> read_golden(std::string const& file_name) {
+	std::ifstream in(file_name, std::ios::binary);
+	if(!in)
+		return std::nullopt;
+
+	printui::rgba_image result;
+	std::string token;
+	while(in >> token && token != "ENDHDR") {
+		if(token == "WIDTH")
+			in >> result.width;
+		else if(token == "HEIGHT")
+			in >> result.height;
+	}
+	in.get();
+	result.pixels.resize(size_t(result.width) * size_t(result.height));
+	for(auto& p : result.pixels) {
+		unsigned char c[4] = { 0, 0, 0, 0 };
+		in.read((char*)c, 4);
+		p = (uint32_t(c[3]) << 24) | (uint32_t(c[0]) << 16) | (uint32_t(c[1]) << 8) | uint32_t(c[2]);
+	}
+	if(!in)
+		return std::nullopt;
+	return result;
+}
+
+void write_golden(std::string const& file_name, printui::rgba_image const& img) {
+	std::ofstream out(file_name, std::ios::binary);
+	out << "P7\nWIDTH " << img.width << "\nHEIGHT " << img.height << "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n";
+	for(auto p : img.pixels) {
+		char const c[4] = { char(p >> 16), char(p >> 8), char(p), char(p >> 24) };
+		out.write(c, 4);
+	}
+}
+
+std::string golden_path(char const* name) {
+	std::string dir = __FILE__;
+	auto slash = dir.find_last_of("\\/");
+	dir = slash != std::string::npos ? dir.substr(0, slash + 1) : std::string();
+	return dir + "goldens/" + name;
+}
+
+// a missing golden fails the test unless PRINTUI_UPDATE_GOLDENS is set, in which case it is written
+void check_golden(char const* name, printui::rgba_image const& actual) {
+	auto file_name = golden_path(name);
+	auto expected = read_golden(file_name);
+	if(!expected) {
+		if(std::getenv("PRINTUI_UPDATE_GOLDENS")) {
+			write_golden(file_name, actual);
+			WARN("wrote missing golden " << file_name);
+			return;
+		}
+		FAIL("missing golden " << file_name);
+	}
+	auto comparison = printui::compare_images(*expected, actual, 0);
+	if(!comparison.matches())
+		write_golden(file_name + ".actual.pam", actual);
+	REQUIRE(comparison.size_mismatch == false);
+	REQUIRE(comparison.differing_pixels == 0);
+}
+
+TEST_CASE("compositor golden image", "[golden_tests]") {
+	// a layout that doesn't line up with the tiles, with skipped and overlapping backgrounds
+	auto rects = synthetic_layout(160, 80);
+	for(size_t i = 0; i < rects.size(); ++i) {
+		rects[i].x_position = uint16_t(rects[i].x_position + (i * 7) % 19);
+		rects[i].width = uint16_t(rects[i].width - (i * 11) % 37);
+	}
+	rects[1].display_flags |= printui::ui_rectangle::flag_skip_bg;
+	printui::ui_rectangle overlay;
+	overlay.x_position = 50;
+	overlay.y_position = 10;
+	overlay.width = 70;
+	overlay.height = 50;
+	overlay.background_index = 2;
+	rects.push_back(overlay);
+
+	std::vector<uint32_t> colors{ 0xFFEEEEEE, 0xFF202020, 0xFFCC3322 };
+	printui::tile_compositor compositor;
+	compositor.resize(160, 80);
+	printui::tile_bins bins;
+	bins.build(compositor.grid, rects);
+	compositor.render([&](printui::rgba_image& target, printui::screen_space_rect clip) {
+		printui::rasterize_rectangles(target, clip, rects, bins, colors);
+	}, 2);
+
+	check_golden("compositor_160x80.pam", compositor.present_buffer);
+}
+
+TEST_CASE("tile damage", "[compositor_tests]") {
+	printui::tile_grid grid;
+	grid.resize(3840, 2160);
+
+	REQUIRE(grid.columns == 60);
+	REQUIRE(grid.rows == 34);
+	REQUIRE(grid.dirty_count() == 60 * 34);
+
+	grid.clear_dirty();
+	auto previous = synthetic_layout(3840, 2160);
+	auto current = previous;
+	grid.mark_damage(previous, current);
+	REQUIRE(grid.dirty_count() == 0);
+
+	current[0].background_index = 2;
+	grid.mark_damage(previous, current);
+	REQUIRE(grid.dirty_count() == 2);
+	REQUIRE(grid.dirty[0] == 1);
+	REQUIRE(grid.dirty[1] == 1);
+}
+
+TEST_CASE("tile compositor 4k", "[.][compositor_benchmarks]") {
+	auto rects = synthetic_layout(3840, 2160);
+	std::vector<uint32_t> colors{ 0xFFEEEEEE, 0xFF202020, 0xFFCC3322 };
+	printui::tile_bins bins;
+	auto rasterize = [&](printui::rgba_image& target, printui::screen_space_rect clip) {
+		printui::rasterize_rectangles(target, clip, rects, bins, colors);
+	};
+
+	printui::tile_compositor compositor;
+	compositor.resize(3840, 2160);
+
+	BENCHMARK("full frame, 1 thread") {
+		compositor.grid.mark_all_dirty();
+		bins.build(compositor.grid, rects);
+		return compositor.render(rasterize, 1);
+	};
+	BENCHMARK("full frame, all threads") {
+		compositor.grid.mark_all_dirty();
+		bins.build(compositor.grid, rects);
+		return compositor.render(rasterize, std::thread::hardware_concurrency());
+	};
+	BENCHMARK("hover highlight") {
+		auto previous = rects;
+		rects[100].background_index = uint8_t((rects[100].background_index + 1) % 3);
+		compositor.grid.mark_damage(previous, rects);
+		bins.build(compositor.grid, rects);
+		return compositor.render(rasterize, std::thread::hardware_concurrency());
+	};
+}
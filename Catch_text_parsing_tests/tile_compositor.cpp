@@ -0,0 +1,181 @@
+#include "tile_compositor.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+namespace printui {
+	void tile_grid::resize(uint32_t w, uint32_t h) {
+		width = w;
+		height = h;
+		columns = (w + tile_size - 1) / tile_size;
+		rows = (h + tile_size - 1) / tile_size;
+		dirty.assign(size_t(columns) * size_t(rows), uint8_t(1));
+	}
+
+	void tile_grid::mark_dirty(screen_space_rect r) {
+		if(r.width <= 0 || r.height <= 0 || columns == 0 || rows == 0)
+			return;
+
+		auto left = std::max(r.x, 0);
+		auto top = std::max(r.y, 0);
+		auto right = std::min(r.x + r.width, int32_t(width));
+		auto bottom = std::min(r.y + r.height, int32_t(height));
+		if(left >= right || top >= bottom)
+			return;
+
+		for(uint32_t row = uint32_t(top) / tile_size; row <= uint32_t(bottom - 1) / tile_size; ++row) {
+			for(uint32_t col = uint32_t(left) / tile_size; col <= uint32_t(right - 1) / tile_size; ++col) {
+				dirty[size_t(row) * columns + col] = uint8_t(1);
+			}
+		}
+	}
+
+	void tile_grid::mark_all_dirty() {
+		std::fill(dirty.begin(), dirty.end(), uint8_t(1));
+	}
+
+	void tile_grid::clear_dirty() {
+		std::fill(dirty.begin(), dirty.end(), uint8_t(0));
+	}
+
+	void tile_grid::mark_damage(std::vector<ui_rectangle> const& previous, std::vector<ui_rectangle> const& current) {
+		auto same_appearance = [](ui_rectangle const& a, ui_rectangle const& b) {
+			return a.x_position == b.x_position && a.y_position == b.y_position
+				&& a.width == b.width && a.height == b.height
+				&& a.foreground_index == b.foreground_index && a.background_index == b.background_index
+				&& a.left_border == b.left_border && a.right_border == b.right_border
+				&& a.top_border == b.top_border && a.bottom_border == b.bottom_border
+				&& (a.display_flags & ~ui_rectangle::flag_needs_update) == (b.display_flags & ~ui_rectangle::flag_needs_update);
+		};
+
+		auto common = std::min(previous.size(), current.size());
+		for(size_t i = 0; i < common; ++i) {
+			if(!same_appearance(previous[i], current[i])) {
+				mark_dirty(previous[i]);
+				mark_dirty(current[i]);
+			} else if((current[i].display_flags & ui_rectangle::flag_needs_update) != 0) {
+				mark_dirty(current[i]);
+			}
+		}
+		for(size_t i = common; i < previous.size(); ++i) {
+			mark_dirty(previous[i]);
+		}
+		for(size_t i = common; i < current.size(); ++i) {
+			mark_dirty(current[i]);
+		}
+	}
+
+	uint32_t tile_grid::dirty_count() const {
+		return uint32_t(std::count(dirty.begin(), dirty.end(), uint8_t(1)));
+	}
+
+	screen_space_rect tile_grid::tile_rect(uint32_t index) const {
+		auto x = int32_t((index % columns) * tile_size);
+		auto y = int32_t((index / columns) * tile_size);
+		return screen_space_rect{ x, y, std::min(int32_t(tile_size), int32_t(width) - x), std::min(int32_t(tile_size), int32_t(height) - y) };
+	}
+
+	void tile_compositor::resize(uint32_t w, uint32_t h) {
+		grid.resize(w, h);
+		present_buffer.width = w;
+		present_buffer.height = h;
+		present_buffer.pixels.assign(size_t(w) * size_t(h), uint32_t(0));
+	}
+
+	uint32_t tile_compositor::render(rasterize_function const& rasterize_tile, uint32_t thread_count) {
+		std::vector<uint32_t> work;
+		for(uint32_t i = 0; i < uint32_t(grid.dirty.size()); ++i) {
+			if(grid.dirty[i] != 0)
+				work.push_back(i);
+		}
+		if(work.empty())
+			return 0;
+
+		// tiles don't overlap, so the workers can write into the present buffer without synchronization
+		std::atomic<uint32_t> next_tile{ 0 };
+		auto worker = [&]() {
+			for(uint32_t w = next_tile++; w < uint32_t(work.size()); w = next_tile++) {
+				rasterize_tile(present_buffer, grid.tile_rect(work[w]));
+			}
+		};
+
+		// the calling thread is one of the workers, so the pool holds the rest
+		auto const pool_size = std::max(thread_count, uint32_t(1)) - 1;
+		auto const helpers = std::min(pool_size, uint32_t(work.size()) - 1);
+		if(helpers != 0) {
+			if(!workers || worker_count != pool_size) {
+				workers = std::make_unique<background_queue>(pool_size);
+				worker_count = pool_size;
+			}
+			for(uint32_t i = 0; i < helpers; ++i) {
+				workers->submit(worker);
+			}
+		}
+		worker();
+		if(helpers != 0)
+			workers->wait_until_idle();
+
+		grid.clear_dirty();
+		return uint32_t(work.size());
+	}
+
+	void tile_bins::build(tile_grid const& grid, std::vector<ui_rectangle> const& rects) {
+		columns = grid.columns;
+		starts.assign(grid.dirty.size() + 1, uint32_t(0));
+
+		// calls fn with every dirty tile that a drawn rectangle reaches
+		auto for_each_tile = [&](ui_rectangle const& r, auto&& fn) {
+			if((r.display_flags & (ui_rectangle::flag_skip_bg | ui_rectangle::flag_overlay)) != 0)
+				return;
+			auto left = std::max(int32_t(r.x_position), 0);
+			auto top = std::max(int32_t(r.y_position), 0);
+			auto right = std::min(int32_t(r.x_position + r.width), int32_t(grid.width));
+			auto bottom = std::min(int32_t(r.y_position + r.height), int32_t(grid.height));
+			if(left >= right || top >= bottom)
+				return;
+			for(uint32_t row = uint32_t(top) / tile_grid::tile_size; row <= uint32_t(bottom - 1) / tile_grid::tile_size; ++row) {
+				for(uint32_t col = uint32_t(left) / tile_grid::tile_size; col <= uint32_t(right - 1) / tile_grid::tile_size; ++col) {
+					auto tile = size_t(row) * columns + col;
+					if(grid.dirty[tile] != 0)
+						fn(tile);
+				}
+			}
+		};
+
+		// counting sort: size each tile's bin, turn the sizes into starts, then fill the bins in drawing order
+		for(auto const& r : rects) {
+			for_each_tile(r, [&](size_t tile) { ++starts[tile + 1]; });
+		}
+		for(size_t i = 1; i < starts.size(); ++i) {
+			starts[i] += starts[i - 1];
+		}
+		indices.resize(starts.back());
+		std::vector<uint32_t> filled(starts.begin(), starts.end() - 1);
+		for(uint32_t i = 0; i < uint32_t(rects.size()); ++i) {
+			for_each_tile(rects[i], [&](size_t tile) { indices[filled[tile]++] = i; });
+		}
+	}
+
+	void rasterize_rectangles(rgba_image& target, screen_space_rect clip, std::vector<ui_rectangle> const& rects, tile_bins const& bins, std::vector<uint32_t> const& brush_colors) {
+		auto tile = size_t(clip.y / int32_t(tile_grid::tile_size)) * bins.columns + size_t(clip.x / int32_t(tile_grid::tile_size));
+		if(tile + 1 >= bins.starts.size())
+			return;
+
+		for(auto i = bins.starts[tile]; i < bins.starts[tile + 1]; ++i) {
+			auto const& r = rects[bins.indices[i]];
+
+			auto left = std::max(int32_t(r.x_position), clip.x);
+			auto top = std::max(int32_t(r.y_position), clip.y);
+			auto right = std::min(int32_t(r.x_position + r.width), std::min(clip.x + clip.width, int32_t(target.width)));
+			auto bottom = std::min(int32_t(r.y_position + r.height), std::min(clip.y + clip.height, int32_t(target.height)));
+			if(left >= right || top >= bottom)
+				continue;
+
+			auto color = r.background_index < brush_colors.size() ? brush_colors[r.background_index] : uint32_t(0xFF000000);
+			for(int32_t y = top; y < bottom; ++y) {
+				auto row = target.pixels.data() + size_t(y) * target.width;
+				std::fill(row + left, row + right, color);
+			}
+		}
+	}
+}
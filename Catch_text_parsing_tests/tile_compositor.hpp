@@ -0,0 +1,63 @@
+#ifndef PRINTUI_TILE_COMPOSITOR_HEADER
+#define PRINTUI_TILE_COMPOSITOR_HEADER
+
+// the cpu tile compositor; there is no cpu rendering backend for it to serve yet, so it is only built into the tests
+// and benchmarks of this project, where its damage tracking, binning and rasterization are exercised
+
+#include "../display_testbed/printui_datatypes.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace printui {
+	// Splits a window into fixed size tiles with a dirty bit each. Damage is derived by comparing the ui_rectangles
+	// of consecutive frames, so frames where only a highlight or the caret changes touch very few tiles.
+	struct tile_grid {
+		constexpr static uint32_t tile_size = 64;
+
+		uint32_t width = 0; // in pixels
+		uint32_t height = 0;
+		uint32_t columns = 0;
+		uint32_t rows = 0;
+		std::vector<uint8_t> dirty;
+
+		void resize(uint32_t w, uint32_t h);
+		void mark_dirty(screen_space_rect r);
+		void mark_all_dirty();
+		void clear_dirty();
+		void mark_damage(std::vector<ui_rectangle> const& previous, std::vector<ui_rectangle> const& current);
+		uint32_t dirty_count() const;
+		screen_space_rect tile_rect(uint32_t index) const;
+	};
+
+	// Retained cpu compositor: the present buffer doubles as the cached raster of every tile, so only dirty tiles are
+	// rasterized again, in parallel. The rasterizer is handed the whole buffer but must only write inside the tile.
+	struct tile_compositor {
+		using rasterize_function = std::function<void(rgba_image& target, screen_space_rect tile)>;
+
+		tile_grid grid;
+		rgba_image present_buffer;
+		// started by the first render that asks for more than one thread, and kept for the frames after it
+		std::unique_ptr<background_queue> workers;
+		uint32_t worker_count = 0;
+
+		void resize(uint32_t w, uint32_t h);
+		uint32_t render(rasterize_function const& rasterize_tile, uint32_t thread_count); // returns the number of tiles rasterized
+	};
+
+	// The rectangles that reach each dirty tile, in drawing order. Built once per frame, before rendering, so that
+	// rasterizing a tile visits only the rectangles overlapping it rather than the whole list.
+	struct tile_bins {
+		uint32_t columns = 0;
+		std::vector<uint32_t> starts; // into indices, one per tile plus one past the end
+		std::vector<uint32_t> indices;
+
+		void build(tile_grid const& grid, std::vector<ui_rectangle> const& rects);
+	};
+
+	// flat color rasterization of ui_rectangle backgrounds, clipped to a single tile of the grid the bins were built for
+	void rasterize_rectangles(rgba_image& target, screen_space_rect clip, std::vector<ui_rectangle> const& rects, tile_bins const& bins, std::vector<uint32_t> const& brush_colors);
+}
+
+#endif
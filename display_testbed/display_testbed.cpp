@@ -1,4 +1,5 @@
 ﻿#include "printui_datatypes.hpp"
+#include "printui_text_data_definitions.hpp"
 #include "printui_text_definitions.hpp"
 #include "printui_accessibility_definitions.hpp"
 #include "printui_files_definitions.hpp"
@@ -6,14 +7,28 @@
 #include "printui_windows_definitions.hpp"
 #include "printui_main_header.hpp"
 #include "printui_accessibility.cpp"
+#include "printui_animation.cpp"
+#include "printui_arrangement_cache.cpp"
+#include "printui_background_queue.cpp"
 #include "printui_common_controls.cpp"
+#include "printui_device_resources.cpp"
+#include "printui_editable_text.cpp"
 #include "printui_files.cpp"
+#include "printui_golden_images.cpp"
+#include "printui_image_compare.cpp"
 #include "printui_interactables.cpp"
 #include "printui_layout.cpp"
 #include "printui_parsing.cpp"
+#include "printui_profiling.cpp"
 #include "printui_rendering.cpp"
 #include "printui_settings_controls.cpp"
 #include "printui_text.cpp"
+#include "printui_text_bundle.cpp"
+#include "printui_text_cache.cpp"
+#include "printui_text_data.cpp"
+#include "printui_text_numbers.cpp"
+#include "printui_text_plurals.cpp"
+#include "printui_text_segmentation.cpp"
 #include "printui_utility.cpp"
 #include "printui_window_controls.cpp"
 #include "printui_window_functions.cpp"
@@ -92,17 +107,41 @@ int WINAPI wWinMain(
 ) {
 	HeapSetInformation(NULL, HeapEnableTerminationOnCorruption, NULL, 0);
 
+	// display_testbed.exe --golden-images <directory> renders the golden image scenes instead of running interactively;
+	// the exit code is the number of checks that did not pass
+	std::optional<printui::golden_image_options> golden_options;
+	{
+		int argc = 0;
+		LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+		if(argv) {
+			golden_options = printui::golden_image_options_from_arguments(argc, argv);
+			LocalFree(argv);
+		}
+	}
+
+	int exit_code = 0;
 	if(SUCCEEDED(CoInitializeEx(NULL, COINIT_APARTMENTTHREADED))) {
 		{
 			printui::window_data app(true, true, true);
 
 			app.text_services_interface.start_text_services();
 			app.create_window();
-			app.message_loop();
+			if(golden_options) {
+				// let the window finish sizing itself before the first capture
+				MSG msg;
+				while(PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
+					TranslateMessage(&msg);
+					DispatchMessage(&msg);
+				}
+				exit_code = int(printui::run_golden_image_check(app, *golden_options));
+				DestroyWindow((HWND)(app.window_interface.get_hwnd()));
+			} else {
+				app.message_loop();
+			}
 			app.text_services_interface.end_text_services();
 
 		}
 		CoUninitialize();
 	}
-	return 0;
+	return exit_code;
 }
@@ -0,0 +1,505 @@
+// writes printui_plural_rules.hpp, the cardinal and ordinal plural classifiers used by printui_text_plurals.cpp, and
+// ../Catch_text_parsing_tests/plural_samples.hpp, the categories icu selects for a set of sample numbers in every locale
+// it is not part of any project; build it on its own against icu4c, for example
+//     g++ -std=c++17 plural_rule_generator.cpp -licui18n -licuuc -o plural_rule_generator
+// (the icu that ships with windows only exposes the c api, which can select a category but not return the rules)
+// and run it from this directory after updating icu to the cldr version the rules should follow
+
+#include <unicode/locid.h>
+#include <unicode/numberformatter.h>
+#include <unicode/plurrule.h>
+#include <unicode/strenum.h>
+#include <unicode/ulocdata.h>
+#include <unicode/uversion.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+	// the operands of a plural rule, in terms of the arguments of the generated classifiers
+	enum class operand_value {
+		integer, // the value of the argument of the same name
+		fraction_without_zeros, // t
+		digits_without_zeros, // w
+		whole_number, // n: the integer digits, and only a whole number when there are no fraction digits
+		zero // operands that are always 0 for the numbers the classifiers are given
+	};
+
+	struct relation {
+		std::string operand;
+		int64_t mod = 0;
+		bool negated = false;
+		bool within = false;
+		std::vector<std::pair<int64_t, int64_t>> ranges;
+	};
+	using and_condition = std::vector<relation>;
+	using condition = std::vector<and_condition>;
+
+	struct rule {
+		std::string keyword;
+		condition cond;
+	};
+
+	std::vector<std::string> split_words(std::string const& text) {
+		std::vector<std::string> result;
+		std::string current;
+		for(auto c : text) {
+			if(c == ' ' || c == ',') {
+				if(!current.empty())
+					result.push_back(current);
+				current.clear();
+			} else {
+				current += c;
+			}
+		}
+		if(!current.empty())
+			result.push_back(current);
+		return result;
+	}
+
+	// parses the normalized form that icu returns from getRules, such as
+	// "one: v  in 0..0 and i mod 10 in 1..1 and i mod 100 not in 11..11; other: "
+	bool parse_rules(std::string const& text, std::vector<rule>& result) {
+		size_t start = 0;
+		while(start < text.length()) {
+			auto end = text.find(';', start);
+			if(end == std::string::npos)
+				end = text.length();
+			auto part = text.substr(start, end - start);
+			start = end + 1;
+
+			auto colon = part.find(':');
+			if(colon == std::string::npos)
+				return false;
+			rule r;
+			auto words = split_words(part.substr(0, colon));
+			if(words.size() != 1)
+				return false;
+			r.keyword = words[0];
+
+			words = split_words(part.substr(colon + 1));
+			r.cond.emplace_back();
+			for(size_t i = 0; i < words.size();) {
+				relation rel;
+				rel.operand = words[i++];
+				if(i < words.size() && (words[i] == "mod" || words[i] == "%")) {
+					rel.mod = std::stoll(words[i + 1]);
+					i += 2;
+				}
+				if(i < words.size() && words[i] == "not") {
+					rel.negated = true;
+					++i;
+				}
+				if(i >= words.size())
+					return false;
+				if(words[i] == "within")
+					rel.within = true;
+				else if(words[i] != "in")
+					return false;
+				++i;
+				for(; i < words.size() && words[i] != "and" && words[i] != "or"; ++i) {
+					auto dots = words[i].find("..");
+					if(dots == std::string::npos)
+						rel.ranges.emplace_back(std::stoll(words[i]), std::stoll(words[i]));
+					else
+						rel.ranges.emplace_back(std::stoll(words[i].substr(0, dots)), std::stoll(words[i].substr(dots + 2)));
+				}
+				r.cond.back().push_back(rel);
+				if(i < words.size()) {
+					if(words[i] == "or")
+						r.cond.emplace_back();
+					++i;
+				}
+			}
+			if(r.keyword == "other")
+				r.cond.clear();
+			result.push_back(r);
+		}
+		return true;
+	}
+
+	std::string range_test(std::string const& value, relation const& rel, bool whole_number) {
+		std::string result;
+		for(auto& [low, high] : rel.ranges) {
+			if(!result.empty())
+				result += " || ";
+			if(low == high)
+				result += value + " == " + std::to_string(low);
+			else if(whole_number && rel.within)
+				result += "(" + value + " >= " + std::to_string(low) + " && (" + value + " < " + std::to_string(high) + " || (" + value + " == " + std::to_string(high) + " && f == 0)))";
+			else
+				result += "(" + value + " >= " + std::to_string(low) + " && " + value + " <= " + std::to_string(high) + ")";
+		}
+		if(rel.ranges.size() > 1)
+			result = "(" + result + ")";
+		return result;
+	}
+
+	bool fully_parenthesized(std::string const& code) {
+		if(code.empty() || code.front() != '(')
+			return false;
+		int32_t depth = 0;
+		for(size_t i = 0; i < code.length(); ++i) {
+			depth += code[i] == '(' ? 1 : (code[i] == ')' ? -1 : 0);
+			if(depth == 0)
+				return i + 1 == code.length();
+		}
+		return false;
+	}
+
+	// the rule as it is written in the cldr data, such as "v = 0 and i % 10 = 2..4 and i % 100 != 12..14"
+	std::string describe(condition const& cond) {
+		std::string result;
+		for(auto& group : cond) {
+			if(!result.empty())
+				result += " or ";
+			std::string joined;
+			for(auto& rel : group) {
+				if(!joined.empty())
+					joined += " and ";
+				joined += rel.operand;
+				if(rel.mod != 0)
+					joined += " % " + std::to_string(rel.mod);
+				if(rel.within)
+					joined += rel.negated ? " not within " : " within ";
+				else
+					joined += rel.negated ? " != " : " = ";
+				for(size_t i = 0; i < rel.ranges.size(); ++i) {
+					joined += i != 0 ? "," : "";
+					joined += std::to_string(rel.ranges[i].first);
+					if(rel.ranges[i].second != rel.ranges[i].first)
+						joined += ".." + std::to_string(rel.ranges[i].second);
+				}
+			}
+			result += joined;
+		}
+		return result;
+	}
+
+	struct rule_kind {
+		char const* name;
+		char const* signature;
+		char const* prefix; // of the generated category constants
+		std::map<std::string, operand_value> operands;
+	};
+
+	// the operands a relation reads, or nothing if its result is known without any
+	struct compiled_relation {
+		bool constant = false;
+		bool value = false;
+		std::string code;
+		std::vector<std::string> uses;
+	};
+
+	compiled_relation compile_relation(relation const& rel, rule_kind const& kind) {
+		compiled_relation result;
+		auto found = kind.operands.find(rel.operand);
+		auto type = found != kind.operands.end() ? found->second : operand_value::zero;
+		if(type == operand_value::zero) {
+			int64_t value = 0;
+			bool in_range = false;
+			for(auto& [low, high] : rel.ranges) {
+				in_range = in_range || (value >= low && value <= high);
+			}
+			result.constant = true;
+			result.value = in_range != rel.negated;
+			return result;
+		}
+
+		// n is the integer digits whenever it is a whole number
+		std::string name = rel.operand == "n" ? "i" : rel.operand;
+		if(type == operand_value::whole_number)
+			result.uses = { "i", "f" };
+		else if(type == operand_value::digits_without_zeros)
+			result.uses = { "f", "v", "w" };
+		else if(type == operand_value::fraction_without_zeros)
+			result.uses = { "f", "t" };
+		else
+			result.uses = { name };
+
+		auto value = rel.mod != 0 ? name + " % " + std::to_string(rel.mod) : name;
+		auto test = range_test(value, rel, type == operand_value::whole_number);
+		if(type == operand_value::whole_number && !rel.within)
+			test = "f == 0 && " + test;
+		if(rel.negated && type != operand_value::whole_number && rel.ranges.size() == 1 && rel.ranges[0].first == rel.ranges[0].second)
+			result.code = value + " != " + std::to_string(rel.ranges[0].first);
+		else if(rel.negated)
+			result.code = fully_parenthesized(test) ? "!" + test : "!(" + test + ")";
+		else
+			result.code = test;
+		return result;
+	}
+
+	// the condition as a c++ expression, or "true" / "false" when it doesn't depend on the number
+	std::string compile_condition(condition const& cond, rule_kind const& kind, std::vector<std::string>& uses) {
+		std::vector<std::string> groups;
+		for(auto& group : cond) {
+			std::vector<std::string> terms;
+			std::vector<std::string> group_uses;
+			bool never = false;
+			for(auto& rel : group) {
+				auto c = compile_relation(rel, kind);
+				if(c.constant) {
+					never = never || !c.value;
+					continue;
+				}
+				terms.push_back(c.code);
+				group_uses.insert(group_uses.end(), c.uses.begin(), c.uses.end());
+			}
+			if(never)
+				continue;
+			if(terms.empty())
+				return "true";
+			uses.insert(uses.end(), group_uses.begin(), group_uses.end());
+			std::string joined;
+			for(auto& t : terms) {
+				if(!joined.empty())
+					joined += " && ";
+				joined += terms.size() > 1 && t.find("||") != std::string::npos && t[0] != '(' && t[0] != '!' ? "(" + t + ")" : t;
+			}
+			groups.push_back(joined);
+		}
+		if(groups.empty())
+			return "false";
+		std::string result;
+		for(auto& g : groups) {
+			if(!result.empty())
+				result += " || ";
+			result += groups.size() > 1 && g.find("&&") != std::string::npos ? "(" + g + ")" : g;
+		}
+		return result;
+	}
+
+	struct rule_set {
+		std::string function_name;
+		std::string body;
+		std::vector<std::string> locales;
+	};
+
+	// the generated function, or an empty string if every number has the other category
+	std::string compile_rule_set(std::vector<rule> const& rules, rule_kind const& kind, std::string const& function_name) {
+		std::vector<std::string> uses;
+		std::string body;
+		bool any = false;
+		for(auto& r : rules) {
+			if(r.keyword == "other")
+				continue;
+			auto test = compile_condition(r.cond, kind, uses);
+			if(test == "false")
+				continue;
+			if(fully_parenthesized(test))
+				test = test.substr(1, test.length() - 2);
+			any = true;
+			body += "\t\t// " + r.keyword + ": " + describe(r.cond) + "\n";
+			body += "\t\tif(" + test + ")\n\t\t\treturn text::" + kind.prefix + r.keyword + ";\n";
+		}
+		if(!any)
+			return std::string();
+		body += "\t\treturn text::" + std::string(kind.prefix) + "other;\n";
+
+		auto used = [&](char const* name) { return std::find(uses.begin(), uses.end(), name) != uses.end(); };
+		std::string preamble;
+		if(used("i"))
+			preamble += "\t\ti = std::abs(i);\n";
+		if(used("t"))
+			preamble += "\t\tauto const t = fraction_without_zeros(f);\n";
+		if(used("w"))
+			preamble += "\t\tauto const w = digits_without_zeros(f, v);\n";
+
+		std::string signature = kind.signature;
+		for(auto name : { "i", "f", "v" }) {
+			auto at = signature.find(std::string(" ") + name);
+			if(at != std::string::npos && !used(name))
+				signature.erase(at + 1, 1);
+		}
+		return "\tinline attribute_type " + function_name + "(" + signature + ") {\n" + preamble + body + "\t}\n";
+	}
+
+	std::string locale_tag(std::string name) {
+		std::replace(name.begin(), name.end(), '_', '-');
+		return name;
+	}
+	std::string identifier_of(std::string name) {
+		std::replace(name.begin(), name.end(), '-', '_');
+		return name;
+	}
+
+	std::string rules_of(icu::Locale const& locale, UPluralType type) {
+		UErrorCode status = U_ZERO_ERROR;
+		std::unique_ptr<icu::PluralRules> rules(icu::PluralRules::forLocale(locale, type, status));
+		std::string result;
+		if(U_SUCCESS(status))
+			rules->getRules().toUTF8String(result);
+		return result;
+	}
+
+	struct sample_input {
+		int64_t i;
+		int64_t f;
+		int32_t v;
+	};
+
+	// whole numbers around the boundaries the rules test, and fractions with one and two visible digits
+	std::vector<sample_input> sample_inputs() {
+		std::vector<sample_input> result;
+		for(int64_t i = 0; i <= 25; ++i)
+			result.push_back(sample_input{ i, 0, 0 });
+		for(int64_t i : { 31, 32, 40, 41, 50, 61, 71, 80, 81, 99, 100, 101, 102, 103, 111, 112, 113, 200, 1000, 1001, 10000, 100000, 1000000, 2000000, 10000000 })
+			result.push_back(sample_input{ i, 0, 0 });
+		for(auto s : { sample_input{ 0, 0, 1 }, sample_input{ 0, 1, 1 }, sample_input{ 0, 5, 1 }, sample_input{ 1, 0, 1 }, sample_input{ 1, 1, 1 },
+			sample_input{ 1, 5, 1 }, sample_input{ 2, 0, 1 }, sample_input{ 2, 1, 1 }, sample_input{ 2, 5, 1 }, sample_input{ 3, 0, 1 },
+			sample_input{ 5, 0, 1 }, sample_input{ 11, 1, 1 }, sample_input{ 21, 1, 1 }, sample_input{ 1000000, 0, 1 },
+			sample_input{ 0, 1, 2 }, sample_input{ 0, 10, 2 }, sample_input{ 0, 11, 2 }, sample_input{ 1, 0, 2 }, sample_input{ 1, 1, 2 },
+			sample_input{ 1, 10, 2 }, sample_input{ 1, 11, 2 }, sample_input{ 2, 21, 2 } }) {
+			result.push_back(s);
+		}
+		return result;
+	}
+
+	char category_letter(std::string const& keyword) {
+		if(keyword == "zero") return 'z';
+		if(keyword == "one") return 'o';
+		if(keyword == "two") return 't';
+		if(keyword == "few") return 'f';
+		if(keyword == "many") return 'm';
+		return 'x';
+	}
+
+	// the category icu selects for the number as it would be formatted, with exactly v fraction digits
+	char select_category(icu::PluralRules const& rules, sample_input const& s) {
+		UErrorCode status = U_ZERO_ERROR;
+		std::string digits = std::to_string(s.i);
+		if(s.v != 0) {
+			auto fraction = std::to_string(s.f);
+			digits += "." + std::string(size_t(s.v) - fraction.length(), '0') + fraction;
+		}
+		auto formatted = icu::number::NumberFormatter::withLocale(icu::Locale::getRoot())
+			.precision(icu::number::Precision::fixedFraction(s.v))
+			.formatDecimal(icu::StringPiece(digits.c_str()), status);
+		std::string keyword;
+		rules.select(formatted, status).toUTF8String(keyword);
+		return U_SUCCESS(status) ? category_letter(keyword) : '?';
+	}
+}
+
+int main() {
+	rule_kind const cardinal{ "cardinal", "int64_t i, int64_t f, int32_t v", "", {
+		{ "i", operand_value::integer }, { "f", operand_value::integer }, { "v", operand_value::integer },
+		{ "t", operand_value::fraction_without_zeros }, { "w", operand_value::digits_without_zeros }, { "n", operand_value::whole_number } } };
+	// ordinals are only given whole numbers
+	rule_kind const ordinal{ "ordinal", "int64_t i", "ord_", {
+		{ "i", operand_value::integer }, { "n", operand_value::integer } } };
+
+	UErrorCode status = U_ZERO_ERROR;
+	std::unique_ptr<icu::StringEnumeration> available(icu::PluralRules::getAvailableLocales(status));
+	std::vector<std::string> locales;
+	while(char const* name = available->next(nullptr, status)) {
+		if(std::string(name) != "root")
+			locales.push_back(name);
+	}
+	std::sort(locales.begin(), locales.end(), [](std::string const& a, std::string const& b) { return locale_tag(a) < locale_tag(b); });
+
+	std::string functions;
+	std::string tables;
+	for(auto kind : { &cardinal, &ordinal }) {
+		auto type = kind == &cardinal ? UPLURAL_TYPE_CARDINAL : UPLURAL_TYPE_ORDINAL;
+		std::map<std::string, rule_set> by_rules;
+		std::vector<std::pair<std::string, std::string>> table;
+		for(auto& name : locales) {
+			auto text = rules_of(icu::Locale(name.c_str()), type);
+			// a locale with a region falls back to its language, so it only needs an entry if its rules differ
+			auto separator = name.find('_');
+			if(separator != std::string::npos && rules_of(icu::Locale(name.substr(0, separator).c_str()), type) == text)
+				continue;
+
+			std::vector<rule> rules;
+			if(!parse_rules(text, rules)) {
+				fprintf(stderr, "could not parse the %s rules of %s: %s\n", kind->name, name.c_str(), text.c_str());
+				return 1;
+			}
+			auto found = by_rules.find(text);
+			if(found == by_rules.end()) {
+				auto function_name = std::string(kind->name) + "_" + identifier_of(name);
+				auto body = compile_rule_set(rules, *kind, function_name);
+				found = by_rules.emplace(text, rule_set{ function_name, body, {} }).first;
+				functions += body.empty() ? std::string() : "\n" + body;
+			}
+			if(!found->second.body.empty())
+				table.emplace_back(locale_tag(name), found->second.function_name);
+		}
+
+		tables += "\n\tinline constexpr " + std::string(kind->name) + "_rule " + kind->name + "_rules[" + std::to_string(table.size()) + "] = {\n";
+		for(auto& [locale, fn] : table) {
+			tables += "\t\t{ L\"" + locale + "\", " + fn + " },\n";
+		}
+		tables += "\t};\n";
+		fprintf(stdout, "%zu %s locales, %zu distinct rules\n", table.size(), kind->name, by_rules.size());
+	}
+
+	UVersionInfo cldr;
+	ulocdata_getCLDRVersion(cldr, &status);
+
+	FILE* f = fopen("printui_plural_rules.hpp", "w");
+	if(!f) {
+		fprintf(stderr, "could not open printui_plural_rules.hpp\n");
+		return 1;
+	}
+	fprintf(f, "#ifndef PRINTUI_PLURAL_RULES_HEADER\n#define PRINTUI_PLURAL_RULES_HEADER\n\n");
+	fprintf(f, "// generated by plural_rule_generator.cpp from cldr %u (icu %s); do not edit\n\n", cldr[0], U_ICU_VERSION);
+	fprintf(f, "#include \"printui_text_data_definitions.hpp\"\n\n#include <cstdlib>\n#include <string_view>\n\n");
+	fprintf(f, "namespace printui::text::plural_rules {\n");
+	fprintf(f, "\t// a number is given as its integer digits i, its visible fraction digits f as an integer, and their count v\n");
+	fprintf(f, "\tinline int64_t fraction_without_zeros(int64_t f) {\n\t\twhile(f != 0 && f %% 10 == 0)\n\t\t\tf /= 10;\n\t\treturn f;\n\t}\n");
+	fprintf(f, "\tinline int32_t digits_without_zeros(int64_t f, int32_t v) {\n\t\tif(f == 0)\n\t\t\treturn 0;\n");
+	fprintf(f, "\t\twhile(f %% 10 == 0) {\n\t\t\tf /= 10;\n\t\t\t--v;\n\t\t}\n\t\treturn v;\n\t}\n");
+	fputs(functions.c_str(), f);
+	fprintf(f, "\n\tstruct cardinal_rule {\n\t\tstd::wstring_view locale;\n\t\tcardinal_plural_fn fn;\n\t};\n");
+	fprintf(f, "\tstruct ordinal_rule {\n\t\tstd::wstring_view locale;\n\t\tordinal_plural_fn fn;\n\t};\n");
+	fprintf(f, "\n\t// sorted by locale; locales not listed have only the other category\n");
+	fputs(tables.c_str(), f);
+	fprintf(f, "}\n\n#endif\n");
+	fclose(f);
+
+	auto inputs = sample_inputs();
+	FILE* s = fopen("../Catch_text_parsing_tests/plural_samples.hpp", "w");
+	if(!s) {
+		fprintf(stderr, "could not open ../Catch_text_parsing_tests/plural_samples.hpp\n");
+		return 1;
+	}
+	fprintf(s, "// generated by display_testbed/plural_rule_generator.cpp from cldr %u (icu %s); do not edit\n\n", cldr[0], U_ICU_VERSION);
+	fprintf(s, "struct plural_sample_input {\n\tint64_t i;\n\tint64_t f;\n\tint32_t v;\n};\n");
+	fprintf(s, "inline constexpr plural_sample_input plural_sample_inputs[] = {");
+	for(size_t i = 0; i < inputs.size(); ++i) {
+		fprintf(s, "%s{ %lld, %lld, %d },", i % 8 == 0 ? "\n\t" : " ", (long long)inputs[i].i, (long long)inputs[i].f, inputs[i].v);
+	}
+	fprintf(s, "\n};\n\n");
+	fprintf(s, "// the category icu selects for each input, as z(ero), o(ne), t(wo), f(ew), m(any) or x for other;\n");
+	fprintf(s, "// ordinals are only given the inputs without fraction digits\n");
+	fprintf(s, "struct plural_samples {\n\tchar const* locale;\n\tchar const* cardinal;\n\tchar const* ordinal;\n};\n");
+	fprintf(s, "inline constexpr plural_samples plural_sample_categories[] = {\n");
+	for(auto& name : locales) {
+		std::string cardinal_letters;
+		std::string ordinal_letters;
+		std::unique_ptr<icu::PluralRules> cardinal_rules(icu::PluralRules::forLocale(icu::Locale(name.c_str()), UPLURAL_TYPE_CARDINAL, status));
+		std::unique_ptr<icu::PluralRules> ordinal_rules(icu::PluralRules::forLocale(icu::Locale(name.c_str()), UPLURAL_TYPE_ORDINAL, status));
+		if(U_FAILURE(status)) {
+			fprintf(stderr, "could not load the rules of %s\n", name.c_str());
+			return 1;
+		}
+		for(auto& in : inputs) {
+			cardinal_letters += select_category(*cardinal_rules, in);
+			if(in.v == 0)
+				ordinal_letters += select_category(*ordinal_rules, in);
+		}
+		fprintf(s, "\t{ \"%s\", \"%s\", \"%s\" },\n", locale_tag(name).c_str(), cardinal_letters.c_str(), ordinal_letters.c_str());
+	}
+	fprintf(s, "};\n");
+	fclose(s);
+
+	return 0;
+}
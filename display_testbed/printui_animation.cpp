@@ -0,0 +1,92 @@
+#include "printui_datatypes.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace printui {
+	float animation_status_struct::percent_complete(std::chrono::time_point<std::chrono::steady_clock> now) const {
+		auto duration = now - start_time;
+		auto in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
+
+		if(description.duration_seconds <= 0.0f)
+			return 1.0f;
+		return std::clamp(float(in_ms.count()) / (1000.0f * description.duration_seconds), 0.0f, 1.0f);
+	}
+
+	animation_frame compose_animation_frame(animation_description const& description, float percent_complete) {
+		animation_frame result;
+
+		auto const& r = description.animated_region;
+		animation_rect const full_region{ float(r.x), float(r.y), float(r.x + r.width), float(r.y + r.height) };
+
+		// the layer that is being revealed (animate in) or hidden (animate out) moves over the other one
+		auto const base_layer = description.animate_in ? animation_layer::previous_state : animation_layer::current_state;
+		auto const moving_layer = description.animate_in ? animation_layer::current_state : animation_layer::previous_state;
+
+		// fraction of the moving layer that is still visible
+		float const visible = description.animate_in ? percent_complete : 1.0f - percent_complete;
+
+		result.operations[0] = animation_draw_op{ full_region, full_region, 1.0f, base_layer, false };
+		result.count = 1;
+
+		auto& moving = result.operations[1];
+		moving.layer = moving_layer;
+		moving.destination = full_region;
+		moving.source = full_region;
+
+		switch(description.type) {
+			case animation_type::fade:
+				moving.opacity = visible;
+				result.count = 2;
+				break;
+			case animation_type::slide:
+				moving.linear_filtering = true;
+				switch(description.direction) {
+					case animation_direction::bottom:
+						moving.destination.top = float(r.y) + (1.0f - visible) * r.height;
+						moving.source.bottom = float(r.y) + visible * r.height;
+						break;
+					case animation_direction::top:
+						moving.destination.bottom = float(r.y) + visible * r.height;
+						moving.source.top = float(r.y) + (1.0f - visible) * r.height;
+						break;
+					case animation_direction::right:
+						moving.destination.left = float(r.x) + (1.0f - visible) * r.width;
+						moving.source.right = float(r.x) + visible * r.width;
+						break;
+					case animation_direction::left:
+						moving.destination.right = float(r.x) + visible * r.width;
+						moving.source.left = float(r.x) + (1.0f - visible) * r.width;
+						break;
+				}
+				result.count = 2;
+				break;
+			case animation_type::flip:
+			{
+				float extent = std::cos((1.0f - visible) * 3.14159f / 2.0f);
+				moving.linear_filtering = true;
+				switch(description.direction) {
+					case animation_direction::bottom:
+						moving.destination.top = float(r.y) + (1.0f - extent) * r.height;
+						break;
+					case animation_direction::top:
+						moving.destination.bottom = float(r.y) + extent * r.height;
+						break;
+					case animation_direction::left:
+						moving.destination.right = float(r.x) + extent * r.width;
+						break;
+					case animation_direction::right:
+						moving.destination.left = float(r.x) + (1.0f - extent) * r.width;
+						break;
+				}
+				result.count = 2;
+				break;
+			}
+			case animation_type::none:
+				result.count = 0;
+				break;
+		}
+
+		return result;
+	}
+}
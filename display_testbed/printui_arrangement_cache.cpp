@@ -0,0 +1,175 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace printui::text {
+	namespace {
+		uint8_t format_marker_value(format_marker const& m) {
+			if(std::holds_alternative<font_id>(m.format))
+				return std::get<font_id>(m.format).id;
+			else if(std::holds_alternative<parameter_id>(m.format))
+				return std::get<parameter_id>(m.format).id;
+			else if(std::holds_alternative<substitution_mark>(m.format))
+				return std::get<substitution_mark>(m.format).id;
+			else if(std::holds_alternative<extra_formatting>(m.format))
+				return uint8_t(std::get<extra_formatting>(m.format));
+			return 0;
+		}
+
+		bool same_formatting(std::vector<format_marker> const& a, std::vector<format_marker> const* b) {
+			auto const b_size = b ? b->size() : size_t(0);
+			if(a.size() != b_size)
+				return false;
+			for(size_t i = 0; i < a.size(); ++i) {
+				auto const& o = (*b)[i];
+				if(a[i].position != o.position || a[i].format.index() != o.format.index() || format_marker_value(a[i]) != format_marker_value(o))
+					return false;
+			}
+			return true;
+		}
+	}
+
+	uint64_t arrangement_key::hash() const {
+		// fnv-1a over the text, then the formatting and the other fields
+		uint64_t result = 0xCBF29CE484222325;
+		auto mix = [&](uint64_t v) {
+			result ^= v;
+			result *= 0x100000001B3;
+		};
+		for(auto c : text) {
+			mix(uint64_t(c));
+		}
+		if(formatting) {
+			for(auto const& m : *formatting) {
+				mix(uint64_t(m.position) | (uint64_t(m.format.index()) << 16) | (uint64_t(format_marker_value(m)) << 24));
+			}
+		}
+		mix(uint64_t(uint32_t(max_width)));
+		mix(uint64_t(uint32_t(region.x)) | (uint64_t(uint32_t(region.y)) << 32));
+		mix(uint64_t(uint32_t(layout_size)));
+		mix(font_generation);
+		mix(uint64_t(text_sz) | (uint64_t(alignment) << 8) | (uint64_t(orientation) << 16) | (uint64_t(single_line) << 24));
+		return result;
+	}
+
+	bool arrangement_cache::entry::matches(arrangement_key const& k, uint64_t h) const {
+		return hash == h && max_width == k.max_width && region.x == k.region.x && region.y == k.region.y && layout_size == k.layout_size
+			&& font_generation == k.font_generation && text_sz == k.text_sz && alignment == k.alignment && orientation == k.orientation
+			&& single_line == k.single_line && text == k.text && same_formatting(formatting, k.formatting);
+	}
+
+	arrangement_cache::~arrangement_cache() {
+		clear();
+	}
+
+	arrangement_result arrangement_cache::find(arrangement_key const& key) {
+		auto const h = key.hash();
+		std::lock_guard<std::mutex> guard(lock);
+		if(auto it = slot_by_hash.find(h); it != slot_by_hash.end()) {
+			auto& e = entries[it->second];
+			if(e.matches(key, h)) {
+				e.last_used = ++use_counter;
+				++e.handed_out;
+				++counters.hits;
+				retain(e.value.ptr);
+				return e.value;
+			}
+		}
+		++counters.misses;
+		return arrangement_result{};
+	}
+
+	void arrangement_cache::insert(arrangement_key const& key, arrangement_result const& value) {
+		if(!value.ptr)
+			return;
+
+		auto const h = key.hash();
+		std::lock_guard<std::mutex> guard(lock);
+		uint32_t slot = 0;
+		if(auto it = slot_by_hash.find(h); it != slot_by_hash.end()) {
+			// the same key, or one that collides with it: either way the older arrangement gives way
+			slot = it->second;
+			release(entries[slot].value.ptr);
+		} else if(entries.size() < capacity) {
+			slot = uint32_t(entries.size());
+			entries.emplace_back();
+		} else {
+			slot = uint32_t(std::min_element(entries.begin(), entries.end(), [](entry const& a, entry const& b) { return a.last_used < b.last_used; }) - entries.begin());
+			slot_by_hash.erase(entries[slot].hash);
+			release(entries[slot].value.ptr);
+			++counters.evictions;
+		}
+
+		auto& e = entries[slot];
+		e.text.assign(key.text);
+		if(key.formatting)
+			e.formatting.assign(key.formatting->begin(), key.formatting->end());
+		else
+			e.formatting.clear();
+		e.value = value;
+		e.hash = h;
+		e.last_used = ++use_counter;
+		e.handed_out = 1;
+		e.max_width = key.max_width;
+		e.region = key.region;
+		e.layout_size = key.layout_size;
+		e.font_generation = key.font_generation;
+		e.text_sz = key.text_sz;
+		e.alignment = key.alignment;
+		e.orientation = key.orientation;
+		e.single_line = key.single_line;
+
+		retain(value.ptr);
+		slot_by_hash.insert_or_assign(h, slot);
+	}
+
+	bool arrangement_cache::take_exclusive(arrangement_key const& key, arranged_text* ptr) {
+		auto const h = key.hash();
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = slot_by_hash.find(h);
+		if(it == slot_by_hash.end())
+			return false;
+		auto const slot = it->second;
+		if(entries[slot].value.ptr != ptr || entries[slot].handed_out != 1 || !entries[slot].matches(key, h))
+			return false;
+
+		slot_by_hash.erase(it);
+		release(ptr);
+		// the last entry fills the hole
+		if(slot + 1 != entries.size()) {
+			entries[slot] = std::move(entries.back());
+			slot_by_hash.insert_or_assign(entries[slot].hash, slot);
+		}
+		entries.pop_back();
+		return true;
+	}
+
+	void arrangement_cache::clear() {
+		std::lock_guard<std::mutex> guard(lock);
+		for(auto& e : entries) {
+			if(e.value.ptr)
+				release(e.value.ptr);
+		}
+		entries.clear();
+		slot_by_hash.clear();
+		use_counter = 0;
+	}
+
+	arrangement_result estimate_arrangement(size_t text_length, float line_spacing, int32_t layout_size, int32_t max_width, bool single_line) {
+		arrangement_result result;
+		if(layout_size <= 0)
+			return result;
+
+		auto const length_in_units = int32_t(std::ceil(float(text_length) * line_spacing / (2.0f * float(layout_size))));
+		if(single_line || length_in_units <= max_width || max_width <= 0) {
+			result.width_used = length_in_units;
+			result.lines_used = 1;
+		} else {
+			auto const line_count = (length_in_units + max_width - 1) / max_width;
+			result.width_used = max_width;
+			result.lines_used = int32_t(std::ceil(float(line_count) * line_spacing / float(layout_size)));
+		}
+		return result;
+	}
+}
@@ -0,0 +1,64 @@
+#include "printui_datatypes.hpp"
+
+namespace printui {
+	background_queue::~background_queue() {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+			jobs.clear();
+		}
+		work_available.notify_all();
+		for(auto& t : threads) {
+			t.join();
+		}
+	}
+
+	void background_queue::worker() {
+		std::unique_lock<std::mutex> guard(lock);
+		while(true) {
+			work_available.wait(guard, [&]() { return stopping || !jobs.empty(); });
+			if(stopping)
+				return;
+
+			auto job = std::move(jobs.front());
+			jobs.pop_front();
+			++running;
+			guard.unlock();
+
+			job();
+			job = nullptr; // whatever the job captured is released before anyone is told that it finished
+			if(on_job_complete)
+				on_job_complete();
+
+			guard.lock();
+			--running;
+			if(running == 0)
+				work_finished.notify_all();
+		}
+	}
+
+	void background_queue::submit(std::function<void()>&& job) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			jobs.push_back(std::move(job));
+			if(threads.empty()) {
+				for(uint32_t i = 0; i < thread_count; ++i) {
+					threads.emplace_back([this]() { worker(); });
+				}
+			}
+		}
+		work_available.notify_one();
+	}
+
+	void background_queue::cancel_pending() {
+		std::unique_lock<std::mutex> guard(lock);
+		++current_generation;
+		jobs.clear();
+		work_finished.wait(guard, [&]() { return running == 0; });
+	}
+
+	void background_queue::wait_until_idle() {
+		std::unique_lock<std::mutex> guard(lock);
+		work_finished.wait(guard, [&]() { return running == 0 && jobs.empty(); });
+	}
+}
@@ -243,42 +243,116 @@ namespace printui {
 	}
 	void stored_text::invalidate() {
 		formatted_text = nullptr;
+		pending_result.reset();
+		arranged_region = screen_space_point{ -1, -1 };
+		content_version = ++next_content_version;
 	}
 	void stored_text::relayout_text(window_data const& win, screen_space_point sz) {
 		if(!std::holds_alternative<std::monostate>(text_content)) {
 			prepare_text(win);
-			text::adjust_layout_region(formatted_text, sz.x, sz.y);
+			if(formatted_text && (arranged_region.x != sz.x || arranged_region.y != sz.y))
+				arrange_text(win, sz);
 		}
 	}
 
+	void stored_text::arrange_text(window_data const& win, screen_space_point region) {
+		auto const max_width = text_sz != text_size::note ? win.dynamic_settings.line_width : win.dynamic_settings.small_width;
+		auto make_arrangement = [&](std::wstring_view text, std::vector<text::format_marker> const* formatting) {
+			if(formatted_text) {
+				// a new size for text that is already arranged: the existing arrangement is reused where possible
+				arrangement_result current{ formatted_text, resolved_text_size.x, resolved_text_size.y };
+				return win.text_interface.refit_text_arrangement(win, text, text_alignment, text_sz, false, max_width, formatting, current, arranged_region, region);
+			}
+			return win.text_interface.shared_text_arrangement(win, text, text_alignment, text_sz, false, max_width, formatting, region);
+		};
+
+		arrangement_result arrangement;
+		if(std::holds_alternative<wrapped_text_instance>(text_content)) {
+			thread_local text::text_with_formatting text_with_format;
+			win.text_data.instantiate_text_cached(std::get<wrapped_text_instance>(text_content).text_id, text_with_format, std::get<wrapped_text_instance>(text_content).stored_params, std::get<wrapped_text_instance>(text_content).stored_params + std::get<wrapped_text_instance>(text_content).params_count);
+
+			arrangement = make_arrangement(text_with_format.text, &(text_with_format.formatting));
+		} else if(std::holds_alternative<std::wstring>(text_content)) {
+			arrangement = make_arrangement(std::get<std::wstring>(text_content), nullptr);
+		} else {
+			return;
+		}
+
+		formatted_text = arrangement.ptr;
+		arranged_region = region;
+		resolved_text_size = layout_position{ int16_t(arrangement.width_used), int16_t(arrangement.lines_used) };
+	}
+
+	void stored_text::submit_arrangement(window_data const& win) {
+		text::text_with_formatting content;
+		if(std::holds_alternative<wrapped_text_instance>(text_content)) {
+			win.text_data.instantiate_text_cached(std::get<wrapped_text_instance>(text_content).text_id, content, std::get<wrapped_text_instance>(text_content).stored_params, std::get<wrapped_text_instance>(text_content).stored_params + std::get<wrapped_text_instance>(text_content).params_count);
+		} else if(std::holds_alternative<std::wstring>(text_content)) {
+			content.text = std::get<std::wstring>(text_content);
+		} else {
+			return;
+		}
+
+		auto const max_width = text_sz != text_size::note ? win.dynamic_settings.line_width : win.dynamic_settings.small_width;
+		auto const& font = text_sz == text_size::standard ? win.dynamic_settings.primary_font : (text_sz == text_size::note ? win.dynamic_settings.small_font : win.dynamic_settings.header_font);
+		auto const estimate = text::estimate_arrangement(content.text.length(), font.line_spacing, win.layout_size, max_width, false);
+		resolved_text_size = layout_position{ int16_t(estimate.width_used), int16_t(estimate.lines_used) };
+
+		pending_result = std::make_shared<pending_arrangement>();
+		pending_result->queue_generation = win.text_interface.arrangement_jobs.generation();
+		// the text is fitted to the region it occupied before, which it will usually keep, so that the ui thread
+		// doesn't have to arrange it again when the result arrives
+		pending_result->region = arranged_region;
+
+		win.text_interface.arrangement_jobs.submit([&win, result = pending_result, content = std::move(content), alignment = text_alignment, sz = text_sz, max_width]() {
+			auto arrangement = win.text_interface.shared_text_arrangement(win, content.text, alignment, sz, false, max_width, content.formatting.empty() ? nullptr : &content.formatting, result->region);
+			result->text = arrangement.ptr;
+			result->size = layout_position{ int16_t(arrangement.width_used), int16_t(arrangement.lines_used) };
+			result->complete.store(true, std::memory_order_release);
+		});
+	}
+
 	void stored_text::prepare_text(window_data const& win) {
+		bool rearranging = false;
 
 		if(std::holds_alternative<wrapped_text_instance>(text_content)) {
 			if(std::get<wrapped_text_instance>(text_content).text_generation != win.text_data.text_generation) {
+				rearranging = formatted_text || pending_result;
 				formatted_text = nullptr;
+				pending_result.reset();
 				std::get<wrapped_text_instance>(text_content).text_generation = win.text_data.text_generation;
 			}
 
 		} else if(std::holds_alternative<std::wstring>(text_content)) {
 			if(formatted_text && !text::appropriate_directionality(win, formatted_text)) {
+				rearranging = true;
 				formatted_text = nullptr;
 			}
 		}
 
-		if(!formatted_text) {
-			if(std::holds_alternative<wrapped_text_instance>(text_content)) {
-				auto text_with_format = win.text_data.instantiate_text(std::get<wrapped_text_instance>(text_content).text_id, std::get<wrapped_text_instance>(text_content).stored_params, std::get<wrapped_text_instance>(text_content).stored_params + std::get<wrapped_text_instance>(text_content).params_count).text_content;
-
-				auto arrangement = win.text_interface.create_text_arragement(win, text_with_format.text, text_alignment, text_sz, false, text_sz != text_size::note ? win.dynamic_settings.line_width : win.dynamic_settings.small_width, &(text_with_format.formatting));
-				formatted_text = arrangement.ptr;
-				resolved_text_size = layout_position{int16_t(arrangement.width_used), int16_t(arrangement.lines_used) };
-				
-			} else if(std::holds_alternative<std::wstring>(text_content)) {
-
-				auto arrangement = win.text_interface.create_text_arragement(win, std::get<std::wstring>(text_content), text_alignment, text_sz, false, text_sz != text_size::note ? win.dynamic_settings.line_width : win.dynamic_settings.small_width);
-				formatted_text = arrangement.ptr;
-				resolved_text_size = layout_position{ int16_t(arrangement.width_used), int16_t(arrangement.lines_used) };
+		if(pending_result) {
+			if(pending_result->complete.load(std::memory_order_acquire)) {
+				formatted_text = std::move(pending_result->text);
+				resolved_text_size = pending_result->size;
+				arranged_region = pending_result->region;
+				content_version = ++next_content_version;
+				pending_result.reset();
+				return;
+			} else if(pending_result->queue_generation == win.text_interface.arrangement_jobs.generation()) {
+				return; // keep the estimated size until the worker is done
 			}
+			// the job was discarded before it ran
+			pending_result.reset();
+			rearranging = true;
+		}
+
+		if(!formatted_text) {
+			// text that was already on screen is arranged again off the ui thread, so that a locale or font change
+			// doesn't stall the window while every control re-arranges its text
+			if(rearranging && win.text_interface.asynchronous_arrangement)
+				submit_arrangement(win);
+			else
+				arrange_text(win, screen_space_point{ -1, -1 });
 		}
 	}
 	void stored_text::draw_text(window_data& win, int32_t x, int32_t y) const {
@@ -306,7 +380,9 @@ namespace printui {
 	}
 	std::wstring stored_text::get_raw_text(window_data const& win) const {
 		if(std::holds_alternative<wrapped_text_instance>(text_content)) {
-			return win.text_data.instantiate_text(std::get<wrapped_text_instance>(text_content).text_id, std::get<wrapped_text_instance>(text_content).stored_params, std::get<wrapped_text_instance>(text_content).stored_params + std::get<wrapped_text_instance>(text_content).params_count).text_content.text;
+			text::text_with_formatting result;
+			win.text_data.instantiate_text_cached(std::get<wrapped_text_instance>(text_content).text_id, result, std::get<wrapped_text_instance>(text_content).stored_params, std::get<wrapped_text_instance>(text_content).stored_params + std::get<wrapped_text_instance>(text_content).params_count);
+			return std::move(result.text);
 		} else if(std::holds_alternative<std::wstring>(text_content)) {
 			return std::get<std::wstring>(text_content);
 		} else {
@@ -595,7 +671,7 @@ namespace printui {
 		changes_made = true;
 
 		prepare_text(win);
-		update_analyzed_text(analysis_obj, formatted_text, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+		update_analyzed_text(analysis_obj, formatted_text, text.view(), win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
 
 		win.flag_for_update_from_interface(this);
 		if(acc_obj && win.is_visible(l_id)) {
@@ -605,12 +681,12 @@ namespace printui {
 			else
 				win.accessibility_interface.on_text_numeric_value_changed(acc_obj);
 		}
-		on_text_changed(win, text);
+		on_text_changed(win, text.view());
 		if(win.is_visible(l_id)) {
 			win.window_interface.invalidate_window();
 		}
 		if(win.keyboard_target != this) {
-			on_edit_finished(win, text);
+			on_edit_finished(win, text.view());
 		}
 		internal_on_selection_changed(win);
 	}
@@ -649,6 +725,37 @@ namespace printui {
 		}
 	}
 
+	void simple_editable_text::commit_edits(window_data& win) {
+		if(text.has_edit()) {
+			win.edit_undo_buffer.push_change(undo_item{ this, text.take_edit(), undo_anchor, undo_cursor, anchor_position, cursor_position });
+		} else {
+			text.take_edit();
+		}
+		undo_anchor = anchor_position;
+		undo_cursor = cursor_position;
+	}
+	void simple_editable_text::apply_undo_item(window_data& win, undo_item const& item, bool reverse) {
+		auto const& c = item.change;
+		auto const& from = reverse ? c.inserted : c.removed;
+		auto const& to = reverse ? c.removed : c.inserted;
+
+		// the history no longer fits the text if it was changed behind the undo buffer's back
+		if(text.substr(c.position, uint32_t(from.length())) != from)
+			return;
+
+		text.replace(c.position, c.position + uint32_t(from.length()), to);
+		text.take_edit();
+		anchor_position = reverse ? item.anchor_before : item.anchor_after;
+		cursor_position = reverse ? item.cursor_before : item.cursor_after;
+		undo_anchor = anchor_position;
+		undo_cursor = cursor_position;
+
+		internal_on_text_changed(win);
+
+		if(ts_obj)
+			win.text_services_interface.on_text_change(ts_obj, c.position, c.position + uint32_t(from.length()), c.position + uint32_t(to.length()));
+	}
+
 	bool simple_editable_text::prepare_text(window_data const& win) {
 		if(formatted_text && !text::appropriate_directionality(win, formatted_text)) {
 			formatted_text = nullptr;
@@ -661,11 +768,16 @@ namespace printui {
 			// UNRESOLVED: there may still be problems if the text is left-aligned and begins
 			// with a space. A zero width could be prefixed as well, but we would have to adjust
 			// for this in the hit-testing logic as well
-			auto temp_text = text;
-			if(temp_text.length() > 0 && text::is_space(temp_text.back()))
+			auto content = text.view();
+			std::wstring temp_text;
+			if(content.length() > 0 && text::is_space(content.back())) {
+				temp_text.reserve(content.length() + 1);
+				temp_text += content;
 				temp_text += wchar_t(0x200C);
+				content = temp_text;
+			}
 
-			formatted_text = win.text_interface.create_text_arragement(win, temp_text, text_alignment, text_size::standard, true, 100, nullptr).ptr;
+			formatted_text = win.text_interface.create_text_arragement(win, content, text_alignment, text_size::standard, true, 100, nullptr).ptr;
 			if(l_id != layout_reference_none) {
 				auto& node = win.get_node(l_id);
 				auto new_content_rect = screen_rectangle_from_layout_in_ui(win, node.left_margin(), 0, node.width - (node.left_margin() + node.right_margin()), node.height, win.get_current_location(l_id));
@@ -902,7 +1014,7 @@ namespace printui {
 
 		if(relayout_text(win, horizontal(win.orientation) ? screen_space_point{ rect.width - (node.left_margin() + node.right_margin()) * win.layout_size, rect.height } : screen_space_point{ rect.width, rect.height - (node.left_margin() + node.right_margin()) * win.layout_size })) {
 
-			update_analyzed_text(analysis_obj, formatted_text, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+			update_analyzed_text(analysis_obj, formatted_text, text.view(), win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
 		}
 
 		auto icon_location = screen_topleft_from_layout_in_ui(win, 0, ((node.height - 1) / 2), 1, 1, rect);
@@ -1003,7 +1115,7 @@ namespace printui {
 
 	uint32_t simple_editable_text::position_visually_above(window_data& win, uint32_t v) {
 		if(prepare_text(win)) {
-			update_analyzed_text(analysis_obj, formatted_text, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+			update_analyzed_text(analysis_obj, formatted_text, text.view(), win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
 		}
 		
 
@@ -1106,7 +1218,7 @@ namespace printui {
 	}
 	uint32_t simple_editable_text::position_visually_below(window_data& win, uint32_t v) {
 		if(prepare_text(win)) {
-			update_analyzed_text(analysis_obj, formatted_text, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+			update_analyzed_text(analysis_obj, formatted_text, text.view(), win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
 		}
 
 		auto current_line = text::line_of_position(analysis_obj, int32_t(v));
@@ -1397,11 +1509,11 @@ namespace printui {
 
 		cursor_visible = false;
 		if(changes_made) {
-			win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+			commit_edits(win);
 			changes_made = false;
 		}
 		clear_temporary_contents(win);
-		on_edit_finished(win, text);
+		on_edit_finished(win, text.view());
 		win.window_interface.invalidate_window();
 	}
 	void simple_editable_text::on_initialize(window_data& win) {
@@ -1439,15 +1551,16 @@ namespace printui {
 			command(win, edit_command::delete_selection, false);
 		}
 		if(!changes_made)
-			win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
-		auto insert_position = std::min(cursor_position, int32_t(text.length()));
+			commit_edits(win);
+		auto insert_position = uint32_t(std::min(cursor_position, int32_t(text.length())));
 		if(codepoint < 0x10000) {
-			text.insert(insert_position, 1, uint16_t(codepoint));
+			wchar_t const content[] = { wchar_t(codepoint) };
+			text.replace(insert_position, insert_position, std::wstring_view(content, 1));
 			++cursor_position;
 		} else {
 			auto p = text::make_surrogate_pair(codepoint);
-			text.insert(insert_position, 1, uint16_t(p.high));
-			text.insert(insert_position + 1, 1, uint16_t(p.low));
+			wchar_t const content[] = { wchar_t(p.high), wchar_t(p.low) };
+			text.replace(insert_position, insert_position, std::wstring_view(content, 2));
 			cursor_position += 2;
 		}
 		anchor_position = cursor_position;
@@ -1462,7 +1575,9 @@ namespace printui {
 
 		if(text.length() > 0) {
 			auto old_length = text.length();
-			text.clear();
+			text.assign(std::wstring_view{});
+			if(win.keyboard_target != this)
+				text.take_edit();
 			cursor_position = 0;
 			anchor_position = 0;
 			internal_on_text_changed(win);
@@ -1547,10 +1662,10 @@ namespace printui {
 					command(win, edit_command::delete_selection, false);
 				} else {
 					if(!changes_made)
-						win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+						commit_edits(win);
 					auto previous_position = text::get_previous_cursor_position(analysis_obj, cursor_position);
 					if(previous_position != cursor_position) {
-						text.erase(size_t(previous_position), size_t(cursor_position - previous_position));
+						text.replace(uint32_t(previous_position), uint32_t(cursor_position), std::wstring_view{});
 						auto old_cursor = cursor_position;
 						cursor_position = previous_position;
 						anchor_position = previous_position;
@@ -1565,10 +1680,10 @@ namespace printui {
 					command(win, edit_command::delete_selection, false);
 				} else {
 					if(!changes_made)
-						win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+						commit_edits(win);
 					auto next_position = text::get_next_cursor_position(analysis_obj, cursor_position);
 					if(next_position != cursor_position) {
-						text.erase(size_t(cursor_position), size_t(next_position - cursor_position));
+						text.replace(uint32_t(cursor_position), uint32_t(next_position), std::wstring_view{});
 						if(ts_obj)
 							win.text_services_interface.on_text_change(ts_obj, uint32_t(cursor_position), uint32_t(next_position), uint32_t(cursor_position));
 					}
@@ -1580,10 +1695,10 @@ namespace printui {
 				if(anchor_position != cursor_position) {
 					command(win, edit_command::delete_selection, false);
 				} else {
-					win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+					commit_edits(win);
 					auto previous_position = text::get_previous_word_position(analysis_obj, cursor_position);
 					if(previous_position != cursor_position) {
-						text.erase(size_t(previous_position), size_t(cursor_position - previous_position));
+						text.replace(uint32_t(previous_position), uint32_t(cursor_position), std::wstring_view{});
 						auto old_cursor = cursor_position;
 						cursor_position = previous_position;
 						anchor_position = previous_position;
@@ -1599,10 +1714,10 @@ namespace printui {
 				if(anchor_position != cursor_position) {
 					command(win, edit_command::delete_selection, false);
 				} else {
-					win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+					commit_edits(win);
 					auto next_position = text::get_next_word_position(analysis_obj, cursor_position);
 					if(next_position != cursor_position) {
-						text.erase(size_t(cursor_position), size_t(next_position - cursor_position));
+						text.replace(uint32_t(cursor_position), uint32_t(next_position), std::wstring_view{});
 						if(ts_obj)
 							win.text_services_interface.on_text_change(ts_obj, uint32_t(cursor_position), uint32_t(next_position), uint32_t(cursor_position));
 					}
@@ -1625,13 +1740,13 @@ namespace printui {
 				internal_on_selection_changed(win);
 				return;
 			case edit_command::cursor_left:
-				cursor_position = text::left_visual_cursor_position(analysis_obj, cursor_position, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+				cursor_position = text::left_visual_cursor_position(analysis_obj, cursor_position);
 				if(!extend_selection)
 					anchor_position = cursor_position;
 				internal_on_selection_changed(win);
 				return;
 			case edit_command::cursor_right:
-				cursor_position = text::right_visual_cursor_position(analysis_obj, cursor_position, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+				cursor_position = text::right_visual_cursor_position(analysis_obj, cursor_position);
 				if(!extend_selection)
 					anchor_position = cursor_position;
 				internal_on_selection_changed(win);
@@ -1686,28 +1801,19 @@ namespace printui {
 				return;
 			case edit_command::copy:
 				if(anchor_position != cursor_position) {
-					std::wstring_view v(text);
 					auto start = std::min(anchor_position, cursor_position);
 					auto length = std::max(anchor_position, cursor_position) - start;
-					win.window_interface.text_to_clipboard(v.substr(start, length));
+					win.window_interface.text_to_clipboard(text.view().substr(start, length));
 				}
 				return;
 			case edit_command::paste:
 			{
 				auto old_start_position = std::min(anchor_position, cursor_position);
 				auto old_end_position = std::max(anchor_position, cursor_position);
-				win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
-				if(anchor_position != cursor_position) {
-					std::wstring_view v(text);
-					auto start = std::min(anchor_position, cursor_position);
-					auto length = std::max(anchor_position, cursor_position) - start;
-					text.erase(size_t(start), size_t(length));
-					cursor_position = start;
-					anchor_position = start;
-				}
+				commit_edits(win);
 				auto cb = win.window_interface.text_from_clipboard();
-				text.insert(size_t(cursor_position), cb);
-				cursor_position += int32_t(cb.length());
+				text.replace(uint32_t(old_start_position), uint32_t(old_end_position), cb);
+				cursor_position = old_start_position + int32_t(cb.length());
 				anchor_position = cursor_position;
 
 				internal_on_text_changed(win);
@@ -1724,34 +1830,18 @@ namespace printui {
 				return;
 			case edit_command::undo:
 			{
-				auto undostate = win.edit_undo_buffer.undo(undo_item{ this, text, anchor_position, cursor_position });
-				if(undostate.has_value()) {
-					auto old_length = text.length();
-					text = (*undostate).contents;
-					cursor_position = (*undostate).cursor;
-					anchor_position = (*undostate).anchor;
-					
-					internal_on_text_changed(win);
-
-					if(ts_obj)
-						win.text_services_interface.on_text_change(ts_obj, uint32_t(0), uint32_t(old_length), uint32_t(text.length()));
-				}
+				commit_edits(win);
+				auto undostate = win.edit_undo_buffer.undo(this);
+				if(undostate.has_value())
+					apply_undo_item(win, *undostate, true);
 			}
 				return;
 			case edit_command::redo:
 			{
-				auto redostate = win.edit_undo_buffer.redo(undo_item{ this, text, anchor_position, cursor_position });
-				if(redostate.has_value()) {
-					auto old_length = text.length();
-					text = (*redostate).contents;
-					cursor_position = (*redostate).cursor;
-					anchor_position = (*redostate).anchor;
-					
-					internal_on_text_changed(win);
-
-					if(ts_obj)
-						win.text_services_interface.on_text_change(ts_obj, uint32_t(0), uint32_t(old_length), uint32_t(text.length()));
-				}
+				commit_edits(win);
+				auto redostate = win.edit_undo_buffer.redo(this);
+				if(redostate.has_value())
+					apply_undo_item(win, *redostate, false);
 			}
 				return;
 			case edit_command::select_current_word:
@@ -1766,11 +1856,11 @@ namespace printui {
 				return;
 			case edit_command::delete_selection:
 				if(anchor_position != cursor_position) {
-					win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+					commit_edits(win);
 
 					auto start = std::min(anchor_position, cursor_position);
 					auto length = std::max(anchor_position, cursor_position) - start;
-					text.erase(size_t(start), size_t(length));
+					text.replace(uint32_t(start), uint32_t(start + length), std::wstring_view{});
 					cursor_position = start;
 					anchor_position = start;
 					
@@ -1784,7 +1874,7 @@ namespace printui {
 	}
 	void simple_editable_text::register_composition_result(window_data& win) {
 		if(acc_obj && win.is_visible(l_id)) {
-			win.accessibility_interface.on_composition_result(acc_obj, std::wstring_view(text.data() + temp_text_position, size_t(temp_text_length)));
+			win.accessibility_interface.on_composition_result(acc_obj, text.view().substr(size_t(temp_text_position), size_t(temp_text_length)));
 		}
 		temp_text_position = 0;
 		temp_text_length = 0;
@@ -1799,7 +1889,7 @@ namespace printui {
 		}
 	}
 	void simple_editable_text::clear_temporary_contents(window_data& win) {
-		text.erase(size_t(temp_text_position), size_t(temp_text_length));
+		text.replace(uint32_t(temp_text_position), uint32_t(temp_text_position + temp_text_length), std::wstring_view{});
 		cursor_position = temp_text_position;
 		anchor_position = temp_text_position;
 		auto old_length = temp_text_length;
@@ -1817,7 +1907,7 @@ namespace printui {
 		selection_out_of_date = true;
 		if(win.is_visible(l_id)) {
 			if(acc_obj) {
-				win.accessibility_interface.on_composition_change(acc_obj, std::wstring_view(text.data(), size_t(end - start)));
+				win.accessibility_interface.on_composition_change(acc_obj, text.view().substr(0, size_t(end - start)));
 			}
 			win.window_interface.invalidate_window();
 		}
@@ -1865,7 +1955,7 @@ namespace printui {
 		return uint32_t(temp_text_length);
 	}
 	std::wstring simple_editable_text::get_text() const {
-		return text;
+		return text.to_string();
 	}
 	screen_space_rect simple_editable_text::get_edit_bounds(window_data& win) const {
 		if(l_id == layout_reference_none)
@@ -1948,12 +2038,12 @@ namespace printui {
 	void simple_editable_text::insert_text(window_data& win, uint32_t position_start, uint32_t position_end, std::wstring_view content) {
 		if(win.keyboard_target == this) {
 			if(!changes_made)
-				win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+				commit_edits(win);
 		}
 
-		if(position_start != position_end)
-			text.erase(size_t(position_start), size_t(position_end - position_start));
-		text.insert(size_t(position_start), content);
+		text.replace(position_start, position_end, content);
+		if(win.keyboard_target != this)
+			text.take_edit(); // only the user's own changes are undone
 
 		if(int32_t(position_end) < anchor_position) {
 			anchor_position += int32_t(content.length()) - int32_t(position_end - position_start);
@@ -1977,10 +2067,12 @@ namespace printui {
 	void simple_editable_text::set_text(window_data& win, std::wstring const& t) {
 		if(win.keyboard_target == this) {
 			if(!changes_made)
-				win.edit_undo_buffer.push_state(undo_item{ this, text, anchor_position, cursor_position });
+				commit_edits(win);
 		}
 		auto old_length = text.length();
-		text = t;
+		text.assign(t);
+		if(win.keyboard_target != this)
+			text.take_edit();
 		cursor_position = int32_t(t.length());
 		anchor_position = int32_t(t.length());
 		
@@ -1993,7 +2085,9 @@ namespace printui {
 	}
 	void simple_editable_text::quiet_set_text(window_data& win, std::wstring const& t) {
 		auto old_length = text.length();
-		text = t;
+		text.assign(t);
+		if(win.keyboard_target != this)
+			text.take_edit();
 		cursor_position = int32_t(t.length());
 		anchor_position = int32_t(t.length());
 
@@ -2004,7 +2098,7 @@ namespace printui {
 		formatted_text = nullptr;
 
 		prepare_text(win);
-		update_analyzed_text(analysis_obj, formatted_text, text, win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
+		update_analyzed_text(analysis_obj, formatted_text, text.view(), win.orientation != layout_orientation::horizontal_right_to_left, win.text_data);
 
 		selection_out_of_date = true;
 		changes_made = true;
@@ -5,6 +5,11 @@
 #include <vector>
 #include <chrono>
 #include <functional>
+#include <array>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 
 namespace printui {
 	enum class font_type {
@@ -128,6 +133,7 @@ namespace printui {
 
 		struct arranged_text;
 		void release_arranged_text(arranged_text* ptr);
+		void retain_arranged_text(arranged_text* ptr);
 	}
 
 	struct edit_interface;
@@ -177,7 +183,7 @@ namespace printui {
 
 	struct interactable_state {
 	private:
-		uint8_t data = 0ui8;
+		uint8_t data = uint8_t(0);
 		struct impl_key_type {
 		};
 		struct impl_group_type {
@@ -189,7 +195,7 @@ namespace printui {
 		constexpr static impl_group_start_type group_start{};
 		constexpr static impl_key_type key{};
 
-		interactable_state() : data(0ui8) {
+		interactable_state() : data(uint8_t(0)) {
 		}
 		interactable_state(impl_group_type, uint8_t v) {
 			data = uint8_t(v | 0x20);
@@ -234,6 +240,137 @@ namespace printui {
 		std::chrono::time_point<std::chrono::steady_clock> start_time;
 		bool is_running = false;
 
+		float percent_complete(std::chrono::time_point<std::chrono::steady_clock> now) const;
+	};
+
+	// source for a single draw in a composited animation frame; the previous state is the snapshot
+	// taken before the ui changed, the current state is the ui as it is being rendered now
+	enum class animation_layer : uint8_t {
+		previous_state, current_state
+	};
+
+	struct animation_rect {
+		float left = 0.0f;
+		float top = 0.0f;
+		float right = 0.0f;
+		float bottom = 0.0f;
+	};
+
+	struct animation_draw_op {
+		animation_rect destination;
+		animation_rect source; // in window coordinates
+		float opacity = 1.0f;
+		animation_layer layer = animation_layer::current_state;
+		bool linear_filtering = false;
+	};
+
+	struct animation_frame {
+		std::array<animation_draw_op, 2> operations;
+		uint32_t count = 0;
+	};
+
+	animation_frame compose_animation_frame(animation_description const& description, float percent_complete);
+
+	enum class frame_stage : uint8_t {
+		layout, foreground, display, composite, present, count
+	};
+
+	struct frame_record {
+		std::chrono::time_point<std::chrono::steady_clock> start_time;
+		std::array<uint32_t, size_t(frame_stage::count)> stage_start{}; // in microseconds from start_time
+		std::array<uint32_t, size_t(frame_stage::count)> stage_duration{}; // in microseconds
+		uint32_t total_duration = 0; // in microseconds
+
+		uint32_t draw_calls = 0;
+		uint32_t rectangles = 0;
+		uint32_t text_draws = 0;
+	};
+
+	struct frame_statistics {
+		uint32_t p50 = 0;
+		uint32_t p95 = 0;
+		uint32_t p99 = 0;
+		uint32_t maximum = 0;
+		uint32_t samples = 0;
+	};
+
+	// collects per stage timings for the most recent frames; all times are passed in, so that tests can record
+	// frames with times of their own, while the renderer takes them from clock
+	struct frame_profiler {
+		constexpr static uint32_t history_size = 256;
+		using clock_fn = std::chrono::steady_clock::time_point(*)();
+
+		std::array<frame_record, history_size> history;
+		uint32_t next_record = 0;
+		uint32_t records_stored = 0;
+
+		frame_record current;
+		clock_fn clock = std::chrono::steady_clock::now; // separate from the animation clock, which tests may freeze
+		bool enabled = false;
+		bool show_overlay = false;
+
+		void begin_frame(std::chrono::time_point<std::chrono::steady_clock> now);
+		void record_stage(frame_stage stage, std::chrono::time_point<std::chrono::steady_clock> start, std::chrono::time_point<std::chrono::steady_clock> end);
+		void end_frame(std::chrono::time_point<std::chrono::steady_clock> now);
+		void clear();
+
+		frame_statistics stage_statistics(frame_stage stage) const;
+		frame_statistics total_statistics() const;
+		std::string to_chrome_trace() const;
+		std::string statistics_report() const; // one line per stage, then the whole frame, in microseconds
+	};
+
+	// pixels are stored as packed 32 bit premultiplied BGRA, matching the direct2d back buffer
+	struct rgba_image {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		std::vector<uint32_t> pixels;
+	};
+
+	struct image_comparison {
+		uint32_t differing_pixels = 0;
+		uint32_t largest_channel_difference = 0;
+		bool size_mismatch = false;
+
+		bool matches(uint32_t allowed_differing_pixels = 0) const {
+			return !size_mismatch && differing_pixels <= allowed_differing_pixels;
+		}
+	};
+
+	image_comparison compare_images(rgba_image const& expected, rgba_image const& actual, uint32_t channel_tolerance);
+	rgba_image difference_image(rgba_image const& expected, rgba_image const& actual, uint32_t channel_tolerance);
+
+	// single channel coverage masks, as used for icons and interactable tags
+	struct alpha_image {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		std::vector<uint8_t> pixels;
+	};
+
+	enum class device_resource : uint8_t {
+		icons, interactable_tags, count
+	};
+	enum class resource_action : uint8_t {
+		none, upload_from_cache, rebuild
+	};
+
+	// Decides how each class of device dependent resource is brought back after the device is lost: either by
+	// uploading its cpu side copy or, when there is no valid copy, by rasterizing it again. Resources that have never
+	// been created are left to the regular creation path. A resource that has just been rasterized has no valid
+	// copy until captured is called, so that the copy can be read back once things settle rather than every time
+	// the resource is drawn. Contains no graphics api calls so that device loss can be simulated.
+	struct device_resource_tracker {
+		uint32_t device_generation = 1;
+		std::array<uint32_t, size_t(device_resource::count)> uploaded_generation{};
+		std::array<bool, size_t(device_resource::count)> cache_valid{};
+
+		void device_lost();
+		void invalidate_cache(device_resource r);
+		void rasterized(device_resource r);
+		void captured(device_resource r);
+		void uploaded(device_resource r);
+		resource_action required_action(device_resource r) const;
+		bool needs_capture(device_resource r) const;
 	};
 
 	enum class column_break_behavior : uint8_t {
@@ -366,6 +503,38 @@ namespace printui {
 		void rotate_borders(layout_orientation o);
 	};
 
+	// Runs jobs on a few worker threads, in the order they were submitted. The threads are started by the first
+	// submission; on_job_complete, if it is set before then, is called from the worker after every job.
+	class background_queue {
+		std::mutex lock;
+		std::condition_variable work_available;
+		std::condition_variable work_finished;
+		std::deque<std::function<void()>> jobs;
+		std::vector<std::thread> threads;
+		uint32_t thread_count = 1;
+		uint32_t running = 0;
+		uint32_t current_generation = 0;
+		bool stopping = false;
+
+		void worker();
+	public:
+		std::function<void()> on_job_complete;
+
+		explicit background_queue(uint32_t thread_count) : thread_count(thread_count != 0 ? thread_count : 1) { }
+		background_queue(background_queue const&) = delete;
+		background_queue& operator=(background_queue const&) = delete;
+		~background_queue();
+
+		void submit(std::function<void()>&& job);
+		// discards the jobs that have not started and waits for the ones that have; afterwards no job touches
+		// anything until the next submission, and generation() has changed so that callers can tell their job was dropped
+		void cancel_pending();
+		void wait_until_idle();
+		uint32_t generation() const {
+			return current_generation;
+		}
+	};
+
 	enum class keyboard_type : uint8_t {
 		left_hand, right_hand, right_hand_tilted, custom
 	};
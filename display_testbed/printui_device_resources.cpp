@@ -0,0 +1,34 @@
+#include "printui_datatypes.hpp"
+
+namespace printui {
+	void device_resource_tracker::device_lost() {
+		++device_generation;
+	}
+
+	void device_resource_tracker::invalidate_cache(device_resource r) {
+		cache_valid[size_t(r)] = false;
+	}
+
+	void device_resource_tracker::rasterized(device_resource r) {
+		cache_valid[size_t(r)] = false;
+		uploaded_generation[size_t(r)] = device_generation;
+	}
+
+	void device_resource_tracker::captured(device_resource r) {
+		cache_valid[size_t(r)] = true;
+	}
+
+	void device_resource_tracker::uploaded(device_resource r) {
+		uploaded_generation[size_t(r)] = device_generation;
+	}
+
+	resource_action device_resource_tracker::required_action(device_resource r) const {
+		if(uploaded_generation[size_t(r)] == 0 || uploaded_generation[size_t(r)] == device_generation)
+			return resource_action::none;
+		return cache_valid[size_t(r)] ? resource_action::upload_from_cache : resource_action::rebuild;
+	}
+
+	bool device_resource_tracker::needs_capture(device_resource r) const {
+		return uploaded_generation[size_t(r)] == device_generation && !cache_valid[size_t(r)];
+	}
+}
@@ -0,0 +1,70 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <algorithm>
+
+namespace printui::text {
+
+	void editable_text_buffer::replace(uint32_t start, uint32_t end, std::wstring_view content) {
+		end = std::min(end, length());
+		start = std::min(start, end);
+		auto const count = uint32_t(content.length());
+		if(start == end && count == 0)
+			return;
+
+		// the text outside of the pending range is still as it was before the pending change, so when this edit
+		// reaches past that range, the text it reaches over is added to what the pending change removed
+		if(!has_pending) {
+			pending_removed.clear();
+			pending_removed.append(storage, start, end - start);
+			pending_position = start;
+			pending_inserted = count;
+			has_pending = true;
+		} else {
+			auto const pending_end = pending_position + pending_inserted;
+			if(start < pending_position) {
+				pending_removed.insert(0, storage, start, pending_position - start);
+			}
+			if(end > pending_end) {
+				pending_removed.append(storage, pending_end, end - pending_end);
+			}
+			auto const new_start = std::min(start, pending_position);
+			auto const new_end = std::max(end, pending_end) - (end - start) + count;
+			pending_position = new_start;
+			pending_inserted = new_end - new_start;
+		}
+
+		storage.replace(start, end - start, content);
+	}
+
+	std::wstring editable_text_buffer::substr(uint32_t start, uint32_t count) const {
+		if(start >= length())
+			return std::wstring();
+		return storage.substr(start, count);
+	}
+
+	bool editable_text_buffer::has_edit() const noexcept {
+		if(!has_pending)
+			return false;
+		if(pending_inserted != pending_removed.length())
+			return true;
+		for(uint32_t i = 0; i < pending_inserted; ++i) {
+			if(storage[pending_position + i] != pending_removed[i])
+				return true;
+		}
+		return false;
+	}
+
+	text_edit editable_text_buffer::take_edit() {
+		text_edit result;
+		if(has_pending) {
+			result.position = pending_position;
+			result.removed = std::move(pending_removed);
+			result.inserted = storage.substr(pending_position, pending_inserted);
+		}
+		pending_removed.clear();
+		pending_position = 0;
+		pending_inserted = 0;
+		has_pending = false;
+		return result;
+	}
+}
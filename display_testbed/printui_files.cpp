@@ -171,6 +171,29 @@ namespace printui {
 		}
 	}
 
+	bool win32_file_system::write_file(std::wstring const& file_name, std::string_view content) const {
+		HANDLE file_handle = CreateFileW(file_name.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if(file_handle == INVALID_HANDLE_VALUE)
+			return false;
+
+		DWORD written = 0;
+		bool result = WriteFile(file_handle, content.data(), DWORD(content.length()), &written, nullptr) && written == DWORD(content.length());
+		CloseHandle(file_handle);
+		if(!result)
+			DeleteFileW(file_name.c_str());
+		return result;
+	}
+
+	std::optional<file_metadata> win32_file_system::get_file_metadata(std::wstring const& file_name) const {
+		WIN32_FILE_ATTRIBUTE_DATA fdata;
+		if(!GetFileAttributesExW(file_name.c_str(), GetFileExInfoStandard, &fdata))
+			return std::nullopt;
+		file_metadata result;
+		result.size = (uint64_t(fdata.nFileSizeHigh) << 32) | fdata.nFileSizeLow;
+		result.last_write_time = (uint64_t(fdata.ftLastWriteTime.dwHighDateTime) << 32) | fdata.ftLastWriteTime.dwLowDateTime;
+		return result;
+	}
+
 	bool win32_file_system::file_exists(std::wstring const& file_name) const {
 		auto a = GetFileAttributes(file_name.c_str());
 		return a != INVALID_FILE_ATTRIBUTES && (a & FILE_ATTRIBUTE_DIRECTORY) == 0;
@@ -254,4 +277,25 @@ namespace printui {
 		CoTaskMemFree(local_path_out);
 		return result;
 	}
+
+	std::wstring win32_file_system::get_cache_directory() const {
+		WCHAR module_name[MAX_PATH] = {};
+		int32_t path_used = GetModuleFileName(nullptr, module_name, MAX_PATH);
+		int32_t last_path = path_used;
+		for(; last_path >= 0 && module_name[last_path] != L'\\'; --last_path) {
+		}
+		std::wstring app_name(module_name + last_path + 1);
+		if(app_name.ends_with(L".exe") || app_name.ends_with(L".dll")) {
+			app_name.pop_back(); app_name.pop_back(); app_name.pop_back(); app_name.pop_back();
+		}
+
+		auto base_path = get_common_printui_directory();
+		if(base_path.length() == 0)
+			return std::wstring();
+		auto result = base_path + app_name + L"\\cache";
+		auto created = SHCreateDirectoryExW(nullptr, result.c_str(), nullptr);
+		if(created != ERROR_SUCCESS && created != ERROR_ALREADY_EXISTS)
+			return std::wstring();
+		return result;
+	}
 }
@@ -11,6 +11,11 @@
 #include <Windows.h>
 
 namespace printui {
+	struct file_metadata {
+		uint64_t size = 0;
+		uint64_t last_write_time = 0;
+	};
+
 	struct win32_file_system {
 		void load_settings(window_data& win);
 		void save_settings(window_data& win);
@@ -20,11 +25,15 @@ namespace printui {
 		void for_each_directory(std::wstring const& directory, std::function<void(std::wstring const&)> const& fn) const;
 		void for_each_filtered_file(std::wstring const& directory_and_filter, std::function<void(std::wstring const&)> const& fn) const;
 		void with_file_content(std::wstring const& file_name, std::function<void(std::string_view)> const& fn) const;
+		bool write_file(std::wstring const& file_name, std::string_view content) const;
+		std::optional<file_metadata> get_file_metadata(std::wstring const& file_name) const;
 		bool file_exists(std::wstring const& file_name) const;
 		bool directory_exists(std::wstring const& dir_name) const;
 		std::optional<std::wstring> resolve_file_path(std::wstring const& file_name, std::wstring const& subdirectory) const;
 		std::wstring get_root_directory() const;
 		std::wstring get_common_printui_directory() const;
+		// a per-user directory for files that can be rebuilt at any time; created if missing, empty if that failed
+		std::wstring get_cache_directory() const;
 	};
 }
 
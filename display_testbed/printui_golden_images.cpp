@@ -0,0 +1,227 @@
+#include "printui_main_header.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace printui {
+	namespace {
+		wchar_t const* orientation_name(layout_orientation o) {
+			switch(o) {
+				case layout_orientation::horizontal_left_to_right:
+					return L"horizontal_ltr";
+				case layout_orientation::horizontal_right_to_left:
+					return L"horizontal_rtl";
+				case layout_orientation::vertical_left_to_right:
+					return L"vertical_ltr";
+				case layout_orientation::vertical_right_to_left:
+					return L"vertical_rtl";
+			}
+			return L"unknown";
+		}
+
+		void check_render_time(window_data& win, golden_image_result& result, golden_image_options const& options) {
+			std::vector<uint32_t> times;
+			for(uint32_t i = 0; i < std::max(options.timing_renders, 1u); ++i) {
+				auto start = std::chrono::steady_clock::now();
+				win.rendering_interface.render_to_image(win);
+				times.push_back(uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+			}
+			std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+			result.render_microseconds = times[times.size() / 2];
+
+			auto baseline_file = options.directory + L"\\" + result.scene + L".time";
+			std::optional<uint32_t> baseline;
+			win.file_system.with_file_content(baseline_file, [&](std::string_view content) {
+				uint32_t value = 0;
+				size_t digits = 0;
+				for(; digits < content.length() && content[digits] >= '0' && content[digits] <= '9'; ++digits)
+					value = value * 10 + uint32_t(content[digits] - '0');
+				if(digits != 0)
+					baseline = value;
+			});
+
+			if(baseline) {
+				result.baseline_microseconds = *baseline;
+				result.too_slow = double(result.render_microseconds) > double(*baseline) * options.timing_tolerance;
+			} else {
+				result.baseline_missing = true;
+			}
+			if((result.baseline_missing || result.too_slow) && options.update_goldens) {
+				result.baseline_written = win.file_system.write_file(baseline_file, std::to_string(result.render_microseconds) + "\n");
+				if(result.baseline_written)
+					result.baseline_microseconds = result.render_microseconds;
+			}
+		}
+
+		// the first render doubles as the warm-up for the timed renders after it
+		golden_image_result check_scene(window_data& win, std::wstring const& scene, golden_image_options const& options) {
+			golden_image_result result;
+			result.scene = scene;
+
+			auto actual = win.rendering_interface.render_to_image(win);
+			check_render_time(win, result, options);
+
+			auto golden_file = options.directory + L"\\" + scene + L".png";
+			auto expected = win.rendering_interface.load_image(golden_file);
+
+			if(!expected) {
+				result.golden_missing = true;
+				if(options.update_goldens)
+					result.golden_written = win.rendering_interface.save_image(actual, golden_file);
+				return result;
+			}
+
+			result.comparison = compare_images(*expected, actual, options.channel_tolerance);
+			if(!result.comparison.matches() && options.update_goldens) {
+				result.golden_written = win.rendering_interface.save_image(actual, golden_file);
+			} else if(!result.comparison.matches()) {
+				win.rendering_interface.save_image(actual, options.directory + L"\\" + scene + L".actual.png");
+				win.rendering_interface.save_image(difference_image(*expected, actual, options.channel_tolerance), options.directory + L"\\" + scene + L".diff.png");
+			}
+			return result;
+		}
+
+		// a render first, so that both measured renders find the foreground tiles cached
+		background_merge_result compare_background_merging(window_data& win, std::wstring const& scene, uint32_t channel_tolerance) {
+			background_merge_result result;
+			result.scene = scene;
+
+			auto& renderer = win.rendering_interface;
+			auto const was_merging = renderer.merge_backgrounds;
+			renderer.render_to_image(win);
+
+			renderer.merge_backgrounds = false;
+			renderer.profiler.current.draw_calls = 0;
+			auto unmerged = renderer.render_to_image(win);
+			result.unmerged_draw_calls = renderer.profiler.current.draw_calls;
+
+			renderer.merge_backgrounds = true;
+			renderer.profiler.current.draw_calls = 0;
+			auto merged = renderer.render_to_image(win);
+			result.merged_draw_calls = renderer.profiler.current.draw_calls;
+
+			renderer.merge_backgrounds = was_merging;
+			result.comparison = compare_images(unmerged, merged, channel_tolerance);
+			return result;
+		}
+	}
+
+	// animations are turned off for the duration of the run so that every capture shows a settled layout
+	golden_image_report run_golden_image_suite(window_data& win, golden_image_options const& options) {
+		golden_image_report report;
+		auto& results = report.scenes;
+
+		auto const original_orientation = win.orientation;
+		auto const animations_were_enabled = win.dynamic_settings.uianimations;
+		win.dynamic_settings.uianimations = false;
+		auto const arrangement_was_asynchronous = win.text_interface.asynchronous_arrangement;
+		win.text_interface.asynchronous_arrangement = false;
+
+		layout_orientation const orientations[] = {
+			layout_orientation::horizontal_left_to_right, layout_orientation::horizontal_right_to_left,
+			layout_orientation::vertical_left_to_right, layout_orientation::vertical_right_to_left };
+
+		for(auto o : orientations) {
+			std::wstring prefix = orientation_name(o);
+			win.change_orientation(o);
+
+			results.push_back(check_scene(win, prefix + L"_main", options));
+
+			win.window_bar.close_i.on_right_click(win, 0, 0);
+			results.push_back(check_scene(win, prefix + L"_info_window", options));
+			win.info_popup.close(win, false);
+
+			win.show_settings_panel();
+			results.push_back(check_scene(win, prefix + L"_settings", options));
+			report.background_merging.push_back(compare_background_merging(win, prefix + L"_settings", options.channel_tolerance));
+
+			win.window_bar.print_ui_settings.orientation_list.open(win, false);
+			results.push_back(check_scene(win, prefix + L"_settings_list_open", options));
+			win.window_bar.print_ui_settings.orientation_list.close(win, false);
+
+			win.hide_settings_panel();
+		}
+
+		win.change_orientation(original_orientation);
+		win.dynamic_settings.uianimations = animations_were_enabled;
+		win.text_interface.asynchronous_arrangement = arrangement_was_asynchronous;
+
+		return report;
+	}
+
+	std::optional<golden_image_options> golden_image_options_from_arguments(int argc, wchar_t const* const* argv) {
+		std::optional<golden_image_options> result;
+		for(int i = 1; i < argc; ++i) {
+			std::wstring_view arg = argv[i];
+			if(arg == L"--golden-images" && i + 1 < argc) {
+				if(!result)
+					result.emplace();
+				result->directory = argv[++i];
+			} else if(arg == L"--golden-tolerance" && i + 1 < argc) {
+				if(!result)
+					result.emplace();
+				result->channel_tolerance = uint32_t(std::wcstoul(argv[++i], nullptr, 10));
+			} else if(arg == L"--timing-renders" && i + 1 < argc) {
+				if(!result)
+					result.emplace();
+				result->timing_renders = uint32_t(std::wcstoul(argv[++i], nullptr, 10));
+			} else if(arg == L"--timing-tolerance" && i + 1 < argc) {
+				if(!result)
+					result.emplace();
+				result->timing_tolerance = std::wcstof(argv[++i], nullptr);
+			} else if(arg == L"--update-goldens") {
+				if(!result)
+					result.emplace();
+				result->update_goldens = true;
+			}
+		}
+		if(result && result->directory.empty())
+			return std::nullopt;
+		return result;
+	}
+
+	uint32_t run_golden_image_check(window_data& win, golden_image_options const& options) {
+		auto results = run_golden_image_suite(win, options);
+
+		uint32_t failures = 0;
+		std::string report;
+		for(auto const& r : results.scenes) {
+			for(auto c : r.scene) {
+				report += char(c);
+			}
+			if(r.golden_written)
+				report += "\twritten";
+			else if(r.golden_missing)
+				report += "\tmissing";
+			else if(r.image_passed())
+				report += "\tpassed";
+			else
+				report += "\tfailed";
+			report += "\t" + std::to_string(r.comparison.differing_pixels) + " pixels";
+			if(r.baseline_written)
+				report += "\ttiming written";
+			else if(r.baseline_missing)
+				report += "\ttiming missing";
+			else if(r.timing_passed())
+				report += "\ttiming passed";
+			else
+				report += "\ttiming failed";
+			report += "\t" + std::to_string(r.render_microseconds) + " of " + std::to_string(r.baseline_microseconds) + " us\n";
+			if(!r.passed())
+				++failures;
+		}
+		for(auto const& r : results.background_merging) {
+			for(auto c : r.scene) {
+				report += char(c);
+			}
+			report += r.passed() ? "\tmerging passed\t" : "\tmerging failed\t";
+			report += std::to_string(r.merged_draw_calls) + " of " + std::to_string(r.unmerged_draw_calls) + " draw calls\t" + std::to_string(r.comparison.differing_pixels) + " pixels\n";
+			if(!r.passed())
+				++failures;
+		}
+		auto const checks = results.scenes.size() + results.background_merging.size();
+		report += std::to_string(checks - failures) + " of " + std::to_string(checks) + " checks passed\n";
+		win.file_system.write_file(options.directory + L"\\golden_report.txt", report);
+		return failures;
+	}
+}
@@ -0,0 +1,63 @@
+#include "printui_datatypes.hpp"
+
+#include <algorithm>
+
+namespace printui {
+	namespace {
+		uint32_t largest_channel_delta(uint32_t a, uint32_t b) {
+			uint32_t result = 0;
+			for(uint32_t shift = 0; shift < 32; shift += 8) {
+				int32_t ca = int32_t((a >> shift) & 0xFF);
+				int32_t cb = int32_t((b >> shift) & 0xFF);
+				result = std::max(result, uint32_t(ca > cb ? ca - cb : cb - ca));
+			}
+			return result;
+		}
+	}
+
+	image_comparison compare_images(rgba_image const& expected, rgba_image const& actual, uint32_t channel_tolerance) {
+		image_comparison result;
+		if(expected.width != actual.width || expected.height != actual.height
+			|| expected.pixels.size() != actual.pixels.size()) {
+
+			result.size_mismatch = true;
+			return result;
+		}
+
+		for(size_t i = 0; i < expected.pixels.size(); ++i) {
+			auto delta = largest_channel_delta(expected.pixels[i], actual.pixels[i]);
+			result.largest_channel_difference = std::max(result.largest_channel_difference, delta);
+			if(delta > channel_tolerance)
+				++result.differing_pixels;
+		}
+		return result;
+	}
+
+	// pixels that differ by more than the tolerance are marked in opaque red on top of a
+	// faded copy of the expected image; used to write out the diff next to a failing golden
+	rgba_image difference_image(rgba_image const& expected, rgba_image const& actual, uint32_t channel_tolerance) {
+		rgba_image result;
+		result.width = std::max(expected.width, actual.width);
+		result.height = std::max(expected.height, actual.height);
+		result.pixels.resize(size_t(result.width) * size_t(result.height), uint32_t(0xFFFF0000));
+
+		for(uint32_t y = 0; y < result.height; ++y) {
+			for(uint32_t x = 0; x < result.width; ++x) {
+				if(x >= expected.width || y >= expected.height || x >= actual.width || y >= actual.height)
+					continue;
+
+				auto e = expected.pixels[size_t(y) * expected.width + x];
+				auto a = actual.pixels[size_t(y) * actual.width + x];
+				auto& out = result.pixels[size_t(y) * result.width + x];
+
+				if(largest_channel_delta(e, a) > channel_tolerance) {
+					out = uint32_t(0xFFFF0000);
+				} else {
+					// quarter intensity copy of the expected pixel, kept opaque
+					out = uint32_t(0xFF000000) | ((e >> 2) & uint32_t(0x003F3F3F));
+				}
+			}
+		}
+		return result;
+	}
+}
@@ -1022,6 +1022,7 @@ namespace printui {
 
 	void window_data::change_size_multiplier(float v) {
 		if(dynamic_settings.global_size_multiplier != v) {
+			text_interface.arrangement_jobs.cancel_pending();
 			dynamic_settings.global_size_multiplier = v;
 			layout_out_of_date = true;
 			rendering_interface.stop_ui_animations(*this);
@@ -1048,6 +1049,7 @@ namespace printui {
 		}
 	}
 	void window_data::change_orientation(layout_orientation o) {
+		text_interface.arrangement_jobs.cancel_pending();
 		orientation = o;
 		dynamic_settings.preferred_orientation = o;
 		layout_out_of_date = true;
@@ -1097,6 +1099,25 @@ namespace printui {
 		}
 	}
 
+	void window_data::on_text_arrangements_ready() {
+		// controls whose text is still being arranged report that their data isn't ready; specifying them again
+		// lets them pick up the real size of their text, and any change in their size propagates upwards from there
+		std::vector<layout_reference> waiting;
+		for(auto& r : prepared_layout) {
+			auto ri = r.parent_object.get_render_interface();
+			if(ri && ri->l_id != layout_reference_none && !ri->data_is_ready())
+				waiting.push_back(ri->l_id);
+		}
+		if(waiting.empty())
+			return;
+
+		for(auto id : waiting) {
+			propogate_layout_change_upwards(id);
+		}
+		ui_rects_out_of_date = true;
+		window_interface.invalidate_window();
+	}
+
 	void window_data::resize_item(layout_reference id, int32_t new_width, int32_t new_height) {
 
 		propogate_layout_change_upwards(id);
@@ -22,6 +22,7 @@
 #include <array>
 #include <functional>
 #include <chrono>
+#include <atomic>
 
 // for text ids common to the shared prinui controls
 namespace text_id {
@@ -158,6 +159,151 @@ namespace text_id {
 	inline constexpr uint16_t label_font_info = 129;
 
 	inline constexpr uint16_t first_free_id = 130;
+
+	// the name of each of the ids above, indexed by id; the text manager registers them in this order
+	inline constexpr std::array<std::string_view, first_free_id> names = {
+		"ui_settings_name",
+		"settings_header",
+		"orientation_label",
+		"orientation_ltr",
+		"orientation_rtl",
+		"orientation_vltr",
+		"orientation_vrtl",
+		"input_mode_label",
+		"input_mode_keyboard_only",
+		"input_mode_mouse_only",
+		"input_mode_controller_only",
+		"input_mode_controller_with_pointer",
+		"input_mode_mouse_and_keyboard",
+		"input_mode_follow_input",
+		"page_fraction",
+		"language_label",
+		"minimize_info",
+		"maximize_info",
+		"restore_info",
+		"settings_info",
+		"info_info",
+		"close_info",
+		"orientation_info",
+		"input_mode_info",
+		"input_mode_mouse_info",
+		"input_mode_automatic_info",
+		"input_mode_controller_info",
+		"input_mode_controller_hybrid_info",
+		"input_mode_keyboard_info",
+		"input_mode_mk_hybrid_info",
+		"language_info",
+		"ui_settings_info",
+		"minimize_name",
+		"maximize_name",
+		"restore_name",
+		"close_name",
+		"settings_name",
+		"info_name",
+		"info_name_on",
+		"window_bar_name",
+		"expandable_container_localized_name",
+		"settings_tabs_name",
+		"selection_list_localized_name",
+		"close_settings_name",
+		"close_menu_name",
+		"page_prev_name",
+		"page_next_name",
+		"page_prev_prev_name",
+		"page_next_next_name",
+		"page_footer_name",
+		"page_footer_info",
+		"generic_toggle_on",
+		"generic_toggle_off",
+		"ui_animations_label",
+		"ui_animations_info",
+		"ui_scale",
+		"ui_scale_edit_name",
+		"ui_scale_info",
+		"primary_font_label",
+		"primary_font_info",
+		"small_font_label",
+		"small_font_info",
+		"fonts_header",
+		"generic_toggle_yes",
+		"generic_toggle_no",
+		"font_weight",
+		"font_stretch",
+		"font_italic",
+		"font_weight_edit_name",
+		"font_stretch_edit_name",
+		"font_italic_info",
+		"font_weight_info",
+		"font_stretch_info",
+		"header_font_label",
+		"header_font_info",
+		"relative_size_label",
+		"relative_size_edit_name",
+		"relative_size_small_info",
+		"relative_size_header_info",
+		"top_lead_label",
+		"top_lead_edit_name",
+		"top_lead_edit_info",
+		"bottom_lead_label",
+		"bottom_lead_edit_name",
+		"bottom_lead_edit_info",
+		"keyboard_header",
+		"key_ord_name",
+		"scan_code",
+		"key_display_name",
+		"keyboard_arrangement",
+		"keyboard_left",
+		"keyboard_right",
+		"keyboard_tilted",
+		"keyboard_custom",
+		"keyboard_arragnement_info",
+		"key_escape_name",
+		"key_escape_info",
+		"key_info_name",
+		"key_info_info",
+		"info_key_is_sticky",
+		"keyboard_code_info",
+		"keyboard_display_name_info",
+		"keyboard_display_edit_name",
+		"info_key_sticky_info",
+		"controller_header",
+		"button_ord_name",
+		"button_group_name",
+		"button_group_sticky",
+		"buttons_escape_name",
+		"buttons_info_name",
+		"first_button_label",
+		"second_button_label",
+		"buttons_are_sticky",
+		"thumbstick_label",
+		"thumbstick_left_name",
+		"thumbstick_right_name",
+		"sensitivity_label",
+		"deadzone_label",
+		"button_assignment_info",
+		"info_button_info",
+		"escape_button_info",
+		"controller_sticky_info",
+		"thumbstick_info",
+		"sensitivity_info",
+		"deadzone_info",
+		"general_header",
+		"cursor_blink_label",
+		"cursor_blink_info",
+		"label_font_label",
+		"label_font_info"
+	};
+
+	// resolves the name of a common text id at compile time; a name that is not in the table does not compile
+	consteval uint16_t from_name(std::string_view name) {
+		for(uint16_t i = 0; i < first_free_id; ++i) {
+			if(names[i] == name)
+				return i;
+		}
+		throw "not the name of a common text id";
+	}
+
+	static_assert(from_name("ui_settings_name") == ui_settings_name && from_name("label_font_info") == label_font_info);
 }
 
 namespace printui {
@@ -344,6 +490,8 @@ namespace printui {
 		std::wstring locale_region;
 		std::wstring locale_lang;
 		bool locale_is_default = true;
+		bool compact_text = false; // keep loaded text as utf8, see text_storage_encoding
+		bool frame_profiling = false; // time each frame; ctrl+shift+p shows the statistics, ctrl+shift+t writes frame_trace.json and frame_statistics.txt
 
 		layout_orientation preferred_orientation = layout_orientation::horizontal_left_to_right;
 		float animation_speed_multiplier = 1.0f;
@@ -358,33 +506,6 @@ namespace printui {
 		
 	};
 
-	namespace text {
-		struct string_hash {
-			using is_transparent = void;
-			[[nodiscard]] size_t operator()(const char* txt) const {
-				return std::hash<std::string_view>{}(txt);
-			}
-			[[nodiscard]] size_t operator()(std::string_view txt) const {
-				return std::hash<std::string_view>{}(txt);
-			}
-			[[nodiscard]] size_t operator()(const std::string& txt) const {
-				return std::hash<std::string_view>{}(std::string_view(txt));
-			}
-		};
-		struct text_id {
-			uint32_t id = 0;
-		};
-		struct fp_param {
-			double value = 0.0;
-			uint8_t decimal_places = 0;
-		};
-		struct int_param {
-			int64_t value = 0;
-			uint8_t decimal_places = 0;
-		};
-		using text_parameter = std::variant<int_param, fp_param, text_id>;
-	}
-
 	namespace parse {
 		void settings_file(launch_settings& ls, std::unordered_map<std::string, uint32_t, text::string_hash, std::equal_to<>>& font_name_to_index, char const* start, char const* end);
 		void custom_fonts_only(launch_settings& ls, std::unordered_map<std::string, uint32_t, text::string_hash, std::equal_to<>>& font_name_to_index, char const* start, char const* end);
@@ -610,7 +731,18 @@ namespace printui {
 
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) = 0;
 
+		// controls that can report a version for what render_foreground draws may have their foreground cached
+		// by the renderer, which then blits it instead of drawing it again until the version changes
+		virtual std::optional<uint32_t> foreground_version() const {
+			return std::optional<uint32_t>{};
+		}
+
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse);
+		// whether render_composite fills the rectangle with its own background brush through background_rectangle;
+		// the renderer merges only such fills with those of neighboring rectangles
+		virtual bool fills_background(ui_rectangle const&) const {
+			return true;
+		}
 		virtual void on_click(window_data&, uint32_t, uint32_t) {
 		}
 		virtual void on_click(window_data& p, uint32_t) { // for direct use with an interactable
@@ -707,11 +839,27 @@ namespace printui {
 		uint8_t text_generation = 0;
 	};
 
+	// filled in by a text arrangement worker, which marks it complete last
+	struct pending_arrangement {
+		arranged_text_ptr text;
+		layout_position size{ 0, 1 };
+		screen_space_point region{ -1, -1 }; // the region the text was fitted to
+		uint32_t queue_generation = 0;
+		std::atomic<bool> complete = false;
+	};
+
 	struct stored_text {
 	private:
-		arranged_text_ptr formatted_text;
+		arranged_text_ptr formatted_text; // may be shared with other stored_text objects displaying the same text, see refit_text_arrangement
 		std::variant<std::monostate, std::wstring, wrapped_text_instance> text_content = std::monostate{};
+		std::shared_ptr<pending_arrangement> pending_result; // while set, resolved_text_size is only an estimate
+		screen_space_point arranged_region{ -1, -1 };
+		inline static uint32_t next_content_version = 0;
+
+		void arrange_text(window_data const& win, screen_space_point region);
+		void submit_arrangement(window_data const& win);
 	public:
+		uint32_t content_version = 0; // unique across all stored_text objects, changes whenever the text is invalidated
 		layout_position resolved_text_size{ 0,1 };
 		content_alignment text_alignment = content_alignment::leading;
 		text_size text_sz = text_size::standard;
@@ -728,6 +876,9 @@ namespace printui {
 		int32_t get_lines_height(window_data const& win) const;
 		int32_t get_text_width(window_data const& win) const;
 		std::wstring get_raw_text(window_data const& win) const;
+		bool is_ready() const {
+			return !pending_result;
+		}
 	};
 
 	struct title_bar_element : public render_interface {
@@ -742,6 +893,9 @@ namespace printui {
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void recreate_contents(window_data&, layout_node&) override;
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return text.is_ready();
+		}
 		virtual accessibility_object* get_accessibility_interface(window_data&) override;
 
 		void set_text_content(uint16_t text_id);
@@ -779,7 +933,13 @@ namespace printui {
 		virtual layout_node_type get_node_type() override;
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
+		virtual bool fills_background(ui_rectangle const&) const override {
+			return !selected; // a selected button swaps its brushes
+		}
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return button_text.is_ready();
+		}
 		virtual void recreate_contents(window_data&, layout_node&) override;
 
 		virtual void set_interactable(int32_t, interactable_state v) override {
@@ -854,6 +1014,9 @@ namespace printui {
 		virtual layout_node_type get_node_type() override;
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
+		virtual bool fills_background(ui_rectangle const&) const override {
+			return !is_toggled(); // a toggled button swaps its brushes
+		}
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
 
 		virtual void set_interactable(int32_t, interactable_state v) override {
@@ -899,7 +1062,7 @@ namespace printui {
 		text_analysis_ptr analysis_obj;
 		arranged_text_ptr formatted_text;
 
-		std::wstring text;
+		text::editable_text_buffer text;
 		
 		int32_t anchor_position = 0;
 		int32_t cursor_position = 0;
@@ -908,6 +1071,8 @@ namespace printui {
 		int32_t temp_text_position = 0;
 		int32_t temp_text_length = 0;
 		int32_t cached_cursor_postion = 0;
+		int32_t undo_anchor = 0; // the selection when the changes not yet in the undo buffer began
+		int32_t undo_cursor = 0;
 
 		uint16_t name;
 		uint16_t alt_text;
@@ -926,6 +1091,8 @@ namespace printui {
 		void internal_on_text_changed(window_data&);
 		void internal_on_selection_changed(window_data&);
 		void internal_move_cursor_to_point(window_data&, int32_t x, int32_t y, bool extend_selection);
+		void commit_edits(window_data& win);
+		void apply_undo_item(window_data& win, undo_item const& item, bool reverse);
 	public:
 		interactable_state saved_state;
 		edit_contents edit_type = edit_contents::generic_text;
@@ -1032,9 +1199,9 @@ namespace printui {
 		bool relayout_text(window_data const& win, screen_space_point sz);
 		void draw_text(window_data& win, int32_t x, int32_t y) const;
 
-		// for implementations
-		virtual void on_text_changed(window_data&, std::wstring const&) { }
-		virtual void on_edit_finished(window_data&, std::wstring const&) { }
+		// for implementations; the text is valid only until the control's text is next changed
+		virtual void on_text_changed(window_data&, std::wstring_view) { }
+		virtual void on_edit_finished(window_data&, std::wstring_view) { }
 
 	};
 
@@ -1109,6 +1276,12 @@ namespace printui {
 		virtual ui_rectangle prototype_ui_rectangle(window_data const& win, uint8_t parent_foreground_index, uint8_t parent_background_index) override;
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return label_text.is_ready();
+		}
+		virtual std::optional<uint32_t> foreground_version() const override {
+			return label_text.content_version;
+		}
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
 		virtual void on_right_click(window_data&, uint32_t, uint32_t) override;
 		virtual accessibility_object* get_accessibility_interface(window_data&) override;
@@ -1251,6 +1424,9 @@ namespace printui {
 
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
+		virtual bool fills_background(ui_rectangle const& rect) const override {
+			return stored_page_total <= 1 || button_control_base::fills_background(rect);
+		}
 		virtual void button_action(window_data&);
 		virtual int32_t interactable_count(window_data const&) override;
 		void update_page(window_data const& win);
@@ -1419,6 +1595,9 @@ namespace printui {
 		virtual ui_rectangle prototype_ui_rectangle(window_data const& win, uint8_t parent_foreground_index, uint8_t parent_background_index) override;
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return text.is_ready();
+		}
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
 		virtual void recreate_contents(window_data&, layout_node&) override;
 		virtual void on_lose_focus(window_data&) override;
@@ -1448,6 +1627,12 @@ namespace printui {
 		}
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return text.is_ready();
+		}
+		virtual std::optional<uint32_t> foreground_version() const override {
+			return text.content_version;
+		}
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
 		virtual void recreate_contents(window_data&, layout_node&) override;
 		virtual accessibility_object* get_accessibility_interface(window_data&) override;
@@ -1478,6 +1663,12 @@ namespace printui {
 		}
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_foreground(ui_rectangle const& rect, window_data& win) override;
+		virtual bool data_is_ready() override {
+			return text.is_ready();
+		}
+		virtual std::optional<uint32_t> foreground_version() const override {
+			return text.content_version;
+		}
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
 		virtual void recreate_contents(window_data&, layout_node&) override;
 		virtual accessibility_object* get_accessibility_interface(window_data&) override;
@@ -1504,6 +1695,9 @@ namespace printui {
 		virtual ui_rectangle prototype_ui_rectangle(window_data const& win, uint8_t parent_foreground_index, uint8_t parent_background_index) override;
 		virtual simple_layout_specification get_specification(window_data&) override;
 		virtual void render_composite(ui_rectangle const& rect, window_data& win, bool under_mouse) override;
+		virtual bool fills_background(ui_rectangle const&) const override {
+			return false;
+		}
 	};
 
 	struct menu_control;
@@ -1586,7 +1780,7 @@ namespace printui {
 
 	struct ui_scale_edit : public editable_numeric_range {
 		ui_scale_edit() : editable_numeric_range(content_alignment::trailing, text_id::ui_scale_edit_name, text_id::ui_scale_info, 3, 1, 0.5f, 3.0f, 2) { }
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 
 	struct language_button : public button_control_base {
@@ -1645,7 +1839,7 @@ namespace printui {
 
 		font_stretch_edit(text_size text_sz) : editable_numeric_range(content_alignment::trailing, text_id::font_stretch_edit_name, text_id::font_stretch_info, 3, 1, 50.0f, 200.0f, 0), text_sz(text_sz) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 
 	struct font_weight_edit : public editable_numeric_range {
@@ -1653,7 +1847,7 @@ namespace printui {
 
 		font_weight_edit(text_size text_sz) : editable_numeric_range(content_alignment::trailing, text_id::font_weight_edit_name, text_id::font_weight_info, 3, 1, 100.0f, 900.0f, 0), text_sz(text_sz) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 
 	struct font_top_lead_edit : public editable_numeric_range {
@@ -1661,24 +1855,24 @@ namespace printui {
 
 		font_top_lead_edit(text_size text_sz) : editable_numeric_range(content_alignment::trailing, text_id::top_lead_edit_name, text_id::top_lead_edit_info, 3, 1, -20.0f, 20.0f, 0), text_sz(text_sz) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 	struct font_bottom_lead_edit : public editable_numeric_range {
 		text_size text_sz;
 
 		font_bottom_lead_edit(text_size text_sz) : editable_numeric_range(content_alignment::trailing, text_id::bottom_lead_edit_name, text_id::bottom_lead_edit_info, 3, 1, -20.0f, 20.0f, 0), text_sz(text_sz) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 	struct small_relative_size : public editable_numeric_range {
 		small_relative_size() : editable_numeric_range(content_alignment::trailing, text_id::relative_size_edit_name, text_id::relative_size_small_info, 3, 1, 0.5f, 1.0f, 3) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 	struct header_relative_size : public editable_numeric_range {
 		header_relative_size() : editable_numeric_range(content_alignment::trailing, text_id::relative_size_edit_name, text_id::relative_size_header_info, 3, 1, 1.0f, 2.0f, 3) {
 		}
-		virtual void on_edit_finished(window_data& win, std::wstring const&) override;
+		virtual void on_edit_finished(window_data& win, std::wstring_view) override;
 	};
 
 	struct font_italic_toggle_button : public button_control_toggle {
@@ -1721,7 +1915,7 @@ namespace printui {
 		key_name_edit(int32_t key) : key(key), simple_editable_text(content_alignment::trailing, text_id::keyboard_display_edit_name, text_id::keyboard_display_name_info, 6, 1) {
 		}
 
-		virtual void on_edit_finished(window_data&, std::wstring const&) override;
+		virtual void on_edit_finished(window_data&, std::wstring_view) override;
 	};
 	struct info_is_sticky_toggle_button : public button_control_toggle {
 		info_is_sticky_toggle_button() : button_control_toggle(text_id::generic_toggle_yes, text_id::generic_toggle_no, content_alignment::trailing, text_id::info_key_sticky_info) {
@@ -1741,13 +1935,13 @@ namespace printui {
 		deadzone_edit() : editable_numeric_range(content_alignment::trailing, text_id::deadzone_label, text_id::deadzone_info, 4, 1, 0.0f, 90.0f, 0) {
 		}
 
-		virtual void on_edit_finished(window_data&, std::wstring const&) override;
+		virtual void on_edit_finished(window_data&, std::wstring_view) override;
 	};
 	struct sensitivity_edit : public editable_numeric_range {
 		sensitivity_edit() : editable_numeric_range(content_alignment::trailing, text_id::sensitivity_label, text_id::sensitivity_info, 4, 1, 0.1f, 3.0f, 1) {
 		}
 
-		virtual void on_edit_finished(window_data&, std::wstring const&) override;
+		virtual void on_edit_finished(window_data&, std::wstring_view) override;
 	};
 	struct thumbstick_toggle_button : public button_control_toggle {
 		thumbstick_toggle_button() : button_control_toggle(text_id::thumbstick_left_name, text_id::thumbstick_right_name, content_alignment::trailing, text_id::thumbstick_info) {
@@ -2105,12 +2299,6 @@ namespace printui {
 	namespace text {
 		
 
-		class text_manager;
-		struct text_data_storage;
-
-		using attribute_type = int8_t;
-
-
 		// extra display formatting to apply to a range of characters
 		
 
@@ -2122,106 +2310,14 @@ namespace printui {
 		text_metrics get_metrics_at_position(arranged_text* txt, uint32_t position);
 		hit_test_metrics hit_test_text(arranged_text* txt, int32_t x, int32_t y);
 
-		struct replaceable_instance;
-		struct static_text_with_formatting;
-
-		// contains a string plus indices where formatting must be applied
-		struct text_with_formatting {
-			std::wstring text;
-			std::vector<format_marker> formatting;
-
-			text_with_formatting& operator+=(text_with_formatting const& other);
-			void append(text_data_storage const& tm, static_text_with_formatting const& other);
-			void make_substitutions(replaceable_instance const* start, replaceable_instance const* end);
-		};
-
-		// as above, but formatting and text itself are fixed after load
-		struct static_text_with_formatting {
-			uint32_t code_points_start;
-			uint16_t code_points_count;
-			uint16_t formatting_start;
-			uint16_t formatting_end;
-		};
-
-		// result of calling a text function, holds attributes
-		struct replaceable_instance {
-			static constexpr uint32_t max_attributes = 8;
-
-			text_with_formatting text_content;
-			std::array<attribute_type, max_attributes> attributes = { -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8 };
-		};
-
-		struct param_attribute_pair {
-			attribute_type attribute = -1i8;
-			uint8_t parameter_id = 0;
-		};
-
-		struct matched_pattern {
-			static_text_with_formatting base_text;
-			uint16_t match_key_start = 0;
-			uint8_t num_keys = 0;
-			uint8_t group = 0;
-
-			bool matches_parameters(text_data_storage const& tm, replaceable_instance const* param_start, replaceable_instance const* param_end) const;
-		};
-
-
-		// takes parameters -> fn or pattern match -> replaceable instance
-		struct text_function {
-			uint16_t begin_patterns = 0;
-			uint16_t pattern_count = 0;
-
-			// attributes assigend to results
-			std::array<attribute_type, replaceable_instance::max_attributes> attributes = { -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8 };
-
-			replaceable_instance instantiate(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end) const;
-		};
-
-
-		inline constexpr attribute_type zero = 0;
-		inline constexpr attribute_type one = 1;
-		inline constexpr attribute_type two = 2;
-		inline constexpr attribute_type few = 3;
-		inline constexpr attribute_type many = 4;
-		inline constexpr attribute_type other = 5;
-
-		inline constexpr attribute_type ord_zero = 6;
-		inline constexpr attribute_type ord_one = 7;
-		inline constexpr attribute_type ord_two = 8;
-		inline constexpr attribute_type ord_few = 9;
-		inline constexpr attribute_type ord_many = 10;
-		inline constexpr attribute_type ord_other = 11;
-
-		inline constexpr attribute_type last_predefined = 11;
-
-
-		using cardinal_plural_fn = attribute_type(*)(int64_t, int64_t, int32_t);
-		using ordinal_plural_fn = attribute_type(*)(int64_t);
-
-		struct text_data_storage {
-			std::wstring codepoint_storage;
-			std::vector<format_marker> static_format_storage;
-			std::vector<matched_pattern> static_matcher_storage;
-			std::vector<param_attribute_pair> match_keys_storage;
-			std::vector<text_function> stored_functions;
-
-			ankerl::unordered_dense::map<std::string, uint16_t> internal_text_name_map;
-			std::unordered_map<std::string, int8_t, string_hash, std::equal_to<>> attribute_name_to_id;
-			int8_t last_attribute_id_mapped = last_predefined;
-
-			std::string_view parse_match_conditions(std::string_view in);
-			std::string_view assemble_entry_content(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index, bool allow_match);
-			std::array<attribute_type, replaceable_instance::max_attributes> parse_attributes(std::string_view in);
-			std::string_view consume_single_entry(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index);
-			void consume_text_file(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index);
-		};
-
-		void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring const& str, bool ltr, text_manager const& tm);
-		void update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring const& str, bool ltr, text_manager const& tm);
-		int32_t left_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm);
-		int32_t right_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm);
+		void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring_view str, bool ltr, text_manager const& tm);
+		void update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring_view str, bool ltr, text_manager const& tm);
+		int32_t left_visual_cursor_position(text_analysis_object* ptr, int32_t position);
+		int32_t right_visual_cursor_position(text_analysis_object* ptr, int32_t position);
 
 		class text_manager {
+		public:
+			static constexpr uint32_t max_instantiation_parameters = 10;
 		private:
 			text_data_storage text_data;
 
@@ -2231,22 +2327,19 @@ namespace printui {
 			bool os_locale_is_default = true;
 
 			// for filling in number format
-			uint32_t  LeadingZero;
-			uint32_t  Grouping;
-			wchar_t lpDecimalSep[5];
-			wchar_t lpThousandSep[5];
-			uint32_t  NegativeOrder;
+			number_format number_fmt;
 			uint32_t lcid;
 
 
-			std::unordered_map<std::wstring_view, cardinal_plural_fn> cardinal_functions;
-			std::unordered_map<std::wstring_view, ordinal_plural_fn> ordinal_functions;
-
 			cardinal_plural_fn cardinal_classification = nullptr;
 			ordinal_plural_fn ordinal_classification = nullptr;
 
+			mutable instantiation_cache instantiation_results;
+
 			void load_text_from_directory(window_data const& win, std::wstring const& directory);
-			replaceable_instance parameter_to_text(text_parameter p) const;
+			void parameter_to_text(text_parameter p, replaceable_instance& out) const;
+			void format_int_into(int64_t value, uint32_t decimal_places, replaceable_instance& out) const;
+			void format_double_into(double value, uint32_t decimal_places, replaceable_instance& out) const;
 		public:
 			uint8_t text_generation = 0;
 
@@ -2281,10 +2374,13 @@ namespace printui {
 
 			replaceable_instance instantiate_text(uint16_t id, text_parameter const* s = nullptr, text_parameter const* e = nullptr) const;
 			replaceable_instance instantiate_text(std::string_view key, text_parameter const* s = nullptr, text_parameter const* e = nullptr) const;
+			// as above, but reuses the buffers of out and of the converted parameters; prefer this where text is instantiated repeatedly
+			void instantiate_text_into(uint16_t id, text_with_formatting& out, text_parameter const* s = nullptr, text_parameter const* e = nullptr) const;
+			// as above, but remembers the result until the text content is next populated; for text that is requested again and again
+			void instantiate_text_cached(uint16_t id, text_with_formatting& out, text_parameter const* s = nullptr, text_parameter const* e = nullptr) const;
+			instantiation_cache_counters instantiation_cache_statistics() const;
 
-			friend void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring const& str, bool ltr, text_manager const& tm);
-			friend int32_t left_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm);
-			friend int32_t right_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm);
+			friend void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring_view str, bool ltr, text_manager const& tm);
 		};
 
 		struct language_description {
@@ -2294,15 +2390,6 @@ namespace printui {
 		};
 		std::vector<language_description> ennumerate_languages(window_data const& win);
 
-		struct surrogate_pair {
-			uint16_t high = 0; // aka leading
-			uint16_t low = 0; // aka trailing
-		};
-
-		uint32_t assemble_codepoint(uint16_t high, uint16_t low) noexcept;
-		surrogate_pair make_surrogate_pair(uint32_t val) noexcept;
-		bool is_low_surrogate(uint16_t char_code) noexcept;
-		bool is_high_surrogate(uint16_t char_code) noexcept;
 		int32_t num_logical_chars_in_range(std::wstring_view str);
 		bool cursor_ignorable16(uint16_t at_position, uint16_t trailing);
 		bool is_space(uint32_t c) noexcept;
@@ -2325,29 +2412,29 @@ namespace printui {
 		int32_t end_of_line(text_analysis_object* ptr, int32_t line);
 	}
 	
+	// one step of a control's edit history: the change itself, and the selection before and after it
 	struct undo_item {
 		edit_interface* from = nullptr;
-		std::wstring contents;
-		int32_t anchor = 0;
-		int32_t cursor = 0;
-
-		bool operator==(undo_item const& o) const noexcept {
-			return from == o.from && contents == o.contents;
-		}
-		bool operator!=(undo_item const& o) const noexcept {
-			return !(*this == o);
-		}
+		text::text_edit change;
+		int32_t anchor_before = 0;
+		int32_t cursor_before = 0;
+		int32_t anchor_after = 0;
+		int32_t cursor_after = 0;
 	};
 
+	// the most recent changes, from any control; undo and redo move through them only while they belong to the asking control
 	struct undo_buffer {
 		constexpr static int32_t total_size = 16;
 
 		undo_item interal_buffer[total_size] = {};
 		int32_t buffer_position = 0;
 
-		std::optional<undo_item> undo(undo_item current_state);
-		std::optional<undo_item> redo(undo_item current_state);
-		void push_state(undo_item state);
+		// the change to reverse, if the latest change not yet undone was made by from
+		std::optional<undo_item> undo(edit_interface* from);
+		// the change to make again, if the earliest change undone was made by from
+		std::optional<undo_item> redo(edit_interface* from);
+		// discards the changes that were undone
+		void push_change(undo_item change);
 	};
 
 	
@@ -2470,6 +2557,7 @@ namespace printui {
 		void on_controller_input();
 		void on_device_change(uint64_t status, void* handle);
 		bool on_mouse_wheel(int32_t quantity);
+		void on_text_arrangements_ready();
 
 		// OTHER
 
@@ -2633,6 +2721,66 @@ namespace printui {
 	void populate_key_mappings_by_type(key_mappings& k);
 	wchar_t const* to_label(controller_button b);
 	uint32_t to_bitmask(controller_button b);
+
+	struct golden_image_result {
+		std::wstring scene;
+		image_comparison comparison;
+		uint32_t render_microseconds = 0; // the median of the timed renders
+		uint32_t baseline_microseconds = 0;
+		bool golden_missing = false;
+		bool golden_written = false; // the capture became the new golden
+		bool baseline_missing = false;
+		bool baseline_written = false; // the median became the new baseline
+		bool too_slow = false; // the median exceeded the baseline by more than the allowed ratio
+
+		// a scene without a golden or a baseline only passes when one was written for it
+		bool image_passed() const {
+			return golden_written || (!golden_missing && comparison.matches());
+		}
+		bool timing_passed() const {
+			return baseline_written || (!baseline_missing && !too_slow);
+		}
+		bool passed() const {
+			return image_passed() && timing_passed();
+		}
+	};
+
+	// the draw calls of one scene rendered with and without the background fills of alike neighbors merged; the
+	// two renders must look the same, and merging must save draw calls
+	struct background_merge_result {
+		std::wstring scene;
+		image_comparison comparison;
+		uint32_t merged_draw_calls = 0;
+		uint32_t unmerged_draw_calls = 0;
+
+		bool passed() const {
+			return comparison.matches() && merged_draw_calls < unmerged_draw_calls;
+		}
+	};
+
+	struct golden_image_report {
+		std::vector<golden_image_result> scenes;
+		std::vector<background_merge_result> background_merging; // for the settings page in each orientation
+	};
+
+	// --golden-images <directory> [--golden-tolerance <n>] [--timing-renders <n>] [--timing-tolerance <ratio>]
+	// [--update-goldens] on the command line
+	struct golden_image_options {
+		std::wstring directory;
+		uint32_t channel_tolerance = 2;
+		uint32_t timing_renders = 9; // timed after one untimed render
+		float timing_tolerance = 1.5f; // how many times its baseline the median render of a scene may take
+		bool update_goldens = false;
+	};
+	std::optional<golden_image_options> golden_image_options_from_arguments(int argc, wchar_t const* const* argv);
+
+	// renders each test scene offscreen and compares it against <directory>\<scene>.png, and the median time of
+	// its renders against the microseconds in <directory>\<scene>.time; when a scene differs, the captured image
+	// and a diff image are written beside the golden file. With update_goldens, a capture replaces a golden that
+	// differs or is missing, and a median replaces a baseline that it exceeds or that is missing
+	golden_image_report run_golden_image_suite(window_data& win, golden_image_options const& options);
+	// runs the suite, writes <directory>\golden_report.txt and returns the number of checks that did not pass
+	uint32_t run_golden_image_check(window_data& win, golden_image_options const& options);
 	
 }
 
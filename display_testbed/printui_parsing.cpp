@@ -651,6 +651,22 @@ namespace printui::parse {
 						else if(val == "no" || val == "n" || val == "NO" || val == "N" || val == "false")
 							ls.locale_is_default = false;
 					}
+				} else if(kstr == "compact_text") {
+					if(extracted.values.size() >= 1) {
+						const auto val = extracted.values[0].to_string();
+						if(val == "yes" || val == "y" || val == "YES" || val == "Y" || val == "true")
+							ls.compact_text = true;
+						else if(val == "no" || val == "n" || val == "NO" || val == "N" || val == "false")
+							ls.compact_text = false;
+					}
+				} else if(kstr == "frame_profiling") {
+					if(extracted.values.size() >= 1) {
+						const auto val = extracted.values[0].to_string();
+						if(val == "yes" || val == "y" || val == "YES" || val == "Y" || val == "true")
+							ls.frame_profiling = true;
+						else if(val == "no" || val == "n" || val == "NO" || val == "N" || val == "false")
+							ls.frame_profiling = false;
+					}
 				} else if(kstr == "global_size_multiplier") {
 					if(extracted.values.size() >= 1) {
 						ls.global_size_multiplier = std::stof(std::string(extracted.values[0].to_string()));
@@ -1052,6 +1068,8 @@ namespace printui::parse {
 		result += "icon_directory{ " + to_string(ls.icon_directory) + " }\n";
 		result += "animation_speed_multiplier{ " + std::to_string(ls.animation_speed_multiplier) + " }\n";
 		result += "locale_is_default{ " + std::string(ls.locale_is_default ? "yes" : "no") + " }\n";
+		result += "compact_text{ " + std::string(ls.compact_text ? "yes" : "no") + " }\n";
+		result += "frame_profiling{ " + std::string(ls.frame_profiling ? "yes" : "no") + " }\n";
 		result += "global_size_multiplier{ " + std::to_string(ls.global_size_multiplier) + " }\n";
 		result += "small_size_multiplier{ " + std::to_string(ls.small_size_multiplier) + " }\n";
 		result += "heading_size_multiplier{ " + std::to_string(ls.heading_size_multiplier) + " }\n";
@@ -0,0 +1,998 @@
+#ifndef PRINTUI_PLURAL_RULES_HEADER
+#define PRINTUI_PLURAL_RULES_HEADER
+
+// generated by plural_rule_generator.cpp from cldr 42 (icu 72.1); do not edit
+
+#include "printui_text_data_definitions.hpp"
+
+#include <cstdlib>
+#include <string_view>
+
+namespace printui::text::plural_rules {
+	// a number is given as its integer digits i, its visible fraction digits f as an integer, and their count v
+	inline int64_t fraction_without_zeros(int64_t f) {
+		while(f != 0 && f % 10 == 0)
+			f /= 10;
+		return f;
+	}
+	inline int32_t digits_without_zeros(int64_t f, int32_t v) {
+		if(f == 0)
+			return 0;
+		while(f % 10 == 0) {
+			f /= 10;
+			--v;
+		}
+		return v;
+	}
+
+	inline attribute_type cardinal_af(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ak(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 0..1
+		if(f == 0 && (i >= 0 && i <= 1))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_am(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: i = 0 or n = 1
+		if(i == 0 || (f == 0 && i == 1))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ar(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n % 100 = 3..10
+		if(f == 0 && (i % 100 >= 3 && i % 100 <= 10))
+			return text::few;
+		// many: n % 100 = 11..99
+		if(f == 0 && (i % 100 >= 11 && i % 100 <= 99))
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n = 2
+		if(f == 0 && i == 2)
+			return text::two;
+		// zero: n = 0
+		if(f == 0 && i == 0)
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ast(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// one: i = 1 and v = 0
+		if(i == 1 && v == 0)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_be(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n % 10 = 2..4 and n % 100 != 12..14
+		if(f == 0 && (i % 10 >= 2 && i % 10 <= 4) && !(f == 0 && (i % 100 >= 12 && i % 100 <= 14)))
+			return text::few;
+		// many: n % 10 = 0 or n % 10 = 5..9 or n % 100 = 11..14
+		if((f == 0 && i % 10 == 0) || (f == 0 && (i % 10 >= 5 && i % 10 <= 9)) || (f == 0 && (i % 100 >= 11 && i % 100 <= 14)))
+			return text::many;
+		// one: n % 10 = 1 and n % 100 != 11
+		if(f == 0 && i % 10 == 1 && !(f == 0 && i % 100 == 11))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_br(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n % 10 = 3..4,9 and n % 100 != 10..19,70..79,90..99
+		if((f == 0 && ((i % 10 >= 3 && i % 10 <= 4) || i % 10 == 9)) && !(f == 0 && ((i % 100 >= 10 && i % 100 <= 19) || (i % 100 >= 70 && i % 100 <= 79) || (i % 100 >= 90 && i % 100 <= 99))))
+			return text::few;
+		// many: n != 0 and n % 1000000 = 0
+		if(!(f == 0 && i == 0) && f == 0 && i % 1000000 == 0)
+			return text::many;
+		// one: n % 10 = 1 and n % 100 != 11,71,91
+		if(f == 0 && i % 10 == 1 && !(f == 0 && (i % 100 == 11 || i % 100 == 71 || i % 100 == 91)))
+			return text::one;
+		// two: n % 10 = 2 and n % 100 != 12,72,92
+		if(f == 0 && i % 10 == 2 && !(f == 0 && (i % 100 == 12 || i % 100 == 72 || i % 100 == 92)))
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_bs(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 10 = 2..4 and i % 100 != 12..14 or f % 10 = 2..4 and f % 100 != 12..14
+		if((v == 0 && (i % 10 >= 2 && i % 10 <= 4) && !(i % 100 >= 12 && i % 100 <= 14)) || ((f % 10 >= 2 && f % 10 <= 4) && !(f % 100 >= 12 && f % 100 <= 14)))
+			return text::few;
+		// one: v = 0 and i % 10 = 1 and i % 100 != 11 or f % 10 = 1 and f % 100 != 11
+		if((v == 0 && i % 10 == 1 && i % 100 != 11) || (f % 10 == 1 && f % 100 != 11))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ca(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// many: e = 0 and i != 0 and i % 1000000 = 0 and v = 0 or e != 0..5
+		if(i != 0 && i % 1000000 == 0 && v == 0)
+			return text::many;
+		// one: i = 1 and v = 0
+		if(i == 1 && v == 0)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ceb(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// one: v = 0 and i = 1,2,3 or v = 0 and i % 10 != 4,6,9 or v != 0 and f % 10 != 4,6,9
+		if((v == 0 && (i == 1 || i == 2 || i == 3)) || (v == 0 && !(i % 10 == 4 || i % 10 == 6 || i % 10 == 9)) || (v != 0 && !(f % 10 == 4 || f % 10 == 6 || f % 10 == 9)))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_cs(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// few: i = 2..4 and v = 0
+		if((i >= 2 && i <= 4) && v == 0)
+			return text::few;
+		// many: v != 0
+		if(v != 0)
+			return text::many;
+		// one: i = 1 and v = 0
+		if(i == 1 && v == 0)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_cy(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n = 3
+		if(f == 0 && i == 3)
+			return text::few;
+		// many: n = 6
+		if(f == 0 && i == 6)
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n = 2
+		if(f == 0 && i == 2)
+			return text::two;
+		// zero: n = 0
+		if(f == 0 && i == 0)
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_da(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		auto const t = fraction_without_zeros(f);
+		// one: n = 1 or t != 0 and i = 0,1
+		if((f == 0 && i == 1) || (t != 0 && (i == 0 || i == 1)))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_dsb(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 100 = 3..4 or f % 100 = 3..4
+		if((v == 0 && (i % 100 >= 3 && i % 100 <= 4)) || ((f % 100 >= 3 && f % 100 <= 4)))
+			return text::few;
+		// one: v = 0 and i % 100 = 1 or f % 100 = 1
+		if((v == 0 && i % 100 == 1) || f % 100 == 1)
+			return text::one;
+		// two: v = 0 and i % 100 = 2 or f % 100 = 2
+		if((v == 0 && i % 100 == 2) || f % 100 == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_es(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// many: e = 0 and i != 0 and i % 1000000 = 0 and v = 0 or e != 0..5
+		if(i != 0 && i % 1000000 == 0 && v == 0)
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ff(int64_t i, int64_t , int32_t ) {
+		i = std::abs(i);
+		// one: i = 0,1
+		if(i == 0 || i == 1)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_fr(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// many: e = 0 and i != 0 and i % 1000000 = 0 and v = 0 or e != 0..5
+		if(i != 0 && i % 1000000 == 0 && v == 0)
+			return text::many;
+		// one: i = 0,1
+		if(i == 0 || i == 1)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ga(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n = 3..6
+		if(f == 0 && (i >= 3 && i <= 6))
+			return text::few;
+		// many: n = 7..10
+		if(f == 0 && (i >= 7 && i <= 10))
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n = 2
+		if(f == 0 && i == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_gd(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n = 3..10,13..19
+		if(f == 0 && ((i >= 3 && i <= 10) || (i >= 13 && i <= 19)))
+			return text::few;
+		// one: n = 1,11
+		if(f == 0 && (i == 1 || i == 11))
+			return text::one;
+		// two: n = 2,12
+		if(f == 0 && (i == 2 || i == 12))
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_gv(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 100 = 0,20,40,60,80
+		if(v == 0 && (i % 100 == 0 || i % 100 == 20 || i % 100 == 40 || i % 100 == 60 || i % 100 == 80))
+			return text::few;
+		// many: v != 0
+		if(v != 0)
+			return text::many;
+		// one: v = 0 and i % 10 = 1
+		if(v == 0 && i % 10 == 1)
+			return text::one;
+		// two: v = 0 and i % 10 = 2
+		if(v == 0 && i % 10 == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_he(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// one: i = 1 and v = 0 or i = 0 and v != 0
+		if((i == 1 && v == 0) || (i == 0 && v != 0))
+			return text::one;
+		// two: i = 2 and v = 0
+		if(i == 2 && v == 0)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_is(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		auto const t = fraction_without_zeros(f);
+		// one: t = 0 and i % 10 = 1 and i % 100 != 11 or t % 10 = 1 and t % 100 != 11
+		if((t == 0 && i % 10 == 1 && i % 100 != 11) || (t % 10 == 1 && t % 100 != 11))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_iu(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n = 2
+		if(f == 0 && i == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ksh(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// zero: n = 0
+		if(f == 0 && i == 0)
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_kw(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n % 100 = 3,23,43,63,83
+		if(f == 0 && (i % 100 == 3 || i % 100 == 23 || i % 100 == 43 || i % 100 == 63 || i % 100 == 83))
+			return text::few;
+		// many: n != 1 and n % 100 = 1,21,41,61,81
+		if(!(f == 0 && i == 1) && (f == 0 && (i % 100 == 1 || i % 100 == 21 || i % 100 == 41 || i % 100 == 61 || i % 100 == 81)))
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n % 100 = 2,22,42,62,82 or n % 1000 = 0 and n % 100000 = 1000..20000,40000,60000,80000 or n != 0 and n % 1000000 = 100000
+		if((f == 0 && (i % 100 == 2 || i % 100 == 22 || i % 100 == 42 || i % 100 == 62 || i % 100 == 82)) || (f == 0 && i % 1000 == 0 && (f == 0 && ((i % 100000 >= 1000 && i % 100000 <= 20000) || i % 100000 == 40000 || i % 100000 == 60000 || i % 100000 == 80000))) || (!(f == 0 && i == 0) && f == 0 && i % 1000000 == 100000))
+			return text::two;
+		// zero: n = 0
+		if(f == 0 && i == 0)
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_lag(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: i = 0,1 and n != 0
+		if((i == 0 || i == 1) && !(f == 0 && i == 0))
+			return text::one;
+		// zero: n = 0
+		if(f == 0 && i == 0)
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_lt(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n % 10 = 2..9 and n % 100 != 11..19
+		if(f == 0 && (i % 10 >= 2 && i % 10 <= 9) && !(f == 0 && (i % 100 >= 11 && i % 100 <= 19)))
+			return text::few;
+		// many: f != 0
+		if(f != 0)
+			return text::many;
+		// one: n % 10 = 1 and n % 100 != 11..19
+		if(f == 0 && i % 10 == 1 && !(f == 0 && (i % 100 >= 11 && i % 100 <= 19)))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_lv(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// one: n % 10 = 1 and n % 100 != 11 or v = 2 and f % 10 = 1 and f % 100 != 11 or v != 2 and f % 10 = 1
+		if((f == 0 && i % 10 == 1 && !(f == 0 && i % 100 == 11)) || (v == 2 && f % 10 == 1 && f % 100 != 11) || (v != 2 && f % 10 == 1))
+			return text::one;
+		// zero: n % 10 = 0 or n % 100 = 11..19 or v = 2 and f % 100 = 11..19
+		if((f == 0 && i % 10 == 0) || (f == 0 && (i % 100 >= 11 && i % 100 <= 19)) || (v == 2 && (f % 100 >= 11 && f % 100 <= 19)))
+			return text::zero;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_mk(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// one: v = 0 and i % 10 = 1 and i % 100 != 11 or f % 10 = 1 and f % 100 != 11
+		if((v == 0 && i % 10 == 1 && i % 100 != 11) || (f % 10 == 1 && f % 100 != 11))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_mo(int64_t i, int64_t f, int32_t v) {
+		i = std::abs(i);
+		// few: v != 0 or n = 0 or n != 1 and n % 100 = 1..19
+		if(v != 0 || (f == 0 && i == 0) || (!(f == 0 && i == 1) && f == 0 && (i % 100 >= 1 && i % 100 <= 19)))
+			return text::few;
+		// one: i = 1 and v = 0
+		if(i == 1 && v == 0)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_mt(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n = 0 or n % 100 = 3..10
+		if((f == 0 && i == 0) || (f == 0 && (i % 100 >= 3 && i % 100 <= 10)))
+			return text::few;
+		// many: n % 100 = 11..19
+		if(f == 0 && (i % 100 >= 11 && i % 100 <= 19))
+			return text::many;
+		// one: n = 1
+		if(f == 0 && i == 1)
+			return text::one;
+		// two: n = 2
+		if(f == 0 && i == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_pl(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 10 = 2..4 and i % 100 != 12..14
+		if(v == 0 && (i % 10 >= 2 && i % 10 <= 4) && !(i % 100 >= 12 && i % 100 <= 14))
+			return text::few;
+		// many: v = 0 and i != 1 and i % 10 = 0..1 or v = 0 and i % 10 = 5..9 or v = 0 and i % 100 = 12..14
+		if((v == 0 && i != 1 && (i % 10 >= 0 && i % 10 <= 1)) || (v == 0 && (i % 10 >= 5 && i % 10 <= 9)) || (v == 0 && (i % 100 >= 12 && i % 100 <= 14)))
+			return text::many;
+		// one: i = 1 and v = 0
+		if(i == 1 && v == 0)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_pt(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// many: e = 0 and i != 0 and i % 1000000 = 0 and v = 0 or e != 0..5
+		if(i != 0 && i % 1000000 == 0 && v == 0)
+			return text::many;
+		// one: i = 0..1
+		if(i >= 0 && i <= 1)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_ru(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 10 = 2..4 and i % 100 != 12..14
+		if(v == 0 && (i % 10 >= 2 && i % 10 <= 4) && !(i % 100 >= 12 && i % 100 <= 14))
+			return text::few;
+		// many: v = 0 and i % 10 = 0 or v = 0 and i % 10 = 5..9 or v = 0 and i % 100 = 11..14
+		if((v == 0 && i % 10 == 0) || (v == 0 && (i % 10 >= 5 && i % 10 <= 9)) || (v == 0 && (i % 100 >= 11 && i % 100 <= 14)))
+			return text::many;
+		// one: v = 0 and i % 10 = 1 and i % 100 != 11
+		if(v == 0 && i % 10 == 1 && i % 100 != 11)
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_shi(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// few: n = 2..10
+		if(f == 0 && (i >= 2 && i <= 10))
+			return text::few;
+		// one: i = 0 or n = 1
+		if(i == 0 || (f == 0 && i == 1))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_si(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 0,1 or i = 0 and f = 1
+		if((f == 0 && (i == 0 || i == 1)) || (i == 0 && f == 1))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_sl(int64_t i, int64_t , int32_t v) {
+		i = std::abs(i);
+		// few: v = 0 and i % 100 = 3..4 or v != 0
+		if((v == 0 && (i % 100 >= 3 && i % 100 <= 4)) || v != 0)
+			return text::few;
+		// one: v = 0 and i % 100 = 1
+		if(v == 0 && i % 100 == 1)
+			return text::one;
+		// two: v = 0 and i % 100 = 2
+		if(v == 0 && i % 100 == 2)
+			return text::two;
+		return text::other;
+	}
+
+	inline attribute_type cardinal_tzm(int64_t i, int64_t f, int32_t ) {
+		i = std::abs(i);
+		// one: n = 0..1 or n = 11..99
+		if((f == 0 && (i >= 0 && i <= 1)) || (f == 0 && (i >= 11 && i <= 99)))
+			return text::one;
+		return text::other;
+	}
+
+	inline attribute_type ordinal_as(int64_t i) {
+		i = std::abs(i);
+		// few: n = 4
+		if(i == 4)
+			return text::ord_few;
+		// many: n = 6
+		if(i == 6)
+			return text::ord_many;
+		// one: n = 1,5,7,8,9,10
+		if(i == 1 || i == 5 || i == 7 || i == 8 || i == 9 || i == 10)
+			return text::ord_one;
+		// two: n = 2,3
+		if(i == 2 || i == 3)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_az(int64_t i) {
+		i = std::abs(i);
+		// few: i % 10 = 3,4 or i % 1000 = 100,200,300,400,500,600,700,800,900
+		if((i % 10 == 3 || i % 10 == 4) || (i % 1000 == 100 || i % 1000 == 200 || i % 1000 == 300 || i % 1000 == 400 || i % 1000 == 500 || i % 1000 == 600 || i % 1000 == 700 || i % 1000 == 800 || i % 1000 == 900))
+			return text::ord_few;
+		// many: i = 0 or i % 10 = 6 or i % 100 = 40,60,90
+		if(i == 0 || i % 10 == 6 || (i % 100 == 40 || i % 100 == 60 || i % 100 == 90))
+			return text::ord_many;
+		// one: i % 10 = 1,2,5,7,8 or i % 100 = 20,50,70,80
+		if((i % 10 == 1 || i % 10 == 2 || i % 10 == 5 || i % 10 == 7 || i % 10 == 8) || (i % 100 == 20 || i % 100 == 50 || i % 100 == 70 || i % 100 == 80))
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_bal(int64_t i) {
+		i = std::abs(i);
+		// one: n = 1
+		if(i == 1)
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_be(int64_t i) {
+		i = std::abs(i);
+		// few: n % 10 = 2,3 and n % 100 != 12,13
+		if((i % 10 == 2 || i % 10 == 3) && !(i % 100 == 12 || i % 100 == 13))
+			return text::ord_few;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_ca(int64_t i) {
+		i = std::abs(i);
+		// few: n = 4
+		if(i == 4)
+			return text::ord_few;
+		// one: n = 1,3
+		if(i == 1 || i == 3)
+			return text::ord_one;
+		// two: n = 2
+		if(i == 2)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_cy(int64_t i) {
+		i = std::abs(i);
+		// few: n = 3,4
+		if(i == 3 || i == 4)
+			return text::ord_few;
+		// many: n = 5,6
+		if(i == 5 || i == 6)
+			return text::ord_many;
+		// one: n = 1
+		if(i == 1)
+			return text::ord_one;
+		// two: n = 2
+		if(i == 2)
+			return text::ord_two;
+		// zero: n = 0,7,8,9
+		if(i == 0 || i == 7 || i == 8 || i == 9)
+			return text::ord_zero;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_en(int64_t i) {
+		i = std::abs(i);
+		// few: n % 10 = 3 and n % 100 != 13
+		if(i % 10 == 3 && i % 100 != 13)
+			return text::ord_few;
+		// one: n % 10 = 1 and n % 100 != 11
+		if(i % 10 == 1 && i % 100 != 11)
+			return text::ord_one;
+		// two: n % 10 = 2 and n % 100 != 12
+		if(i % 10 == 2 && i % 100 != 12)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_gd(int64_t i) {
+		i = std::abs(i);
+		// few: n = 3,13
+		if(i == 3 || i == 13)
+			return text::ord_few;
+		// one: n = 1,11
+		if(i == 1 || i == 11)
+			return text::ord_one;
+		// two: n = 2,12
+		if(i == 2 || i == 12)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_gu(int64_t i) {
+		i = std::abs(i);
+		// few: n = 4
+		if(i == 4)
+			return text::ord_few;
+		// many: n = 6
+		if(i == 6)
+			return text::ord_many;
+		// one: n = 1
+		if(i == 1)
+			return text::ord_one;
+		// two: n = 2,3
+		if(i == 2 || i == 3)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_hu(int64_t i) {
+		i = std::abs(i);
+		// one: n = 1,5
+		if(i == 1 || i == 5)
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_it(int64_t i) {
+		i = std::abs(i);
+		// many: n = 11,8,80,800
+		if(i == 11 || i == 8 || i == 80 || i == 800)
+			return text::ord_many;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_ka(int64_t i) {
+		i = std::abs(i);
+		// many: i = 0 or i % 100 = 2..20,40,60,80
+		if(i == 0 || (((i % 100 >= 2 && i % 100 <= 20) || i % 100 == 40 || i % 100 == 60 || i % 100 == 80)))
+			return text::ord_many;
+		// one: i = 1
+		if(i == 1)
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_kk(int64_t i) {
+		i = std::abs(i);
+		// many: n % 10 = 6 or n % 10 = 9 or n % 10 = 0 and n != 0
+		if(i % 10 == 6 || i % 10 == 9 || (i % 10 == 0 && i != 0))
+			return text::ord_many;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_kw(int64_t i) {
+		i = std::abs(i);
+		// many: n = 5 or n % 100 = 5
+		if(i == 5 || i % 100 == 5)
+			return text::ord_many;
+		// one: n = 1..4 or n % 100 = 1..4,21..24,41..44,61..64,81..84
+		if(((i >= 1 && i <= 4)) || (((i % 100 >= 1 && i % 100 <= 4) || (i % 100 >= 21 && i % 100 <= 24) || (i % 100 >= 41 && i % 100 <= 44) || (i % 100 >= 61 && i % 100 <= 64) || (i % 100 >= 81 && i % 100 <= 84))))
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_lij(int64_t i) {
+		i = std::abs(i);
+		// many: n = 11,8,80..89,800..899
+		if(i == 11 || i == 8 || (i >= 80 && i <= 89) || (i >= 800 && i <= 899))
+			return text::ord_many;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_mk(int64_t i) {
+		i = std::abs(i);
+		// many: i % 10 = 7,8 and i % 100 != 17,18
+		if((i % 10 == 7 || i % 10 == 8) && !(i % 100 == 17 || i % 100 == 18))
+			return text::ord_many;
+		// one: i % 10 = 1 and i % 100 != 11
+		if(i % 10 == 1 && i % 100 != 11)
+			return text::ord_one;
+		// two: i % 10 = 2 and i % 100 != 12
+		if(i % 10 == 2 && i % 100 != 12)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_mr(int64_t i) {
+		i = std::abs(i);
+		// few: n = 4
+		if(i == 4)
+			return text::ord_few;
+		// one: n = 1
+		if(i == 1)
+			return text::ord_one;
+		// two: n = 2,3
+		if(i == 2 || i == 3)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_ne(int64_t i) {
+		i = std::abs(i);
+		// one: n = 1..4
+		if(i >= 1 && i <= 4)
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_or(int64_t i) {
+		i = std::abs(i);
+		// few: n = 4
+		if(i == 4)
+			return text::ord_few;
+		// many: n = 6
+		if(i == 6)
+			return text::ord_many;
+		// one: n = 1,5,7..9
+		if(i == 1 || i == 5 || (i >= 7 && i <= 9))
+			return text::ord_one;
+		// two: n = 2,3
+		if(i == 2 || i == 3)
+			return text::ord_two;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_sq(int64_t i) {
+		i = std::abs(i);
+		// many: n % 10 = 4 and n % 100 != 14
+		if(i % 10 == 4 && i % 100 != 14)
+			return text::ord_many;
+		// one: n = 1
+		if(i == 1)
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_sv(int64_t i) {
+		i = std::abs(i);
+		// one: n % 10 = 1,2 and n % 100 != 11,12
+		if((i % 10 == 1 || i % 10 == 2) && !(i % 100 == 11 || i % 100 == 12))
+			return text::ord_one;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_tk(int64_t i) {
+		i = std::abs(i);
+		// few: n % 10 = 6,9 or n = 10
+		if((i % 10 == 6 || i % 10 == 9) || i == 10)
+			return text::ord_few;
+		return text::ord_other;
+	}
+
+	inline attribute_type ordinal_uk(int64_t i) {
+		i = std::abs(i);
+		// few: n % 10 = 3 and n % 100 != 13
+		if(i % 10 == 3 && i % 100 != 13)
+			return text::ord_few;
+		return text::ord_other;
+	}
+
+	struct cardinal_rule {
+		std::wstring_view locale;
+		cardinal_plural_fn fn;
+	};
+	struct ordinal_rule {
+		std::wstring_view locale;
+		ordinal_plural_fn fn;
+	};
+
+	// sorted by locale; locales not listed have only the other category
+
+	inline constexpr cardinal_rule cardinal_rules[184] = {
+		{ L"af", cardinal_af },
+		{ L"ak", cardinal_ak },
+		{ L"am", cardinal_am },
+		{ L"an", cardinal_af },
+		{ L"ar", cardinal_ar },
+		{ L"ars", cardinal_ar },
+		{ L"as", cardinal_am },
+		{ L"asa", cardinal_af },
+		{ L"ast", cardinal_ast },
+		{ L"az", cardinal_af },
+		{ L"bal", cardinal_af },
+		{ L"be", cardinal_be },
+		{ L"bem", cardinal_af },
+		{ L"bez", cardinal_af },
+		{ L"bg", cardinal_af },
+		{ L"bho", cardinal_ak },
+		{ L"bn", cardinal_am },
+		{ L"br", cardinal_br },
+		{ L"brx", cardinal_af },
+		{ L"bs", cardinal_bs },
+		{ L"ca", cardinal_ca },
+		{ L"ce", cardinal_af },
+		{ L"ceb", cardinal_ceb },
+		{ L"cgg", cardinal_af },
+		{ L"chr", cardinal_af },
+		{ L"ckb", cardinal_af },
+		{ L"cs", cardinal_cs },
+		{ L"cy", cardinal_cy },
+		{ L"da", cardinal_da },
+		{ L"de", cardinal_ast },
+		{ L"doi", cardinal_am },
+		{ L"dsb", cardinal_dsb },
+		{ L"dv", cardinal_af },
+		{ L"ee", cardinal_af },
+		{ L"el", cardinal_af },
+		{ L"en", cardinal_ast },
+		{ L"eo", cardinal_af },
+		{ L"es", cardinal_es },
+		{ L"et", cardinal_ast },
+		{ L"eu", cardinal_af },
+		{ L"fa", cardinal_am },
+		{ L"ff", cardinal_ff },
+		{ L"fi", cardinal_ast },
+		{ L"fil", cardinal_ceb },
+		{ L"fo", cardinal_af },
+		{ L"fr", cardinal_fr },
+		{ L"fur", cardinal_af },
+		{ L"fy", cardinal_ast },
+		{ L"ga", cardinal_ga },
+		{ L"gd", cardinal_gd },
+		{ L"gl", cardinal_ast },
+		{ L"gsw", cardinal_af },
+		{ L"gu", cardinal_am },
+		{ L"guw", cardinal_ak },
+		{ L"gv", cardinal_gv },
+		{ L"ha", cardinal_af },
+		{ L"haw", cardinal_af },
+		{ L"he", cardinal_he },
+		{ L"hi", cardinal_am },
+		{ L"hr", cardinal_bs },
+		{ L"hsb", cardinal_dsb },
+		{ L"hu", cardinal_af },
+		{ L"hy", cardinal_ff },
+		{ L"ia", cardinal_ast },
+		{ L"io", cardinal_ast },
+		{ L"is", cardinal_is },
+		{ L"it", cardinal_ca },
+		{ L"iu", cardinal_iu },
+		{ L"iw", cardinal_he },
+		{ L"jgo", cardinal_af },
+		{ L"ji", cardinal_ast },
+		{ L"jmc", cardinal_af },
+		{ L"ka", cardinal_af },
+		{ L"kab", cardinal_ff },
+		{ L"kaj", cardinal_af },
+		{ L"kcg", cardinal_af },
+		{ L"kk", cardinal_af },
+		{ L"kkj", cardinal_af },
+		{ L"kl", cardinal_af },
+		{ L"kn", cardinal_am },
+		{ L"ks", cardinal_af },
+		{ L"ksb", cardinal_af },
+		{ L"ksh", cardinal_ksh },
+		{ L"ku", cardinal_af },
+		{ L"kw", cardinal_kw },
+		{ L"ky", cardinal_af },
+		{ L"lag", cardinal_lag },
+		{ L"lb", cardinal_af },
+		{ L"lg", cardinal_af },
+		{ L"lij", cardinal_ast },
+		{ L"ln", cardinal_ak },
+		{ L"lt", cardinal_lt },
+		{ L"lv", cardinal_lv },
+		{ L"mas", cardinal_af },
+		{ L"mg", cardinal_ak },
+		{ L"mgo", cardinal_af },
+		{ L"mk", cardinal_mk },
+		{ L"ml", cardinal_af },
+		{ L"mn", cardinal_af },
+		{ L"mo", cardinal_mo },
+		{ L"mr", cardinal_af },
+		{ L"mt", cardinal_mt },
+		{ L"nah", cardinal_af },
+		{ L"naq", cardinal_iu },
+		{ L"nb", cardinal_af },
+		{ L"nd", cardinal_af },
+		{ L"ne", cardinal_af },
+		{ L"nl", cardinal_ast },
+		{ L"nn", cardinal_af },
+		{ L"nnh", cardinal_af },
+		{ L"no", cardinal_af },
+		{ L"nr", cardinal_af },
+		{ L"nso", cardinal_ak },
+		{ L"ny", cardinal_af },
+		{ L"nyn", cardinal_af },
+		{ L"om", cardinal_af },
+		{ L"or", cardinal_af },
+		{ L"os", cardinal_af },
+		{ L"pa", cardinal_ak },
+		{ L"pap", cardinal_af },
+		{ L"pcm", cardinal_am },
+		{ L"pl", cardinal_pl },
+		{ L"prg", cardinal_lv },
+		{ L"ps", cardinal_af },
+		{ L"pt", cardinal_pt },
+		{ L"pt-PT", cardinal_ca },
+		{ L"rm", cardinal_af },
+		{ L"ro", cardinal_mo },
+		{ L"rof", cardinal_af },
+		{ L"ru", cardinal_ru },
+		{ L"rwk", cardinal_af },
+		{ L"saq", cardinal_af },
+		{ L"sat", cardinal_iu },
+		{ L"sc", cardinal_ast },
+		{ L"scn", cardinal_ast },
+		{ L"sd", cardinal_af },
+		{ L"sdh", cardinal_af },
+		{ L"se", cardinal_iu },
+		{ L"seh", cardinal_af },
+		{ L"sh", cardinal_bs },
+		{ L"shi", cardinal_shi },
+		{ L"si", cardinal_si },
+		{ L"sk", cardinal_cs },
+		{ L"sl", cardinal_sl },
+		{ L"sma", cardinal_iu },
+		{ L"smi", cardinal_iu },
+		{ L"smj", cardinal_iu },
+		{ L"smn", cardinal_iu },
+		{ L"sms", cardinal_iu },
+		{ L"sn", cardinal_af },
+		{ L"so", cardinal_af },
+		{ L"sq", cardinal_af },
+		{ L"sr", cardinal_bs },
+		{ L"ss", cardinal_af },
+		{ L"ssy", cardinal_af },
+		{ L"st", cardinal_af },
+		{ L"sv", cardinal_ast },
+		{ L"sw", cardinal_ast },
+		{ L"syr", cardinal_af },
+		{ L"ta", cardinal_af },
+		{ L"te", cardinal_af },
+		{ L"teo", cardinal_af },
+		{ L"ti", cardinal_ak },
+		{ L"tig", cardinal_af },
+		{ L"tk", cardinal_af },
+		{ L"tl", cardinal_ceb },
+		{ L"tn", cardinal_af },
+		{ L"tr", cardinal_af },
+		{ L"ts", cardinal_af },
+		{ L"tzm", cardinal_tzm },
+		{ L"ug", cardinal_af },
+		{ L"uk", cardinal_ru },
+		{ L"ur", cardinal_ast },
+		{ L"uz", cardinal_af },
+		{ L"ve", cardinal_af },
+		{ L"vec", cardinal_ca },
+		{ L"vo", cardinal_af },
+		{ L"vun", cardinal_af },
+		{ L"wa", cardinal_ak },
+		{ L"wae", cardinal_af },
+		{ L"xh", cardinal_af },
+		{ L"xog", cardinal_af },
+		{ L"yi", cardinal_ast },
+		{ L"zu", cardinal_am },
+	};
+
+	inline constexpr ordinal_rule ordinal_rules[38] = {
+		{ L"as", ordinal_as },
+		{ L"az", ordinal_az },
+		{ L"bal", ordinal_bal },
+		{ L"be", ordinal_be },
+		{ L"bn", ordinal_as },
+		{ L"ca", ordinal_ca },
+		{ L"cy", ordinal_cy },
+		{ L"en", ordinal_en },
+		{ L"fil", ordinal_bal },
+		{ L"fr", ordinal_bal },
+		{ L"ga", ordinal_bal },
+		{ L"gd", ordinal_gd },
+		{ L"gu", ordinal_gu },
+		{ L"hi", ordinal_gu },
+		{ L"hu", ordinal_hu },
+		{ L"hy", ordinal_bal },
+		{ L"it", ordinal_it },
+		{ L"ka", ordinal_ka },
+		{ L"kk", ordinal_kk },
+		{ L"kw", ordinal_kw },
+		{ L"lij", ordinal_lij },
+		{ L"lo", ordinal_bal },
+		{ L"mk", ordinal_mk },
+		{ L"mo", ordinal_bal },
+		{ L"mr", ordinal_mr },
+		{ L"ms", ordinal_bal },
+		{ L"ne", ordinal_ne },
+		{ L"or", ordinal_or },
+		{ L"ro", ordinal_bal },
+		{ L"sc", ordinal_it },
+		{ L"scn", ordinal_it },
+		{ L"sq", ordinal_sq },
+		{ L"sv", ordinal_sv },
+		{ L"tk", ordinal_tk },
+		{ L"tl", ordinal_bal },
+		{ L"uk", ordinal_uk },
+		{ L"vec", ordinal_it },
+		{ L"vi", ordinal_bal },
+	};
+}
+
+#endif
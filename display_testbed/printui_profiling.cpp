@@ -0,0 +1,153 @@
+#include "printui_datatypes.hpp"
+
+#include <algorithm>
+
+namespace printui {
+	namespace {
+		uint32_t microseconds_between(std::chrono::time_point<std::chrono::steady_clock> start, std::chrono::time_point<std::chrono::steady_clock> end) {
+			auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+			return us > 0 ? uint32_t(us) : uint32_t(0);
+		}
+
+		template<typename F>
+		frame_statistics statistics_from_history(frame_profiler const& p, F const& value_of) {
+			frame_statistics result;
+			if(p.records_stored == 0)
+				return result;
+
+			std::array<uint32_t, frame_profiler::history_size> values;
+			for(uint32_t i = 0; i < p.records_stored; ++i) {
+				values[i] = value_of(p.history[i]);
+			}
+			auto end = values.begin() + p.records_stored;
+
+			auto percentile = [&](uint32_t pct) {
+				auto nth = values.begin() + std::min((p.records_stored * pct) / 100, p.records_stored - 1);
+				std::nth_element(values.begin(), nth, end);
+				return *nth;
+			};
+
+			result.samples = p.records_stored;
+			result.p50 = percentile(50);
+			result.p95 = percentile(95);
+			result.p99 = percentile(99);
+			result.maximum = *std::max_element(values.begin(), end);
+			return result;
+		}
+
+		char const* stage_name(frame_stage s) {
+			switch(s) {
+				case frame_stage::layout:
+					return "layout";
+				case frame_stage::foreground:
+					return "refresh_foreground";
+				case frame_stage::display:
+					return "to_display";
+				case frame_stage::composite:
+					return "composite_animation";
+				case frame_stage::present:
+					return "present";
+				case frame_stage::count:
+					break;
+			}
+			return "unknown";
+		}
+	}
+
+	void frame_profiler::begin_frame(std::chrono::time_point<std::chrono::steady_clock> now) {
+		current = frame_record{};
+		current.start_time = now;
+	}
+
+	void frame_profiler::record_stage(frame_stage stage, std::chrono::time_point<std::chrono::steady_clock> start, std::chrono::time_point<std::chrono::steady_clock> end) {
+		current.stage_start[size_t(stage)] = microseconds_between(current.start_time, start);
+		current.stage_duration[size_t(stage)] += microseconds_between(start, end);
+	}
+
+	void frame_profiler::end_frame(std::chrono::time_point<std::chrono::steady_clock> now) {
+		if(!enabled)
+			return;
+
+		current.total_duration = microseconds_between(current.start_time, now);
+		history[next_record] = current;
+		next_record = (next_record + 1) % history_size;
+		records_stored = std::min(records_stored + 1, history_size);
+	}
+
+	void frame_profiler::clear() {
+		next_record = 0;
+		records_stored = 0;
+	}
+
+	frame_statistics frame_profiler::stage_statistics(frame_stage stage) const {
+		return statistics_from_history(*this, [stage](frame_record const& r) { return r.stage_duration[size_t(stage)]; });
+	}
+
+	frame_statistics frame_profiler::total_statistics() const {
+		return statistics_from_history(*this, [](frame_record const& r) { return r.total_duration; });
+	}
+
+	std::string frame_profiler::statistics_report() const {
+		std::string result;
+		auto add_line = [&](char const* name, frame_statistics const& s) {
+			result += name;
+			result += "\tp50 " + std::to_string(s.p50) + "\tp95 " + std::to_string(s.p95) + "\tp99 " + std::to_string(s.p99)
+				+ "\tmax " + std::to_string(s.maximum) + "\n";
+		};
+		for(size_t s = 0; s < size_t(frame_stage::count); ++s) {
+			add_line(stage_name(frame_stage(s)), stage_statistics(frame_stage(s)));
+		}
+		add_line("frame", total_statistics());
+		result += std::to_string(records_stored) + " frames\n";
+		return result;
+	}
+
+	// produces the json object format understood by chrome://tracing and perfetto
+	std::string frame_profiler::to_chrome_trace() const {
+		std::string result = "{\"traceEvents\":[";
+		if(records_stored == 0) {
+			result += "]}";
+			return result;
+		}
+
+		uint32_t oldest = records_stored < history_size ? 0 : next_record;
+		auto base_time = history[oldest].start_time;
+		bool first_event = true;
+
+		auto add_event = [&](char const* name, uint32_t ts, uint32_t dur, std::string const& args) {
+			if(!first_event)
+				result += ",";
+			first_event = false;
+			result += "{\"name\":\"";
+			result += name;
+			result += "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+			result += std::to_string(ts);
+			result += ",\"dur\":";
+			result += std::to_string(dur);
+			if(!args.empty()) {
+				result += ",\"args\":{";
+				result += args;
+				result += "}";
+			}
+			result += "}";
+		};
+
+		for(uint32_t i = 0; i < records_stored; ++i) {
+			auto const& r = history[(oldest + i) % history_size];
+			auto frame_ts = microseconds_between(base_time, r.start_time);
+
+			add_event("frame", frame_ts, r.total_duration,
+				"\"draw_calls\":" + std::to_string(r.draw_calls) +
+				",\"rectangles\":" + std::to_string(r.rectangles) +
+				",\"text_draws\":" + std::to_string(r.text_draws));
+
+			for(size_t s = 0; s < size_t(frame_stage::count); ++s) {
+				if(r.stage_duration[s] != 0)
+					add_event(stage_name(frame_stage(s)), frame_ts + r.stage_start[s], r.stage_duration[s], std::string{});
+			}
+		}
+
+		result += "]}";
+		return result;
+	}
+}
@@ -21,6 +21,10 @@
 #include <wincodec.h>
 #include <shlwapi.h>
 #include <array>
+#include <optional>
+#include <atomic>
+#include <memory>
+#include "unordered_dense.h"
 
 
 namespace printui::render {
@@ -42,11 +46,52 @@ namespace printui::render {
 		icon(icon&& other) noexcept;
 		icon& operator=(icon&& other) noexcept;
 		icon& operator=(icon const& other) = delete;
+		alpha_image cached_layer; // cpu side copy of rendered_layer, kept across device loss
+
 		void redraw_image(window_data const& win, direct2d_rendering& ri);
+		void restore_image(window_data const& win, direct2d_rendering& ri);
 		void present_image(float x, float y, direct2d_rendering& ri, ID2D1Brush* br);
 	};
 
+	struct animation_timeline {
+		animation_status_struct status;
+		ID2D1Bitmap1* previous_state = nullptr; // snapshot of the animated region only
+	};
+
+	// written by the decoding job, which publishes it by setting complete; a cancelled decode is left to finish on its own
+	struct texture_decode {
+		std::optional<rgba_image> result;
+		std::atomic<bool> complete = false;
+		std::atomic<bool> cancelled = false;
+	};
+
+	struct brush_texture {
+		std::wstring file_name;
+		std::shared_ptr<texture_decode> pending_decode;
+		std::optional<rgba_image> decoded;
+	};
+
+	// cached copy of the foreground of a control whose content reports a version; reused by full foreground
+	// redraws for as long as the control's content version and size don't change
+	struct foreground_tile {
+		ID2D1Bitmap1* bitmap = nullptr;
+		uint32_t content_version = 0;
+		uint8_t text_generation = 0;
+		int32_t layout_size = 0;
+		layout_orientation orientation = layout_orientation::horizontal_left_to_right;
+		uint16_t width = 0;
+		uint16_t height = 0;
+		uint32_t last_used_pass = 0;
+	};
+	struct pending_tile_capture {
+		render_interface* ri = nullptr;
+		ui_rectangle rect;
+	};
+
 	struct direct2d_rendering {
+	public:
+		constexpr static uint32_t max_animation_timelines = 4;
+		using animation_clock_fn = std::chrono::steady_clock::time_point(*)();
 	private:
 		ID2D1Factory6* d2d_factory = nullptr;
 		IWICImagingFactory* wic_factory = nullptr;
@@ -63,6 +108,9 @@ namespace printui::render {
 		ID2D1SolidColorBrush* dark_selected_line = nullptr;
 
 		ID2D1Bitmap1* foreground = nullptr;
+		ankerl::unordered_dense::map<layout_interface const*, foreground_tile> foreground_tiles;
+		std::vector<pending_tile_capture> pending_tile_captures;
+		uint32_t foreground_pass = 0;
 
 		ID2D1Bitmap1* animation_foreground = nullptr;
 		ID2D1Bitmap1* animation_background = nullptr;
@@ -79,6 +127,11 @@ namespace printui::render {
 		ID2D1Bitmap1* vertical_controller_interactable[7] = { nullptr };
 		ID2D1Bitmap1* group_controller_interactable[7] = { nullptr };
 
+		constexpr static uint32_t interactable_tag_count = 3 * 12 + 3 * 7;
+		std::array<alpha_image, interactable_tag_count> interactable_tag_cache;
+		device_resource_tracker device_resources;
+		bool window_size_resources_lost = false;
+
 		ID3D11Device* d3d_device = nullptr;
 		IDXGIDevice1* dxgi_device = nullptr;
 		ID2D1Device5* d2d_device = nullptr;
@@ -91,18 +144,30 @@ namespace printui::render {
 
 		std::vector<ID2D1Brush*> palette;
 		std::vector<ID2D1Bitmap*> palette_bitmaps;
+		std::vector<brush_texture> palette_textures; // survives device recreation
+		background_queue texture_jobs{ 1 };
 
 		std::vector<icon> icons;
 
 		bool redraw_completely_pending = true;
 		bool is_suspended = false;
 
+		// set by to_display when the base fill of the rectangle being drawn was already emitted as part of a merged run
+		bool background_prefilled = false;
+		screen_space_rect prefilled_rect{ 0, 0, 0, 0 };
+		uint8_t prefilled_brush = 0;
+
 		bool running_in_place_animation = false;
 		bool previous_frame_in_place_animation = false;
 		decltype(std::chrono::steady_clock::now()) in_place_animation_start;
-		animation_status_struct animation_status;
+		std::array<animation_timeline, max_animation_timelines> animation_timelines;
 
 	public:
+		animation_clock_fn animation_clock = std::chrono::steady_clock::now;
+		frame_profiler profiler;
+		bool force_software_device = false; // use the WARP rasterizer even when a gpu is available
+		bool merge_backgrounds = true; // fill the backgrounds of a run of adjacent, alike rectangles at once
+
 		direct2d_rendering();
 		virtual ~direct2d_rendering();
 
@@ -113,7 +178,7 @@ namespace printui::render {
 		void interactable(window_data const& win, screen_space_point location, interactable_state state, uint8_t fg_brush, bool vertical);
 		void text(window_data const& win, ::printui::text::arranged_text*, text_size sz, int32_t x, int32_t y);
 		void fill_from_foreground(screen_space_rect location, uint8_t fg_brush, bool optimize_for_text);
-		void create_palette(window_data const& win);
+		void create_palette(window_data& win);
 		void mark_for_complete_redraw();
 		void stop_ui_animations(window_data const& win);
 		void prepare_ui_animation(window_data& win);
@@ -130,18 +195,51 @@ namespace printui::render {
 		layout_position get_icon_size(uint8_t ico);
 		uint8_t load_icon(std::wstring const& file_name, float edge_padding, int8_t x_size, int8_t y_size);
 		void create_interactiable_tags(window_data& win);
+		void release_foreground_tile(layout_interface const* l);
+		rgba_image render_to_image(window_data& win);
+		bool save_image(rgba_image const& img, std::wstring const& file_name);
+		std::optional<rgba_image> load_image(std::wstring const& file_name);
 	private:
 		void create_device_resources(window_data& win);
 		void to_display(std::vector<ui_rectangle> const& uirects, window_data& win);
+		ui_reference fill_merged_backgrounds(std::vector<ui_rectangle> const& uirects, ui_reference first, window_data const& win);
 		void foregrounds(std::vector<ui_rectangle>& uirects, window_data& win);
 		void update_foregrounds(std::vector<ui_rectangle>& uirects, window_data& win);
+		bool draw_foreground_tile(ui_rectangle const& r, render_interface const* ri, window_data const& win);
+		void capture_foreground_tiles(window_data const& win);
+		void release_foreground_tiles();
 		void composite_animation(window_data& win, uint32_t ui_width, uint32_t ui_height);
+		animation_timeline& acquire_animation_timeline(screen_space_rect region);
+		bool animations_running() const;
+		void release_animation_timelines();
+		void draw_profiler_overlay(window_data const& win);
 		void release_palette();
+		void start_texture_decodes(window_data& win);
+		void update_palette_textures();
+		bool create_texture_brush(size_t i);
 		void create_highlight_brushes();
 		void setup_icon_transform(window_data const& win, float edge_padding, int32_t xsize, int32_t ysize);
 		void refresh_foregound(window_data& win);
 		void redraw_icons(window_data& win);
 		void release_device_resources();
+		void recover_device_resources(window_data& win);
+		void capture_device_copies();
+		ID2D1Bitmap1* upload_mask(alpha_image const& img, float dpi);
+
+		template<typename F>
+		void for_each_interactable_tag(F&& f) {
+			uint32_t c = 0;
+			for(uint32_t i = 0; i < 12; ++i) {
+				f(horizontal_interactable[i], interactable_tag_cache[c++]);
+				f(vertical_interactable[i], interactable_tag_cache[c++]);
+				f(group_interactable[i], interactable_tag_cache[c++]);
+			}
+			for(uint32_t i = 0; i < 7; ++i) {
+				f(horizontal_controller_interactable[i], interactable_tag_cache[c++]);
+				f(vertical_controller_interactable[i], interactable_tag_cache[c++]);
+				f(group_controller_interactable[i], interactable_tag_cache[c++]);
+			}
+		}
 		void update_preserved_rects(ui_rectangle const& r, direct2d_rendering& d2dri, ID2D1RectangleGeometry*& screen_rect_geom, ID2D1GeometryGroup*& with_preserved_rects, ID2D1Geometry*& old_rects, int32_t ui_width, int32_t ui_height);
 
 		friend struct icon;
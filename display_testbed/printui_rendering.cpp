@@ -32,7 +32,7 @@ namespace printui {
 			safe_release(rendered_layer);
 		}
 
-		icon::icon(icon&& other) noexcept : file_name(std::move(other.file_name)) {
+		icon::icon(icon&& other) noexcept : file_name(std::move(other.file_name)), cached_layer(std::move(other.cached_layer)) {
 			rendered_layer = other.rendered_layer;
 			other.rendered_layer = nullptr;
 
@@ -46,6 +46,7 @@ namespace printui {
 			other.rendered_layer = nullptr;
 
 			file_name = std::move(other.file_name);
+			cached_layer = std::move(other.cached_layer);
 			edge_padding = other.edge_padding;
 			xsize = other.xsize;
 			ysize = other.ysize;
@@ -390,370 +391,49 @@ namespace printui {
 
 
 	void render::direct2d_rendering::composite_animation(window_data& win, uint32_t ui_width, uint32_t ui_height) {
-		//composite regions outside of animation
-		if(animation_status.description.animated_region.y > 0) {
-			d2d_device_context->DrawBitmap(animation_foreground,
-				D2D1_RECT_F{0.0f, 0.0f, float(ui_width), float(animation_status.description.animated_region.y) },
-				1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-				D2D1_RECT_F{ 0.0f, 0.0f, float(ui_width), float(animation_status.description.animated_region.y) });
-		}
-		if(animation_status.description.animated_region.y + animation_status.description.animated_region.height < int32_t(ui_height)) {
-			d2d_device_context->DrawBitmap(animation_foreground,
-				D2D1_RECT_F{ 0.0f, float(animation_status.description.animated_region.y + animation_status.description.animated_region.height), float(ui_width), float(ui_height) },
-				1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-				D2D1_RECT_F{ 0.0f, float(animation_status.description.animated_region.y + animation_status.description.animated_region.height), float(ui_width), float(ui_height) });
-		}
-		if(animation_status.description.animated_region.x > 0) {
-			d2d_device_context->DrawBitmap(animation_foreground,
-				D2D1_RECT_F{ 0.0f, float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-				1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-				D2D1_RECT_F{ 0.0f, float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-		}
-		if(animation_status.description.animated_region.x + animation_status.description.animated_region.width <  int32_t(ui_width)) {
-			d2d_device_context->DrawBitmap(animation_foreground,
-				D2D1_RECT_F{ float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y), float(ui_width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-				1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-				D2D1_RECT_F{ float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y), float(ui_width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-		}
-		auto duration = std::chrono::steady_clock::now() - animation_status.start_time;
-		auto in_ms = std::chrono::duration_cast<std::chrono::milliseconds>(duration);
-
-		float percent_complete = std::min(float(in_ms.count()) / (1000.0f * animation_status.description.duration_seconds), 1.0f);
-
-		switch(animation_status.description.type) {
-			case animation_type::fade:
-				if(animation_status.description.animate_in) {
-					d2d_device_context->DrawBitmap(animation_background,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-						1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-					d2d_device_context->DrawBitmap(animation_foreground,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-						percent_complete, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-				} else {
-					d2d_device_context->DrawBitmap(animation_foreground,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-						1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-					d2d_device_context->DrawBitmap(animation_background,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-						1.0f - percent_complete, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-						D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-				}
-				break;
-			case animation_type::slide:
-				switch(animation_status.description.direction) {
-					case animation_direction::bottom:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y) + (1.0f - percent_complete) * animation_status.description.animated_region.height,
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y) + percent_complete * animation_status.description.animated_region.height });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y) + (percent_complete) * animation_status.description.animated_region.height,
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y) + (1.0f - percent_complete) * animation_status.description.animated_region.height });
-						}
-						break;
-					case animation_direction::top:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y) + percent_complete * animation_status.description.animated_region.height },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y) + (1.0f - percent_complete) * animation_status.description.animated_region.height,
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y) + (1.0f - percent_complete) * animation_status.description.animated_region.height },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y) + (percent_complete) * animation_status.description.animated_region.height,
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-					case animation_direction::right:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x) + (1.0f - percent_complete) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + (percent_complete) * animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x) + (percent_complete) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + (1.0f - percent_complete) * animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-					case animation_direction::left:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x) + (percent_complete) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x + (1.0f - percent_complete) * animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x) + (1.0f - percent_complete) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x + (percent_complete)*animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-				}
-				break;
-			case animation_type::flip:
-			{
-				float extent = (animation_status.description.animate_in) ? cos((1.0f - percent_complete) * 3.14159f / 2.0f) : cos((percent_complete) * 3.14159f / 2.0f);
-				switch(animation_status.description.direction) {
-					case animation_direction::bottom:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y) + (1.0f - extent) * animation_status.description.animated_region.height,
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y) + (1.0f - extent) * animation_status.description.animated_region.height,
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-					case animation_direction::top:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y) + extent * animation_status.description.animated_region.height },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y) + extent * animation_status.description.animated_region.height },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-					case animation_direction::left:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x) + extent * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x),
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x) + extent * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-					case animation_direction::right:
-						if(animation_status.description.animate_in) {
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x) + (1.0f - extent) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						} else {
-							d2d_device_context->DrawBitmap(animation_foreground,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-								1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
-								D2D1_RECT_F{ float(animation_status.description.animated_region.x), float(animation_status.description.animated_region.y), float(animation_status.description.animated_region.x + animation_status.description.animated_region.width), float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-							d2d_device_context->DrawBitmap(animation_background,
-								D2D1_RECT_F{
-									float(animation_status.description.animated_region.x) + (1.0f - extent) * animation_status.description.animated_region.width,
-									float(animation_status.description.animated_region.y),
-									float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-									float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) },
-									1.0f, D2D1_BITMAP_INTERPOLATION_MODE_LINEAR,
-									D2D1_RECT_F{
-										float(animation_status.description.animated_region.x),
-										float(animation_status.description.animated_region.y),
-										float(animation_status.description.animated_region.x + animation_status.description.animated_region.width),
-										float(animation_status.description.animated_region.y + animation_status.description.animated_region.height) });
-						}
-						break;
-				}
-				break;
+		// the current state covers everything outside of the animated regions
+		++profiler.current.draw_calls;
+		d2d_device_context->DrawBitmap(animation_foreground,
+			D2D1_RECT_F{ 0.0f, 0.0f, float(ui_width), float(ui_height) },
+			1.0f, D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+			D2D1_RECT_F{ 0.0f, 0.0f, float(ui_width), float(ui_height) });
+
+		auto const now = animation_clock();
+		bool still_running = false;
+
+		for(auto& t : animation_timelines) {
+			if(!t.status.is_running)
+				continue;
+
+			auto percent_complete = t.status.percent_complete(now);
+			auto frame = compose_animation_frame(t.status.description, percent_complete);
+
+			auto const& region = t.status.description.animated_region;
+			for(uint32_t i = 0; i < frame.count; ++i) {
+				auto const& op = frame.operations[i];
+				if(op.layer == animation_layer::previous_state && !t.previous_state)
+					continue;
+
+				// the previous state layer only holds the animated region, so its coordinates start at the region origin
+				float src_dx = op.layer == animation_layer::previous_state ? float(region.x) : 0.0f;
+				float src_dy = op.layer == animation_layer::previous_state ? float(region.y) : 0.0f;
+
+				++profiler.current.draw_calls;
+				d2d_device_context->DrawBitmap(op.layer == animation_layer::previous_state ? t.previous_state : animation_foreground,
+					D2D1_RECT_F{ op.destination.left, op.destination.top, op.destination.right, op.destination.bottom },
+					op.opacity,
+					op.linear_filtering ? D2D1_BITMAP_INTERPOLATION_MODE_LINEAR : D2D1_BITMAP_INTERPOLATION_MODE_NEAREST_NEIGHBOR,
+					D2D1_RECT_F{ op.source.left - src_dx, op.source.top - src_dy, op.source.right - src_dx, op.source.bottom - src_dy });
+			}
+
+			if(percent_complete == 1.0f) {
+				t.status.is_running = false;
+			} else {
+				still_running = true;
 			}
 		}
 
-		if(percent_complete == 1.0f) {
-			animation_status.is_running = false;
-		} else {
+		if(still_running) {
 			win.window_interface.invalidate_window();
 		}
 	}
@@ -764,6 +444,7 @@ namespace printui {
 			interactable(win, location, state, fg_brush, vertical);
 			if(win.keyboard_target || (!state.holds_key() && !state.holds_group())) {
 				d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(float(location.x), float(location.y)));
+				++profiler.current.draw_calls;
 				d2d_device_context->FillOpacityMask(
 					icons[icon_id].rendered_layer,
 					palette[fg_brush],
@@ -781,6 +462,7 @@ namespace printui {
 					float(location.x + win.layout_size),
 					float(location.y + win.layout_size) };
 
+				++profiler.current.draw_calls;
 				d2d_device_context->FillOpacityMask(foreground, palette[fg_brush], D2D1_OPACITY_MASK_CONTENT_GRAPHICS, content_rect, content_rect);
 			}
 		}
@@ -797,6 +479,7 @@ namespace printui {
 
 				if(state.holds_key()) {
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(float(location.x), float(location.y)));
+					++profiler.current.draw_calls;
 					d2d_device_context->FillOpacityMask(
 						vertical ? vertical_interactable[state.get_key()] : horizontal_interactable[state.get_key()],
 						palette[resolved_brush],
@@ -806,6 +489,7 @@ namespace printui {
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(float(location.x), float(location.y)));
 					if(!state.is_group_start())
 						palette[resolved_brush]->SetOpacity(0.8f);
+					++profiler.current.draw_calls;
 					d2d_device_context->FillOpacityMask(
 						group_interactable[state.get_key()],
 						palette[resolved_brush],
@@ -853,6 +537,7 @@ namespace printui {
 							resolved_icon = state.get_key() - 8;
 						}
 					}
+					++profiler.current.draw_calls;
 					d2d_device_context->FillOpacityMask(
 						vertical ? vertical_controller_interactable[resolved_icon] : horizontal_controller_interactable[resolved_icon],
 						palette[resolved_brush],
@@ -893,6 +578,7 @@ namespace printui {
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(float(location.x), float(location.y)));
 					if(!state.is_group_start())
 						palette[resolved_brush]->SetOpacity(0.8f);
+					++profiler.current.draw_calls;
 					d2d_device_context->FillOpacityMask(
 						group_controller_interactable[resolved_icon],
 						palette[resolved_brush],
@@ -905,13 +591,51 @@ namespace printui {
 		}
 
 	void direct2d_rendering::stop_ui_animations(window_data const&) {
-		animation_status.is_running = false;
+		for(auto& t : animation_timelines) {
+			t.status.is_running = false;
+		}
+	}
+	bool direct2d_rendering::animations_running() const {
+		for(auto& t : animation_timelines) {
+			if(t.status.is_running)
+				return true;
+		}
+		return false;
+	}
+	void direct2d_rendering::release_animation_timelines() {
+		for(auto& t : animation_timelines) {
+			t.status.is_running = false;
+			safe_release(t.previous_state);
+		}
+	}
+	animation_timeline& direct2d_rendering::acquire_animation_timeline(screen_space_rect region) {
+		// an animation that lies entirely within the new region would be painted over anyways
+		for(auto& t : animation_timelines) {
+			auto const& o = t.status.description.animated_region;
+			if(t.status.is_running
+				&& o.x >= region.x && o.y >= region.y
+				&& o.x + o.width <= region.x + region.width && o.y + o.height <= region.y + region.height) {
+
+				t.status.is_running = false;
+			}
+		}
+		for(auto& t : animation_timelines) {
+			if(!t.status.is_running)
+				return t;
+		}
+		// all timelines are in use: replace the one that has been running the longest
+		auto oldest = std::min_element(animation_timelines.begin(), animation_timelines.end(), [](animation_timeline const& a, animation_timeline const& b) {
+			return a.status.start_time < b.status.start_time;
+		});
+		oldest->status.is_running = false;
+		return *oldest;
 	}
 	void direct2d_rendering::prepare_ui_animation(window_data& win) {
 		if(win.dynamic_settings.uianimations == false)
 			return;
 
-		stop_ui_animations(win);
+		// animations that are already running keep their own snapshots; acquire_animation_timeline stops only
+		// those that the new animation covers
 		refresh_foregound(win);
 
 		d2d_device_context->SetTarget(animation_background);
@@ -947,43 +671,72 @@ namespace printui {
 		if(win.dynamic_settings.uianimations == false)
 			return;
 
-		animation_status.description = description;
-		animation_status.description.duration_seconds /= win.dynamic_settings.animation_speed_multiplier;
-		animation_status.description.animated_region = extend_rect_to_edges(animation_status.description.animated_region, win);
+		auto region = intersection(extend_rect_to_edges(description.animated_region, win), screen_space_rect{ 0, 0, int32_t(win.ui_width), int32_t(win.ui_height) });
+		if(region.width <= 0 || region.height <= 0 || !animation_background)
+			return;
+
+		auto& timeline = acquire_animation_timeline(region);
+		auto& status = timeline.status;
+
+		status.description = description;
+		status.description.duration_seconds /= win.dynamic_settings.animation_speed_multiplier;
+		status.description.animated_region = region;
 
 		switch(win.orientation) {
 			case layout_orientation::horizontal_left_to_right:
 				break;
 			case layout_orientation::horizontal_right_to_left:
 				if(description.direction == animation_direction::left)
-					animation_status.description.direction = animation_direction::right;
+					status.description.direction = animation_direction::right;
 				else if(description.direction == animation_direction::right)
-					animation_status.description.direction = animation_direction::left;
+					status.description.direction = animation_direction::left;
 				break;
 			case layout_orientation::vertical_left_to_right:
 				if(description.direction == animation_direction::left)
-					animation_status.description.direction = animation_direction::top;
+					status.description.direction = animation_direction::top;
 				else if(description.direction == animation_direction::right)
-					animation_status.description.direction = animation_direction::bottom;
+					status.description.direction = animation_direction::bottom;
 				else if(description.direction == animation_direction::top)
-					animation_status.description.direction = animation_direction::left;
+					status.description.direction = animation_direction::left;
 				else if(description.direction == animation_direction::bottom)
-					animation_status.description.direction = animation_direction::right;
+					status.description.direction = animation_direction::right;
 				break;
 			case layout_orientation::vertical_right_to_left:
 				if(description.direction == animation_direction::left)
-					animation_status.description.direction = animation_direction::top;
+					status.description.direction = animation_direction::top;
 				else if(description.direction == animation_direction::right)
-					animation_status.description.direction = animation_direction::bottom;
+					status.description.direction = animation_direction::bottom;
 				else if(description.direction == animation_direction::top)
-					animation_status.description.direction = animation_direction::right;
+					status.description.direction = animation_direction::right;
 				else if(description.direction == animation_direction::bottom)
-					animation_status.description.direction = animation_direction::left;
+					status.description.direction = animation_direction::left;
 				break;
 		}
 
-		animation_status.is_running = true;
-		animation_status.start_time = std::chrono::steady_clock::now();
+		// keep only the animated part of the snapshot; the shared snapshot may be overwritten by the next animation
+		if(timeline.previous_state) {
+			auto sz = timeline.previous_state->GetPixelSize();
+			if(sz.width < uint32_t(region.width) || sz.height < uint32_t(region.height))
+				safe_release(timeline.previous_state);
+		}
+		if(!timeline.previous_state) {
+			d2d_device_context->CreateBitmap(D2D1_SIZE_U{ uint32_t(region.width), uint32_t(region.height) }, nullptr, 0,
+				D2D1_BITMAP_PROPERTIES1{
+					D2D1::PixelFormat(
+						DXGI_FORMAT_B8G8R8A8_UNORM,
+						D2D1_ALPHA_MODE_PREMULTIPLIED),
+					win.dpi, win.dpi,
+					D2D1_BITMAP_OPTIONS_NONE, nullptr },
+				&timeline.previous_state);
+		}
+		if(timeline.previous_state) {
+			D2D1_POINT_2U dest_point{ 0, 0 };
+			D2D1_RECT_U src_rect{ uint32_t(region.x), uint32_t(region.y), uint32_t(region.x + region.width), uint32_t(region.y + region.height) };
+			timeline.previous_state->CopyFromBitmap(&dest_point, animation_background, &src_rect);
+		}
+
+		status.is_running = true;
+		status.start_time = animation_clock();
 		win.window_interface.invalidate_window();
 	}
 
@@ -1134,6 +887,7 @@ namespace printui {
 			icons.back().xsize = x_size;
 			icons.back().ysize = y_size;
 			icons.back().edge_padding = edge_padding;
+			device_resources.invalidate_cache(device_resource::icons);
 			return uint8_t(icons.size() - 1);
 		}
 
@@ -1143,6 +897,7 @@ namespace printui {
 				float(location.x), float(location.y),
 				float(location.x + location.width), float(location.y + location.height) };
 
+			++profiler.current.draw_calls;
 			d2d_device_context->FillOpacityMask(foreground, palette[fg_brush], optimize_for_text ? D2D1_OPACITY_MASK_CONTENT_TEXT_NATURAL : D2D1_OPACITY_MASK_CONTENT_GRAPHICS, content_rect, content_rect);
 
 		}
@@ -1158,24 +913,85 @@ namespace printui {
 				float(rect.x + rect.width), float(rect.y + rect.height) };
 			content_rect = extend_rect_to_edges(content_rect, win);
 
-			if((display_flags & ui_rectangle::flag_skip_bg) == 0) {
+			bool const already_filled = background_prefilled && brush == prefilled_brush
+				&& rect.x == prefilled_rect.x && rect.y == prefilled_rect.y
+				&& rect.width == prefilled_rect.width && rect.height == prefilled_rect.height;
+			if(already_filled)
+				background_prefilled = false;
+
+			if((display_flags & ui_rectangle::flag_skip_bg) == 0 && !already_filled) {
+				++profiler.current.draw_calls;
 				d2d_device_context->FillRectangle(content_rect, palette[brush]);
 			}
 
 			if((display_flags & ui_rectangle::flag_line_highlight) != 0) {
 				if(under_mouse && (display_flags & ui_rectangle::flag_interactable) != 0) {
+					++profiler.current.draw_calls;
 					d2d_device_context->FillRectangle(content_rect,
 						win.dynamic_settings.brushes[brush].is_light_color ? dark_selected_line : light_selected_line);
 				} else {
+					++profiler.current.draw_calls;
 					d2d_device_context->FillRectangle(content_rect,
 						win.dynamic_settings.brushes[brush].is_light_color ? dark_line : light_line);
 				}
 			} else if(under_mouse && (display_flags & ui_rectangle::flag_interactable) != 0) {
+				++profiler.current.draw_calls;
 				d2d_device_context->FillRectangle(content_rect,
 					win.dynamic_settings.brushes[brush].is_light_color ? dark_selected : light_selected);
 			}
 		}
 
+		// only a rectangle whose own drawing would fill it with its background brush can have that fill done for it
+		bool can_merge_background(ui_rectangle const& r) {
+			if((r.display_flags & (ui_rectangle::flag_overlay | ui_rectangle::flag_skip_bg | ui_rectangle::flag_clear_rect | ui_rectangle::flag_preserve_rect)) != 0)
+				return false;
+			auto ri = r.parent_object.get_render_interface();
+			return !ri || ri->fills_background(r);
+		}
+
+		// Finds the run of rectangles following first that have its display flags and background brush and that,
+		// together, tile a single larger rectangle, and fills the backgrounds of the whole run at once. This is done
+		// before the contents of any of them are drawn, so anything a rectangle draws outside of its own bounds and
+		// onto a later rectangle of the run is no longer covered by that rectangle's background. Returns the index
+		// of the last rectangle in the run.
+		ui_reference direct2d_rendering::fill_merged_backgrounds(std::vector<ui_rectangle> const& uirects, ui_reference first, window_data const& win) {
+			auto const& r = uirects[first];
+			if(!merge_backgrounds || !can_merge_background(r))
+				return first;
+
+			auto const brush = r.background_index;
+			auto span = extend_rect_to_edges(D2D1_RECT_F{ float(r.x_position), float(r.y_position), float(r.x_position + r.width), float(r.y_position + r.height) }, win);
+
+			ui_reference last = first;
+			for(ui_reference j = first + 1; j < uirects.size(); ++j) {
+				auto const& n = uirects[j];
+				if(n.display_flags != r.display_flags || n.background_index != brush || !can_merge_background(n))
+					break;
+
+				auto next = extend_rect_to_edges(D2D1_RECT_F{ float(n.x_position), float(n.y_position), float(n.x_position + n.width), float(n.y_position + n.height) }, win);
+
+				if(next.left == span.left && next.right == span.right && next.top == span.bottom) {
+					span.bottom = next.bottom;
+				} else if(next.left == span.left && next.right == span.right && next.bottom == span.top) {
+					span.top = next.top;
+				} else if(next.top == span.top && next.bottom == span.bottom && next.left == span.right) {
+					span.right = next.right;
+				} else if(next.top == span.top && next.bottom == span.bottom && next.right == span.left) {
+					span.left = next.left;
+				} else {
+					break;
+				}
+				last = j;
+			}
+
+			if(last != first) {
+				d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
+				++profiler.current.draw_calls;
+				d2d_device_context->FillRectangle(span, palette[brush]);
+			}
+			return last;
+		}
+
 		void direct2d_rendering::to_display(std::vector<ui_rectangle> const& uirects, window_data& win) {
 			ID2D1RectangleGeometry* screen_rect_geom = nullptr;
 			ID2D1GeometryGroup* with_preserved_rects = nullptr;
@@ -1186,8 +1002,21 @@ namespace printui {
 
 			d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
 
+			ui_reference merged_until = 0;
+			bool in_merged_run = false;
+
 			for(ui_reference i = 0; i < uirects.size(); ++i) {
 				auto& r = uirects[i];
+				++profiler.current.rectangles;
+
+				if(!in_merged_run || i > merged_until) {
+					merged_until = fill_merged_backgrounds(uirects, i, win);
+					in_merged_run = merged_until != i;
+				}
+				background_prefilled = in_merged_run;
+				prefilled_rect = r;
+				prefilled_brush = r.background_index;
+
 				if((r.display_flags & ui_rectangle::flag_clear_rect) != 0) {
 					d2d_device_context->PushAxisAlignedClip(D2D1_RECT_F{
 						float(r.x_position), float(r.y_position),
@@ -1229,6 +1058,7 @@ namespace printui {
 				if((r.display_flags & ui_rectangle::flag_frame) != 0) {
 					auto ex_rect = extend_rect_to_edges(screen_space_rect{ r.x_position, r.y_position, r.width, r.height }, win);
 					if(r.left_border > 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->FillRectangle(
 							D2D1_RECT_F{
 								float(ex_rect.x),
@@ -1238,6 +1068,7 @@ namespace printui {
 								palette[r.foreground_index]);
 					}
 					if(r.right_border > 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->FillRectangle(
 							D2D1_RECT_F{
 								float(ex_rect.x + ex_rect.width - r.right_border),
@@ -1247,6 +1078,7 @@ namespace printui {
 								palette[r.foreground_index]);
 					}
 					if(r.top_border > 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->FillRectangle(
 							D2D1_RECT_F{
 								float(ex_rect.x),
@@ -1256,6 +1088,7 @@ namespace printui {
 								palette[r.foreground_index]);
 					}
 					if(r.bottom_border > 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->FillRectangle(
 							D2D1_RECT_F{
 								float(ex_rect.x),
@@ -1268,6 +1101,8 @@ namespace printui {
 
 			}
 
+			background_prefilled = false;
+
 			d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_PER_PRIMITIVE);
 			if(screen_rect_geom) {
 				d2d_device_context->PopLayer();
@@ -1316,8 +1151,11 @@ namespace printui {
 							float(content_rect.x + content_rect.width), float(content_rect.y + content_rect.height) }, D2D1_ANTIALIAS_MODE_ALIASED);
 					}
 					d2d_device_context->Clear(D2D1::ColorF(0.0f, 0.0f, 0.0f, 0.0f));
-					if(r.parent_object.get_render_interface())
-						r.parent_object->render_foreground(r, win);
+					if(auto ri = r.parent_object.get_render_interface(); ri) {
+						ri->render_foreground(r, win);
+						if(ri->foreground_version().has_value())
+							pending_tile_captures.push_back(pending_tile_capture{ ri, r });
+					}
 
 					d2d_device_context->PopAxisAlignedClip();
 					r.display_flags &= ~ui_rectangle::flag_needs_update;
@@ -1332,8 +1170,86 @@ namespace printui {
 
 		}
 
+		bool direct2d_rendering::draw_foreground_tile(ui_rectangle const& r, render_interface const* ri, window_data const& win) {
+			auto version = ri->foreground_version();
+			if(!version.has_value())
+				return false;
+
+			auto it = foreground_tiles.find(ri);
+			if(it == foreground_tiles.end())
+				return false;
+
+			auto& tile = it->second;
+			tile.last_used_pass = foreground_pass;
+
+			if(!tile.bitmap || tile.content_version != *version || tile.text_generation != win.text_data.text_generation
+				|| tile.layout_size != win.layout_size || tile.orientation != win.orientation
+				|| tile.width != r.width || tile.height != r.height) {
+				return false;
+			}
+
+			d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(float(r.x_position), float(r.y_position)));
+			++profiler.current.draw_calls;
+			d2d_device_context->FillOpacityMask(tile.bitmap, dummy_brush, D2D1_OPACITY_MASK_CONTENT_GRAPHICS);
+			d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
+			return true;
+		}
+
+		// copies the freshly drawn foregrounds of cacheable controls out of the foreground bitmap;
+		// must be called outside of BeginDraw / EndDraw
+		void direct2d_rendering::capture_foreground_tiles(window_data const& win) {
+			for(auto& c : pending_tile_captures) {
+				auto version = c.ri->foreground_version();
+				if(!version.has_value() || c.rect.width == 0 || c.rect.height == 0)
+					continue;
+
+				auto& tile = foreground_tiles[c.ri];
+				if(!tile.bitmap || tile.width != c.rect.width || tile.height != c.rect.height) {
+					safe_release(tile.bitmap);
+					d2d_device_context->CreateBitmap(D2D1_SIZE_U{ c.rect.width, c.rect.height }, nullptr, 0,
+						D2D1_BITMAP_PROPERTIES1{
+							D2D1::PixelFormat(DXGI_FORMAT_A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+							win.dpi, win.dpi, D2D1_BITMAP_OPTIONS_NONE, nullptr },
+						&tile.bitmap);
+				}
+				if(!tile.bitmap)
+					continue;
+
+				D2D1_POINT_2U dest{ 0, 0 };
+				D2D1_RECT_U src{ c.rect.x_position, c.rect.y_position, uint32_t(c.rect.x_position + c.rect.width), uint32_t(c.rect.y_position + c.rect.height) };
+				if(SUCCEEDED(tile.bitmap->CopyFromBitmap(&dest, foreground, &src))) {
+					tile.content_version = *version;
+					tile.text_generation = win.text_data.text_generation;
+					tile.layout_size = win.layout_size;
+					tile.orientation = win.orientation;
+					tile.width = c.rect.width;
+					tile.height = c.rect.height;
+					tile.last_used_pass = foreground_pass;
+				} else {
+					safe_release(tile.bitmap);
+				}
+			}
+			pending_tile_captures.clear();
+		}
+
+		void direct2d_rendering::release_foreground_tile(layout_interface const* l) {
+			if(auto it = foreground_tiles.find(l); it != foreground_tiles.end()) {
+				safe_release(it->second.bitmap);
+				foreground_tiles.erase(it);
+			}
+		}
+
+		void direct2d_rendering::release_foreground_tiles() {
+			for(auto& t : foreground_tiles) {
+				safe_release(t.second.bitmap);
+			}
+			foreground_tiles.clear();
+			pending_tile_captures.clear();
+		}
+
 		void direct2d_rendering::foregrounds(std::vector<ui_rectangle>& uirects, window_data& win) {
 			d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
+			++foreground_pass;
 
 			ID2D1RectangleGeometry* screen_rect_geom = nullptr;
 			ID2D1GeometryGroup* with_preserved_rects = nullptr;
@@ -1351,11 +1267,15 @@ namespace printui {
 				} else {
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
 
-					if(r.parent_object.get_render_interface()) {
+					if(auto ri = r.parent_object.get_render_interface(); ri) {
 						d2d_device_context->PushAxisAlignedClip(D2D1_RECT_F{
 						float(r.x_position), float(r.y_position),
 						float(r.x_position + r.width), float(r.y_position + r.height) }, D2D1_ANTIALIAS_MODE_ALIASED);
-						r.parent_object->render_foreground(r, win);
+						if(!draw_foreground_tile(r, ri, win)) {
+							ri->render_foreground(r, win);
+							if(ri->foreground_version().has_value())
+								pending_tile_captures.push_back(pending_tile_capture{ ri, r });
+						}
 						d2d_device_context->PopAxisAlignedClip();
 					}
 
@@ -1368,6 +1288,16 @@ namespace printui {
 			safe_release(screen_rect_geom);
 			safe_release(old_rects);
 			safe_release(with_preserved_rects);
+
+			// tiles for controls that are no longer visible are dropped
+			for(auto it = foreground_tiles.begin(); it != foreground_tiles.end(); ) {
+				if(it->second.last_used_pass != foreground_pass) {
+					safe_release(it->second.bitmap);
+					it = foreground_tiles.erase(it);
+				} else {
+					++it;
+				}
+			}
 		}
 
 		void direct2d_rendering::setup_icon_transform(window_data const& win, float edge_padding, int32_t xsize, int32_t ysize) {
@@ -1638,6 +1568,8 @@ namespace printui {
 			}
 
 			win.text_interface.release_text_format(label_format);
+
+			device_resources.rasterized(device_resource::interactable_tags);
 		}
 
 
@@ -1649,10 +1581,162 @@ namespace printui {
 			for(uint32_t i = 0; i < icons.size(); ++i) {
 				icons[i].redraw_image(win, *this);
 			}
+			device_resources.rasterized(device_resource::icons);
 
 			create_interactiable_tags(win);
 		}
 
+		// reads the masks that have been rasterized since they were last captured back into their cpu side copies;
+		// they are copied next to each other into a single readback bitmap, so that there is one wait for the gpu
+		// rather than one per mask
+		void direct2d_rendering::capture_device_copies() {
+			struct mask_copy {
+				ID2D1Bitmap1* source = nullptr;
+				alpha_image* target = nullptr;
+				D2D1_POINT_2U at{ 0, 0 };
+				D2D1_SIZE_U size{ 0, 0 };
+			};
+			std::vector<mask_copy> copies;
+			auto add = [&](ID2D1Bitmap1* bmp, alpha_image& target) {
+				target = alpha_image{};
+				if(bmp)
+					copies.push_back(mask_copy{ bmp, &target, D2D1_POINT_2U{ 0, 0 }, bmp->GetPixelSize() });
+			};
+
+			bool const capture_icons = device_resources.needs_capture(device_resource::icons);
+			bool const capture_tags = device_resources.needs_capture(device_resource::interactable_tags);
+			if(capture_icons) {
+				add(horizontal_interactable_bg.rendered_layer, horizontal_interactable_bg.cached_layer);
+				add(vertical_interactable_bg.rendered_layer, vertical_interactable_bg.cached_layer);
+				add(group_interactable_bg.rendered_layer, group_interactable_bg.cached_layer);
+				for(auto& i : icons) {
+					add(i.rendered_layer, i.cached_layer);
+				}
+			}
+			if(capture_tags) {
+				for_each_interactable_tag([&](ID2D1Bitmap1*& bmp, alpha_image& cache) {
+					add(bmp, cache);
+				});
+			}
+
+			// the masks are stacked in columns of limited height
+			constexpr uint32_t max_column_height = 4096;
+			uint32_t x = 0;
+			uint32_t y = 0;
+			uint32_t column_width = 0;
+			uint32_t total_height = 0;
+			for(auto& c : copies) {
+				if(y > 0 && y + c.size.height > max_column_height) {
+					x += column_width;
+					y = 0;
+					column_width = 0;
+				}
+				c.at = D2D1_POINT_2U{ x, y };
+				y += c.size.height;
+				column_width = std::max(column_width, c.size.width);
+				total_height = std::max(total_height, y);
+			}
+
+			HRESULT hr = S_OK;
+			if(!copies.empty()) {
+				float dpi_x = 96.0f;
+				float dpi_y = 96.0f;
+				copies[0].source->GetDpi(&dpi_x, &dpi_y);
+
+				ID2D1Bitmap1* readback = nullptr;
+				hr = d2d_device_context->CreateBitmap(D2D1_SIZE_U{ x + column_width, total_height }, nullptr, 0,
+					D2D1_BITMAP_PROPERTIES1{
+						D2D1::PixelFormat(DXGI_FORMAT_A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+						dpi_x, dpi_y, D2D1_BITMAP_OPTIONS_CPU_READ | D2D1_BITMAP_OPTIONS_CANNOT_DRAW, nullptr },
+					&readback);
+				for(auto& c : copies) {
+					if(SUCCEEDED(hr))
+						hr = readback->CopyFromBitmap(&c.at, c.source, nullptr);
+				}
+				D2D1_MAPPED_RECT mapped{ 0, nullptr };
+				if(SUCCEEDED(hr)) {
+					hr = readback->Map(D2D1_MAP_OPTIONS_READ, &mapped);
+				}
+				if(SUCCEEDED(hr)) {
+					for(auto& c : copies) {
+						c.target->width = c.size.width;
+						c.target->height = c.size.height;
+						c.target->pixels.resize(size_t(c.size.width) * size_t(c.size.height));
+						for(uint32_t row = 0; row < c.size.height; ++row) {
+							memcpy(c.target->pixels.data() + size_t(row) * c.size.width, mapped.bits + size_t(c.at.y + row) * mapped.pitch + c.at.x, c.size.width);
+						}
+					}
+					readback->Unmap();
+				}
+				safe_release(readback);
+			}
+
+			// on failure the copies stay invalid, and a device loss rasterizes the masks again instead
+			if(SUCCEEDED(hr)) {
+				if(capture_icons)
+					device_resources.captured(device_resource::icons);
+				if(capture_tags)
+					device_resources.captured(device_resource::interactable_tags);
+			}
+		}
+
+		ID2D1Bitmap1* direct2d_rendering::upload_mask(alpha_image const& img, float dpi) {
+			ID2D1Bitmap1* result = nullptr;
+			d2d_device_context->CreateBitmap(D2D1_SIZE_U{ img.width, img.height }, img.pixels.data(), img.width,
+				D2D1_BITMAP_PROPERTIES1{
+					D2D1::PixelFormat(DXGI_FORMAT_A8_UNORM, D2D1_ALPHA_MODE_PREMULTIPLIED),
+					dpi, dpi, D2D1_BITMAP_OPTIONS_NONE, nullptr },
+				&result);
+			return result;
+		}
+
+		// called once a replacement device exists; restores what the tracker says can come from the cpu side
+		// copies and only rasterizes again what has no valid copy
+		void direct2d_rendering::recover_device_resources(window_data& win) {
+			switch(device_resources.required_action(device_resource::icons)) {
+				case resource_action::upload_from_cache:
+					horizontal_interactable_bg.restore_image(win, *this);
+					vertical_interactable_bg.restore_image(win, *this);
+					group_interactable_bg.restore_image(win, *this);
+					for(auto& i : icons) {
+						i.restore_image(win, *this);
+					}
+					device_resources.uploaded(device_resource::icons);
+					break;
+				case resource_action::rebuild:
+					horizontal_interactable_bg.redraw_image(win, *this);
+					vertical_interactable_bg.redraw_image(win, *this);
+					group_interactable_bg.redraw_image(win, *this);
+					for(auto& i : icons) {
+						i.redraw_image(win, *this);
+					}
+					device_resources.rasterized(device_resource::icons);
+					break;
+				case resource_action::none:
+					break;
+			}
+
+			switch(device_resources.required_action(device_resource::interactable_tags)) {
+				case resource_action::upload_from_cache:
+					for_each_interactable_tag([&](ID2D1Bitmap1*& bmp, alpha_image& cache) {
+						safe_release(bmp);
+						bmp = upload_mask(cache, win.dpi);
+					});
+					device_resources.uploaded(device_resource::interactable_tags);
+					break;
+				case resource_action::rebuild:
+					create_interactiable_tags(win);
+					break;
+				case resource_action::none:
+					break;
+			}
+
+			if(window_size_resources_lost && win.ui_width > 0 && win.ui_height > 0) {
+				window_size_resources_lost = false;
+				create_window_size_resources(win);
+			}
+		}
+
 		void direct2d_rendering::recreate_dpi_dependent_resource(window_data& win) {
 			redraw_icons(win);
 		}
@@ -1685,66 +1769,164 @@ namespace printui {
 			);
 		}
 
-		void direct2d_rendering::create_palette(window_data const& win) {
+		// runs on a worker thread, so it uses its own WIC factory rather than the one owned by the renderer;
+		// the window is invalidated once the pixels have been published so that the next frame can pick them up
+		void decode_texture(std::wstring const& file_name, HWND notify_window, texture_decode& target) {
+			if(target.cancelled.load(std::memory_order_acquire))
+				return;
+
+			std::optional<rgba_image> result;
+
+			HRESULT com_init = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+			IWICImagingFactory* factory = nullptr;
+			IWICBitmapDecoder* pDecoder = nullptr;
+			IWICBitmapFrameDecode* pSource = nullptr;
+			IWICFormatConverter* pConverter = nullptr;
+
+			rgba_image img;
+
+			HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr, CLSCTX_INPROC_SERVER, IID_IWICImagingFactory, reinterpret_cast<void**>(&factory));
+			if(SUCCEEDED(hr)) {
+				hr = factory->CreateDecoderFromFilename(file_name.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, &pDecoder);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = pDecoder->GetFrame(0, &pSource);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = factory->CreateFormatConverter(&pConverter);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = pConverter->Initialize(
+					pSource, GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone,
+					nullptr, 0.f, WICBitmapPaletteTypeMedianCut);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = pConverter->GetSize(&img.width, &img.height);
+			}
+			if(SUCCEEDED(hr)) {
+				img.pixels.resize(size_t(img.width) * size_t(img.height));
+				hr = pConverter->CopyPixels(nullptr, img.width * sizeof(uint32_t), UINT(img.pixels.size() * sizeof(uint32_t)), (BYTE*)(img.pixels.data()));
+			}
+			if(SUCCEEDED(hr)) {
+				result = std::move(img);
+			}
+
+			safe_release(pConverter);
+			safe_release(pSource);
+			safe_release(pDecoder);
+			safe_release(factory);
+
+			if(SUCCEEDED(com_init))
+				CoUninitialize();
+
+			if(target.cancelled.load(std::memory_order_acquire))
+				return;
+			bool const decoded = result.has_value();
+			target.result = std::move(result);
+			target.complete.store(true, std::memory_order_release);
+			if(decoded && notify_window)
+				InvalidateRect(notify_window, nullptr, FALSE);
+		}
+
+		// decoded pixels are kept on the cpu side, so a device loss only has to recreate the d2d bitmaps;
+		// a decode is only restarted when the file a brush refers to changes
+		void direct2d_rendering::start_texture_decodes(window_data& win) {
+			for(size_t i = win.dynamic_settings.brushes.size(); i < palette_textures.size(); ++i) {
+				if(palette_textures[i].pending_decode)
+					palette_textures[i].pending_decode->cancelled.store(true, std::memory_order_release);
+			}
+			palette_textures.resize(win.dynamic_settings.brushes.size());
+
+			for(size_t i = 0; i < win.dynamic_settings.brushes.size(); ++i) {
+				auto& b = win.dynamic_settings.brushes[i];
+				auto& t = palette_textures[i];
+
+				std::wstring file_name;
+				if(b.texture.length() > 0) {
+					auto pth = win.file_system.resolve_file_path(b.texture, win.dynamic_settings.texture_directory);
+					if(pth.has_value())
+						file_name = *pth;
+				}
+
+				if(file_name == t.file_name)
+					continue;
+
+				t.file_name = file_name;
+				t.decoded.reset();
+				// a decode of the previous file is not waited for; it sees the flag and throws its pixels away
+				if(t.pending_decode)
+					t.pending_decode->cancelled.store(true, std::memory_order_release);
+				t.pending_decode.reset();
+				if(file_name.length() > 0) {
+					t.pending_decode = std::make_shared<texture_decode>();
+					texture_jobs.submit([file_name, hwnd = (HWND)(win.window_interface.get_hwnd()), target = t.pending_decode]() {
+						decode_texture(file_name, hwnd, *target);
+					});
+				}
+			}
+		}
+
+		bool direct2d_rendering::create_texture_brush(size_t i) {
+			auto const& img = *palette_textures[i].decoded;
+
+			ID2D1Bitmap1* bmp = nullptr;
+			ID2D1BitmapBrush* t = nullptr;
+
+			HRESULT hr = d2d_device_context->CreateBitmap(D2D1_SIZE_U{ img.width, img.height }, img.pixels.data(), img.width * sizeof(uint32_t),
+				D2D1_BITMAP_PROPERTIES1{
+					D2D1::PixelFormat(
+						DXGI_FORMAT_B8G8R8A8_UNORM,
+						D2D1_ALPHA_MODE_PREMULTIPLIED),
+					96.0f, 96.0f,
+					D2D1_BITMAP_OPTIONS_NONE, nullptr },
+				&bmp);
+			if(SUCCEEDED(hr)) {
+				hr = d2d_device_context->CreateBitmapBrush(bmp, &t);
+			}
+			if(SUCCEEDED(hr)) {
+				t->SetExtendModeX(D2D1_EXTEND_MODE_WRAP);
+				t->SetExtendModeY(D2D1_EXTEND_MODE_WRAP);
+
+				safe_release(palette[i]);
+				safe_release(palette_bitmaps[i]);
+				palette[i] = t;
+				palette_bitmaps[i] = bmp;
+				return true;
+			}
+
+			safe_release(bmp);
+			return false;
+		}
+
+		// swaps the solid color stand-ins for texture brushes whose decode has finished since the last frame
+		void direct2d_rendering::update_palette_textures() {
+			for(size_t i = 0; i < palette_textures.size() && i < palette.size(); ++i) {
+				auto& t = palette_textures[i];
+				if(t.pending_decode && t.pending_decode->complete.load(std::memory_order_acquire)) {
+					t.decoded = std::move(t.pending_decode->result);
+					t.pending_decode.reset();
+					if(t.decoded)
+						create_texture_brush(i);
+				}
+			}
+		}
+
+		void direct2d_rendering::create_palette(window_data& win) {
 			create_highlight_brushes();
 			HRESULT hr = d2d_device_context->CreateSolidColorBrush(D2D1::ColorF(D2D1::ColorF::Black), &dummy_brush);
 
 			palette_bitmaps.resize(win.dynamic_settings.brushes.size(), nullptr);
 			palette.resize(win.dynamic_settings.brushes.size(), nullptr);
 
+			start_texture_decodes(win);
+
 			int32_t i = 0;
 			for(auto& b : win.dynamic_settings.brushes) {
 				if(SUCCEEDED(hr)) {
-					if(b.texture.length() > 0) {
-						auto pth = win.file_system.resolve_file_path(b.texture, win.dynamic_settings.texture_directory);
-
-						IWICBitmapDecoder* pDecoder = nullptr;
-						IWICBitmapFrameDecode* pSource = nullptr;
-						IWICStream* pStream = nullptr;
-						IWICFormatConverter* pConverter = nullptr;
-						IWICBitmapScaler* pScaler = nullptr;
-						ID2D1BitmapBrush* t = nullptr;
-
-						if(pth.has_value()) {
-							hr = wic_factory->CreateDecoderFromFilename(pth->c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, &pDecoder);
-						} else {
-							hr = E_FAIL;
-						}
-						if(SUCCEEDED(hr)) {
-							hr = pDecoder->GetFrame(0, &pSource);
-						}
-						if(SUCCEEDED(hr)) {
-							hr = wic_factory->CreateFormatConverter(&pConverter);
-						}
-						if(SUCCEEDED(hr)) {
-							hr = pConverter->Initialize(
-								pSource, GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone,
-								nullptr, 0.f, WICBitmapPaletteTypeMedianCut);
-						}
-						if(SUCCEEDED(hr)) {
-							hr = d2d_device_context->CreateBitmapFromWicBitmap(pConverter, nullptr, &palette_bitmaps[i]);
-						}
-						if(SUCCEEDED(hr)) {
-							hr = d2d_device_context->CreateBitmapBrush(palette_bitmaps[i], &t);
-						}
-						if(SUCCEEDED(hr)) {
-							t->SetExtendModeX(D2D1_EXTEND_MODE_WRAP);
-							t->SetExtendModeY(D2D1_EXTEND_MODE_WRAP);
-							palette[i] = t;
-						}
-
-						safe_release(pDecoder);
-						safe_release(pSource);
-						safe_release(pStream);
-						safe_release(pConverter);
-						safe_release(pScaler);
-
-						if(FAILED(hr)) {
-							ID2D1SolidColorBrush* u;
-							hr = d2d_device_context->CreateSolidColorBrush(D2D1::ColorF(b.rgb.r, b.rgb.g, b.rgb.b, 1.0f), &u);
-							palette[i] = u;
-						};
-					} else {
+					// until the texture has been decoded, the brush is drawn using its solid color
+					bool textured = palette_textures[i].decoded.has_value() && create_texture_brush(size_t(i));
+					if(!textured) {
 						ID2D1SolidColorBrush* t;
 						hr = d2d_device_context->CreateSolidColorBrush(D2D1::ColorF(b.rgb.r, b.rgb.g, b.rgb.b, 1.0f), &t);
 						palette[i] = t;
@@ -1776,6 +1958,7 @@ namespace printui {
 				update_foregrounds(win.get_layout(), win);
 				d2d_device_context->SetTarget(nullptr);
 				d2d_device_context->EndDraw();
+				capture_foreground_tiles(win);
 			} else {
 				d2d_device_context->BeginDraw();
 				d2d_device_context->SetTarget(foreground);
@@ -1787,6 +1970,7 @@ namespace printui {
 
 				d2d_device_context->SetTarget(nullptr);
 				d2d_device_context->EndDraw();
+				capture_foreground_tiles(win);
 				redraw_completely_pending = false;
 			}
 		}
@@ -1809,7 +1993,7 @@ namespace printui {
 
 				hr = D3D11CreateDevice(
 					nullptr,
-					D3D_DRIVER_TYPE_HARDWARE,
+					force_software_device ? D3D_DRIVER_TYPE_WARP : D3D_DRIVER_TYPE_HARDWARE,
 					nullptr,
 					D3D11_CREATE_DEVICE_SINGLETHREADED | D3D11_CREATE_DEVICE_BGRA_SUPPORT,
 					levels, 4,
@@ -1881,6 +2065,10 @@ namespace printui {
 
 				create_palette(win);
 
+				if(SUCCEEDED(hr)) {
+					recover_device_resources(win);
+				}
+
 				if(!SUCCEEDED(hr)) {
 					win.window_interface.display_fatal_error_message(L"Could not create direct X devices, exiting");
 					std::terminate();
@@ -1906,6 +2094,7 @@ namespace printui {
 			
 			safe_release(animation_foreground);
 			safe_release(animation_background);
+			release_animation_timelines();
 
 			// Resize render target buffers
 			d2d_device_context->SetTarget(nullptr);
@@ -1965,6 +2154,33 @@ namespace printui {
 		}
 
 		void direct2d_rendering::release_device_resources() {
+			device_resources.device_lost();
+			window_size_resources_lost = true;
+
+			// everything below was created on the lost device; the cpu side copies are kept for recover_device_resources
+			safe_release(back_buffer_target);
+			safe_release(foreground);
+			safe_release(animation_foreground);
+			safe_release(animation_background);
+
+			safe_release(light_selected);
+			safe_release(light_line);
+			safe_release(light_selected_line);
+			safe_release(dark_selected);
+			safe_release(dark_line);
+			safe_release(dark_selected_line);
+
+			safe_release(horizontal_interactable_bg.rendered_layer);
+			safe_release(vertical_interactable_bg.rendered_layer);
+			safe_release(group_interactable_bg.rendered_layer);
+			for(auto& i : icons) {
+				safe_release(i.rendered_layer);
+			}
+			for_each_interactable_tag([](ID2D1Bitmap1*& bmp, alpha_image&) {
+				safe_release(bmp);
+			});
+			release_foreground_tiles();
+
 			safe_release(d3d_device);
 			safe_release(d3d_device_context);
 			safe_release(d2d_device);
@@ -1972,9 +2188,15 @@ namespace printui {
 			safe_release(dxgi_device);
 			safe_release(swap_chain);
 			release_palette();
+			release_animation_timelines();
 		}
 
 		direct2d_rendering::~direct2d_rendering() {
+			for(auto& t : palette_textures) {
+				if(t.pending_decode)
+					t.pending_decode->cancelled.store(true, std::memory_order_release);
+			}
+			texture_jobs.cancel_pending();
 			safe_release(d2d_factory);
 			safe_release(wic_factory);
 
@@ -1988,10 +2210,11 @@ namespace printui {
 			safe_release(plain_strokes);
 
 			safe_release(foreground);
+			release_foreground_tiles();
 
 			safe_release(animation_foreground);
 			safe_release(animation_background);
-
+			release_animation_timelines();
 
 			for(uint32_t i = 0; i < 12; ++i) {
 				safe_release(horizontal_interactable[i]);
@@ -2031,9 +2254,19 @@ namespace printui {
 			if(!back_buffer_target)
 				return;
 
+			update_palette_textures();
+
 			if(!is_suspended) {
+				profiler.enabled = win.dynamic_settings.frame_profiling;
+				profiler.begin_frame(profiler.clock());
+
+				auto stage_start = profiler.clock();
+				win.get_layout();
+				profiler.record_stage(frame_stage::layout, stage_start, profiler.clock());
 
+				stage_start = profiler.clock();
 				refresh_foregound(win);
+				profiler.record_stage(frame_stage::foreground, stage_start, profiler.clock());
 
 				if(win.window_interface.is_mouse_cursor_visible()) {
 					win.last_under_cursor = reference_under_point(win, win.get_ui_rects(), win.last_cursor_x_position, win.last_cursor_y_position, true);
@@ -2044,18 +2277,23 @@ namespace printui {
 				previous_frame_in_place_animation = running_in_place_animation;
 				running_in_place_animation = false;
 
-				if(animation_status.is_running == false) {
+				if(!animations_running()) {
 					d2d_device_context->BeginDraw();
 					d2d_device_context->SetTarget(back_buffer_target);
 					d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
 					d2d_device_context->Clear(D2D1::ColorF(0.5f, 0.5f, 0.5f, 1.0f));
 
+					stage_start = profiler.clock();
 					to_display(win.get_layout(), win);
+					profiler.record_stage(frame_stage::display, stage_start, profiler.clock());
 
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
 					if(win.window_border != 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->DrawRectangle(D2D1_RECT_F{ win.window_border / 2.0f, win.window_border / 2.0f, float(win.ui_width) - win.window_border / 2.0f, float(win.ui_height) - win.window_border / 2.0f }, palette[1], float(win.window_border), plain_strokes);
 					}
+					if(profiler.enabled && profiler.show_overlay)
+						draw_profiler_overlay(win);
 					d2d_device_context->SetTarget(nullptr);
 					hr = d2d_device_context->EndDraw();
 				} else {
@@ -2064,10 +2302,13 @@ namespace printui {
 					d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
 					d2d_device_context->Clear(D2D1::ColorF(0.5f, 0.5f, 0.5f, 1.0f));
 
+					stage_start = profiler.clock();
 					to_display(win.get_layout(), win);
+					profiler.record_stage(frame_stage::display, stage_start, profiler.clock());
 
 					d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
 					if(win.window_border != 0) {
+						++profiler.current.draw_calls;
 						d2d_device_context->DrawRectangle(D2D1_RECT_F{ win.window_border / 2.0f, win.window_border / 2.0f, float(win.ui_width) - win.window_border / 2.0f, float(win.ui_height) - win.window_border / 2.0f }, palette[1], float(win.window_border), plain_strokes);
 					}
 
@@ -2076,7 +2317,12 @@ namespace printui {
 					d2d_device_context->Clear(D2D1::ColorF(0.5f, 0.5f, 0.5f, 1.0f));
 
 
+					stage_start = profiler.clock();
 					composite_animation(win, win.ui_width, win.ui_height);
+					profiler.record_stage(frame_stage::composite, stage_start, profiler.clock());
+
+					if(profiler.enabled && profiler.show_overlay)
+						draw_profiler_overlay(win);
 
 					d2d_device_context->SetTarget(nullptr);
 					hr = d2d_device_context->EndDraw();
@@ -2086,7 +2332,15 @@ namespace printui {
 					win.window_interface.invalidate_window();
 
 				DXGI_PRESENT_PARAMETERS params{ 0, nullptr, nullptr, nullptr };
+				stage_start = profiler.clock();
 				hr = swap_chain->Present1(1, 0, &params);
+				profiler.record_stage(frame_stage::present, stage_start, profiler.clock());
+
+				profiler.end_frame(profiler.clock());
+
+				// once nothing is animating, masks drawn since the last capture are copied back for use after a device loss
+				if(!running_in_place_animation && !animations_running())
+					capture_device_copies();
 			} else {
 				DXGI_PRESENT_PARAMETERS params{ 0, nullptr, nullptr, nullptr };
 				hr = swap_chain->Present1(1, DXGI_PRESENT_TEST, &params);
@@ -2115,6 +2369,8 @@ namespace printui {
 				d2d_device_context->SetTextAntialiasMode(D2D1_TEXT_ANTIALIAS_MODE_GRAYSCALE);
 				if(rparams)
 					d2d_device_context->SetTextRenderingParams(rparams);
+				++profiler.current.draw_calls;
+				++profiler.current.text_draws;
 				d2d_device_context->DrawTextLayout(D2D1_POINT_2F{ float(x), float(y) }, (IDWriteTextLayout*)dwl, dummy_brush, 0 /*D2D1_DRAW_TEXT_OPTIONS_CLIP*/);
 				d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
 			}
@@ -2125,9 +2381,193 @@ namespace printui {
 		}
 		void direct2d_rendering::fill_rectangle(screen_space_rect location, uint8_t b) {
 			D2D_RECT_F rect{float(location.x), float(location.y), float(location.x + location.width), float(location.y + location.height) };
+			++profiler.current.draw_calls;
 			d2d_device_context->FillRectangle(rect, palette[b]);
 		}
 
+		// one bar per recorded frame, oldest on the left; the horizontal line marks a 60 fps frame budget
+		void direct2d_rendering::draw_profiler_overlay(window_data const& win) {
+			constexpr float bar_width = 2.0f;
+			constexpr float graph_height = 64.0f;
+			constexpr float microseconds_per_pixel = 33333.0f / graph_height;
+
+			float const graph_width = bar_width * frame_profiler::history_size;
+			float const left = float(win.ui_width) - graph_width - float(win.window_border) - 4.0f;
+			float const bottom = float(win.window_border) + 4.0f + graph_height;
+
+			d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
+			palette[0]->SetOpacity(0.75f);
+			d2d_device_context->FillRectangle(D2D1_RECT_F{ left, bottom - graph_height, left + graph_width, bottom }, palette[0]);
+			palette[0]->SetOpacity(1.0f);
+
+			uint32_t oldest = profiler.records_stored < frame_profiler::history_size ? 0 : profiler.next_record;
+			for(uint32_t i = 0; i < profiler.records_stored; ++i) {
+				auto const& r = profiler.history[(oldest + i) % frame_profiler::history_size];
+				float const height = std::min(graph_height, float(r.total_duration) / microseconds_per_pixel);
+				d2d_device_context->FillRectangle(D2D1_RECT_F{ left + i * bar_width, bottom - height, left + (i + 1) * bar_width, bottom }, palette[1]);
+			}
+
+			float const budget_y = bottom - 16667.0f / microseconds_per_pixel;
+			d2d_device_context->DrawLine(D2D1_POINT_2F{ left, budget_y }, D2D1_POINT_2F{ left + graph_width, budget_y }, palette[1], 1.0f, plain_strokes);
+
+			// the 95th percentile frame time, dimmed
+			float const p95_y = bottom - std::min(graph_height, float(profiler.total_statistics().p95) / microseconds_per_pixel);
+			palette[1]->SetOpacity(0.5f);
+			d2d_device_context->DrawLine(D2D1_POINT_2F{ left, p95_y }, D2D1_POINT_2F{ left + graph_width, p95_y }, palette[1], 1.0f, plain_strokes);
+			palette[1]->SetOpacity(1.0f);
+		}
+
+		// renders the current layout into animation_foreground, which is not shown directly, and reads it back
+		// through a cpu readable copy; the window itself does not need to be visible
+		rgba_image direct2d_rendering::render_to_image(window_data& win) {
+			rgba_image result;
+
+			create_device_resources(win);
+			if(!animation_foreground)
+				create_window_size_resources(win);
+			if(!animation_foreground)
+				return result;
+
+			stop_ui_animations(win);
+			refresh_foregound(win);
+
+			d2d_device_context->BeginDraw();
+			d2d_device_context->SetTarget(animation_foreground);
+			d2d_device_context->SetAntialiasMode(D2D1_ANTIALIAS_MODE_ALIASED);
+			d2d_device_context->Clear(D2D1::ColorF(0.5f, 0.5f, 0.5f, 1.0f));
+
+			to_display(win.get_layout(), win);
+
+			d2d_device_context->SetTransform(D2D1::Matrix3x2F::Identity());
+			if(win.window_border != 0) {
+				d2d_device_context->DrawRectangle(D2D1_RECT_F{ win.window_border / 2.0f, win.window_border / 2.0f, float(win.ui_width) - win.window_border / 2.0f, float(win.ui_height) - win.window_border / 2.0f }, palette[1], float(win.window_border), plain_strokes);
+			}
+			d2d_device_context->SetTarget(nullptr);
+			HRESULT hr = d2d_device_context->EndDraw();
+
+			ID2D1Bitmap1* readback = nullptr;
+			if(SUCCEEDED(hr)) {
+				hr = d2d_device_context->CreateBitmap(D2D1_SIZE_U{ win.ui_width, win.ui_height }, nullptr, 0,
+					D2D1_BITMAP_PROPERTIES1{
+						D2D1::PixelFormat(
+							DXGI_FORMAT_B8G8R8A8_UNORM,
+							D2D1_ALPHA_MODE_PREMULTIPLIED),
+						win.dpi, win.dpi,
+						D2D1_BITMAP_OPTIONS_CPU_READ | D2D1_BITMAP_OPTIONS_CANNOT_DRAW, nullptr },
+					&readback);
+			}
+			if(SUCCEEDED(hr)) {
+				D2D1_POINT_2U dest{ 0, 0 };
+				D2D1_RECT_U src{ 0, 0, win.ui_width, win.ui_height };
+				hr = readback->CopyFromBitmap(&dest, animation_foreground, &src);
+			}
+			D2D1_MAPPED_RECT mapped{ 0, nullptr };
+			if(SUCCEEDED(hr)) {
+				hr = readback->Map(D2D1_MAP_OPTIONS_READ, &mapped);
+			}
+			if(SUCCEEDED(hr)) {
+				result.width = win.ui_width;
+				result.height = win.ui_height;
+				result.pixels.resize(size_t(win.ui_width) * size_t(win.ui_height));
+				for(uint32_t y = 0; y < win.ui_height; ++y) {
+					memcpy(result.pixels.data() + size_t(y) * win.ui_width, mapped.bits + size_t(y) * mapped.pitch, win.ui_width * sizeof(uint32_t));
+				}
+				readback->Unmap();
+			}
+			safe_release(readback);
+
+			return result;
+		}
+
+		bool direct2d_rendering::save_image(rgba_image const& img, std::wstring const& file_name) {
+			if(!wic_factory || img.width == 0 || img.height == 0)
+				return false;
+
+			IWICStream* stream = nullptr;
+			IWICBitmapEncoder* encoder = nullptr;
+			IWICBitmapFrameEncode* frame = nullptr;
+
+			HRESULT hr = wic_factory->CreateStream(&stream);
+			if(SUCCEEDED(hr)) {
+				hr = stream->InitializeFromFilename(file_name.c_str(), GENERIC_WRITE);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = wic_factory->CreateEncoder(GUID_ContainerFormatPng, nullptr, &encoder);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = encoder->Initialize(stream, WICBitmapEncoderNoCache);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = encoder->CreateNewFrame(&frame, nullptr);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = frame->Initialize(nullptr);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = frame->SetSize(img.width, img.height);
+			}
+			WICPixelFormatGUID format = GUID_WICPixelFormat32bppPBGRA;
+			if(SUCCEEDED(hr)) {
+				hr = frame->SetPixelFormat(&format);
+			}
+			if(SUCCEEDED(hr) && format != GUID_WICPixelFormat32bppPBGRA) {
+				hr = E_FAIL;
+			}
+			if(SUCCEEDED(hr)) {
+				hr = frame->WritePixels(img.height, img.width * sizeof(uint32_t), UINT(img.pixels.size() * sizeof(uint32_t)), (BYTE*)(img.pixels.data()));
+			}
+			if(SUCCEEDED(hr)) {
+				hr = frame->Commit();
+			}
+			if(SUCCEEDED(hr)) {
+				hr = encoder->Commit();
+			}
+
+			safe_release(frame);
+			safe_release(encoder);
+			safe_release(stream);
+
+			return SUCCEEDED(hr);
+		}
+
+		std::optional<rgba_image> direct2d_rendering::load_image(std::wstring const& file_name) {
+			if(!wic_factory)
+				return std::optional<rgba_image>{};
+
+			IWICBitmapDecoder* decoder = nullptr;
+			IWICBitmapFrameDecode* source = nullptr;
+			IWICFormatConverter* converter = nullptr;
+
+			rgba_image result;
+
+			HRESULT hr = wic_factory->CreateDecoderFromFilename(file_name.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad, &decoder);
+			if(SUCCEEDED(hr)) {
+				hr = decoder->GetFrame(0, &source);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = wic_factory->CreateFormatConverter(&converter);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = converter->Initialize(source, GUID_WICPixelFormat32bppPBGRA, WICBitmapDitherTypeNone,
+					nullptr, 0.f, WICBitmapPaletteTypeMedianCut);
+			}
+			if(SUCCEEDED(hr)) {
+				hr = converter->GetSize(&result.width, &result.height);
+			}
+			if(SUCCEEDED(hr)) {
+				result.pixels.resize(size_t(result.width) * size_t(result.height));
+				hr = converter->CopyPixels(nullptr, result.width * sizeof(uint32_t), UINT(result.pixels.size() * sizeof(uint32_t)), (BYTE*)(result.pixels.data()));
+			}
+
+			safe_release(converter);
+			safe_release(source);
+			safe_release(decoder);
+
+			if(FAILED(hr))
+				return std::optional<rgba_image>{};
+			return result;
+		}
+
 		void direct2d_rendering::draw_icon(int32_t x, int32_t y, uint8_t ico, uint8_t br) {
 			icons[ico].present_image(float(x), float(y), *this, palette[br]);
 		}
@@ -2178,9 +2618,16 @@ namespace printui {
 			}
 		}
 
+		void icon::restore_image(window_data const& win, direct2d_rendering& ri) {
+			safe_release(rendered_layer);
+			if(cached_layer.pixels.size() > 0)
+				rendered_layer = ri.upload_mask(cached_layer, win.dpi);
+		}
+
 		void icon::present_image(float x, float y, direct2d_rendering& ri, ID2D1Brush* br) {
 			if(rendered_layer) {
 				ri.d2d_device_context->SetTransform(D2D1::Matrix3x2F::Translation(x, y));
+				++ri.profiler.current.draw_calls;
 				ri.d2d_device_context->FillOpacityMask(
 					rendered_layer,
 					br,
@@ -870,7 +870,7 @@ namespace printui {
 		}
 	}
 
-	void key_name_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void key_name_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto first_char_length = next_valid_cursor_position(0);
 		if(first_char_length > 0) {
 			win.dynamic_settings.keys.main_keys[key].display_name = txt.substr(0, first_char_length);
@@ -991,7 +991,7 @@ namespace printui {
 		}
 	}
 
-	void font_top_lead_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void font_top_lead_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_int(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > -11) {
 			extracted_value = std::clamp(extracted_value, -10i64, 20i64);
@@ -1026,7 +1026,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void font_bottom_lead_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void font_bottom_lead_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_int(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > -11) {
 			extracted_value = std::clamp(extracted_value, -10i64, 20i64);
@@ -1061,7 +1061,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void font_weight_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void font_weight_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_int(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0) {
 			extracted_value = std::clamp(extracted_value, 100i64, 900i64);
@@ -1096,7 +1096,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void small_relative_size::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void small_relative_size::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0) {
 			extracted_value = std::clamp(extracted_value, 0.5, 1.0);
@@ -1118,7 +1118,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void header_relative_size::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void header_relative_size::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0) {
 			extracted_value = std::clamp(extracted_value, 1.0, 2.0);
@@ -1140,7 +1140,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void font_stretch_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void font_stretch_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0) {
 			extracted_value = std::clamp(extracted_value, 50.0, 200.0);
@@ -1347,7 +1347,7 @@ namespace printui {
 		}
 	}
 
-	void ui_scale_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void ui_scale_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0.0) {
 			extracted_value = std::clamp(extracted_value, 0.5, 3.0);
@@ -1366,7 +1366,7 @@ namespace printui {
 		}
 	}
 
-	void deadzone_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void deadzone_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0.0) {
 			extracted_value = std::clamp(extracted_value, 0.0, 90.0) / 100.0;
@@ -1377,7 +1377,7 @@ namespace printui {
 		quiet_set_text(win, result_to_str.text_content.text);
 	}
 
-	void sensitivity_edit::on_edit_finished(window_data& win, std::wstring const& txt) {
+	void sensitivity_edit::on_edit_finished(window_data& win, std::wstring_view txt) {
 		auto extracted_value = win.text_data.text_to_double(txt.data(), uint32_t(txt.length()));
 		if(extracted_value > 0.0) {
 			extracted_value = std::clamp(extracted_value, 0.1, 3.0);
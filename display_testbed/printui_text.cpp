@@ -12,7 +12,6 @@
 #include <dwrite_3.h>
 #include <Shlobj.h>
 #include <wchar.h>
-#include <usp10.h>
 #include <initguid.h>
 #include <inputscope.h>
 #include <Textstor.h>
@@ -24,7 +23,6 @@
 #include "printui_text_definitions.hpp"
 #include "printui_windows_definitions.hpp"
 
-#pragma comment(lib, "Usp10.lib")
 #pragma comment(lib, "icu.lib")
 #pragma comment(lib, "Dwrite.lib")
 
@@ -39,1009 +37,25 @@ namespace printui::text {
 		}
 	};
 
-	text_with_formatting& text_with_formatting::operator+=(text_with_formatting const& o) {
-		auto old_length = text.length();
-		text += o.text;
-		for(auto& f : o.formatting) {
-			formatting.push_back(format_marker{ uint16_t(f.position + old_length), f.format });
-		}
-		return *this;
-	}
-
-	void text_with_formatting::append(text_data_storage const& tm, static_text_with_formatting const& o) {
-		auto old_length = text.length();
-
-		text.append(tm.codepoint_storage.data() + o.code_points_start, tm.codepoint_storage.data() + o.code_points_start + o.code_points_count);
-
-		for(uint32_t i = o.formatting_start; i < o.formatting_end; ++i) {
-			formatting.push_back(format_marker{ uint16_t(tm.static_format_storage[i].position + old_length), tm.static_format_storage[i].format });
-		}
-	}
-
-	void text_with_formatting::make_substitutions(replaceable_instance const* start, replaceable_instance const* end) {
-		auto num_params = end - start;
-		auto const old_formatting_size = formatting.size();
-
-		for(uint32_t i = 0; i < old_formatting_size; ++i) {
-			if(std::holds_alternative<parameter_id>(formatting[i].format)) {
-				auto id = std::get<parameter_id>(formatting[i].format).id;
-
-				const auto old_start = formatting[i].position;
-				auto old_end = old_start + 1;
-
-				if(id < num_params) {
-					formatting[i].format = substitution_mark{ id };
-
-					const auto length_difference = start[id].text_content.text.length() - 1;
-
-					text.replace(old_start, 1, start[id].text_content.text);
-
-					formatting.push_back(format_marker{ uint16_t(start[id].text_content.text.length() + old_start), substitution_mark{ id } });
-
-					for(uint32_t j = 0; j < formatting.size(); ++j) {
-						if(formatting[j].position >= old_end) {
-							formatting[j].position += uint16_t(length_difference);
-						}
-					}
-
-					for(auto& f : start[id].text_content.formatting) {
-						formatting.push_back(format_marker{ uint16_t(f.position + old_start), f.format });
-					}
-				}
-			}
-		}
-
-		std::sort(formatting.begin(), formatting.end());
-	}
-
-	bool matched_pattern::matches_parameters(text_data_storage const& tm, replaceable_instance const* param_start, replaceable_instance const* param_end) const {
-
-		for(uint32_t i = 0; i < num_keys; ++i) {
-			auto key = tm.match_keys_storage[match_key_start + i];
-			if(key.parameter_id > (param_end - param_start))
-				return false;
-			bool matched_one = false;
-			for(uint32_t j = 0; !matched_one && j < replaceable_instance::max_attributes; ++j) {
-				if(param_start[key.parameter_id].attributes[j] == key.attribute)
-					matched_one = true;
-			}
-			if(!matched_one)
-				return false;
-		}
-
-		return true;
-	}
-
-
-	replaceable_instance text_manager::parameter_to_text(text_parameter p) const {
-		replaceable_instance result;
+	void text_manager::parameter_to_text(text_parameter p, replaceable_instance& out) const {
 		if(std::holds_alternative<int_param>(p)) {
 			auto value = std::get<int_param>(p);
-			return format_int(value.value, value.decimal_places);
+			format_int_into(value.value, value.decimal_places, out);
 		} else if(std::holds_alternative<fp_param>(p)) {
 			auto value = std::get<fp_param>(p);
-			return format_double(value.value, value.decimal_places);
+			format_double_into(value.value, value.decimal_places, out);
 		} else if(std::holds_alternative<text_id>(p)) {
-			result = text_data.stored_functions[std::get<text_id>(p).id].instantiate(text_data, nullptr, nullptr);
-		}
-		return result;
-	}
-
-	replaceable_instance text_function::instantiate(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end) const {
-
-		replaceable_instance result;
-		result.attributes = attributes;
-
-		int32_t last_matched_group = -1;
-
-		for(uint32_t j = 0; j < pattern_count; ++j) {
-			auto& pattern = tm.static_matcher_storage[begin_patterns + j];
-			if(int32_t(pattern.group) != last_matched_group && pattern.matches_parameters(tm, start, end)) {
-				last_matched_group = int32_t(pattern.group);
-				result.text_content.append(tm, pattern.base_text);
-			}
-		}
-
-		return result;
-	}
-
-	
-
-	/*
-	n 	the absolute value of N.*
-	i 	the integer digits of N.*
-	v 	the number of visible fraction digits in N, with trailing zeros.*
-	w 	the number of visible fraction digits in N, without trailing zeros.*
-	f 	the visible fraction digits in N, with trailing zeros, expressed as an integer.*
-	t 	the visible fraction digits in N, without trailing zeros, expressed as an integer.*
-	c 	compact decimal exponent value: exponent of the power of 10 used in compact decimal formatting.
-	e 	a deprecated synonym for ‘c’. Note: it may be redefined in the future.
-	*/
-
-	int64_t remove_zeros(int64_t f) {
-		while(f % 10 == 0) {
-			f = f / 10;
-		}
-		return f;
-	}
-
-	attribute_type card_2am(int64_t i, int64_t f, int32_t ) {
-		if(i == 0 || (std::abs(i) == 1 && f == 0))
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2ff(int64_t i, int64_t , int32_t ) {
-		if(i == 0 || i == 1)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2ast(int64_t i, int64_t , int32_t v) {
-		if(i == 1 && v == 0)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2si(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1 || i == 0) && f == 0)
-			return text::one;
-		else if(i == 0 && f == 1)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2ak(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1 || i == 0) && f == 0)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2tzm(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1 || i == 0 || (std::abs(i) >= 11 && std::abs(i) <= 99)) && f == 0)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2af(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1) && f == 0)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2da(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1) && f == 0)
-			return text::one;
-		else if((i == 0 || i == 1) && f != 0)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2is(int64_t i, int64_t f, int32_t ) {
-		if((i % 10 == 1) && (i % 100 != 11) && f == 0)
-			return text::one;
-		else if(remove_zeros(f) % 10 == 1 && remove_zeros(f) % 100 != 11)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2mk(int64_t i, int64_t f, int32_t v) {
-		if(v == 0 && i % 10 == 1 && i % 100 != 11)
-			return text::one;
-		else if(f % 10 == 1 && f % 100 != 11)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_2ceb(int64_t i, int64_t f, int32_t v) {
-		if(v == 0 && (i == 1 || i == 2 || i == 3))
-			return text::one;
-		else if(v == 0 && i % 10 != 4 && i % 10 != 6 && i % 10 != 9)
-			return text::one;
-		else if(v != 0 && f % 10 != 4 && f % 10 != 6 && f % 10 != 9)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3lv(int64_t i, int64_t f, int32_t v) {
-		if(f == 0 && (i % 10 == 0 || (i % 100 >= 11 && i % 100 <= 19)))
-			return text::zero;
-		else if(v == 2 && f % 100 >= 11 && f % 100 <= 19)
-			return text::zero;
-		else if(f == 0 && std::abs(i) % 10 == 1 && std::abs(i) % 100 != 11)
-			return text::one;
-		else if(v == 2 && f % 10 == 1 && f % 100 != 11)
-			return text::one;
-		else if(v != 2 && f % 10 == 1)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3lag(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && i == 0)
-			return text::zero;
-		else if(i == 0 || i == 1)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3ksh(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && i == 0)
-			return text::zero;
-		else if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3he(int64_t i, int64_t , int32_t v) {
-		if((i == 1 && v == 0) || (i == 0 && v != 0))
-			return text::one;
-		else if(i == 2 && v == 0)
-			return text::two;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3iu(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && std::abs(i) == 2)
-			return text::two;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3shi(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(i == 0)
-			return text::one;
-		else if(f == 0 && std::abs(i) >= 2 && std::abs(i) <= 10)
-			return text::few;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3mo(int64_t i, int64_t f, int32_t v) {
-		if(v == 0 && i == 1)
-			return text::one;
-		else if(v != 0 || (f == 0 && i == 0) || (f == 0 && abs(i) != 1 && abs(i) % 100 >= 1 && abs(i) % 100 <= 19))
-			return text::few;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3bs(int64_t i, int64_t f, int32_t v) {
-		if(v == 0 and i % 10 == 1 && i % 100 != 11)
-			return text::one;
-		else if(f % 10 == 1 && f % 100 != 11)
-			return text::one;
-		else if(v == 0 && i % 10 >= 2 && i % 10 <= 4 && i % 100 != 12 && i % 100 != 13 && i % 100 != 14)
-			return text::few;
-		else if(f % 10 >= 2 && f % 10 <= 4 && f % 100 != 12 && f % 100 != 13 && f % 100 != 14)
-			return text::few;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3fr(int64_t i, int64_t , int32_t v) {
-		if(i == 0 || i == 1)
-			return text::one;
-		else if(i != 0 && i % 1000000 == 0 && v == 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3pt(int64_t i, int64_t , int32_t v) {
-		if(i == 0 || i == 1)
-			return text::one;
-		else if(i != 0 && i % 1000000 == 0 && v == 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3ca(int64_t i, int64_t , int32_t v) {
-		if(i == 1 && v == 0)
-			return text::one;
-		else if(i != 0 && i % 1000000 == 0 and v == 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_3es(int64_t i, int64_t f, int32_t v) {
-		if(std::abs(i) == 1 && f == 0)
-			return text::one;
-		else if(i != 0 && i % 1000000 == 0 && v == 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4gd(int64_t i, int64_t f, int32_t ) {
-		if((std::abs(i) == 1 || std::abs(i) == 11) && f == 0)
-			return text::one;
-		else if((std::abs(i) == 2 || std::abs(i) == 12) && f == 0)
-			return text::two;
-		else if(std::abs(i) >= 3 && std::abs(i) <= 19 && f == 0)
-			return text::few;
-		else
-			return text::many;
-	}
-
-	attribute_type card_4sl(int64_t i, int64_t , int32_t v) {
-		if(v == 0 && i % 100 == 1)
-			return text::one;
-		else if(v == 0 && i % 100 == 2)
-			return text::two;
-		else if(v == 0 && (i % 100 == 3 || i % 100 == 4))
-			return text::few;
-		else if(v != 0)
-			return text::few;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4dsb(int64_t i, int64_t f, int32_t v) {
-		if(v == 0 && i % 100 == 1)
-			return text::one;
-		else if(f % 100 == 1)
-			return text::one;
-		else if(v == 0 && i % 100 == 2)
-			return text::two;
-		else if(f % 100 == 2)
-			return text::two;
-		else if(v == 0 && (i % 100 == 3 || i % 100 == 4))
-			return text::few;
-		else if((f % 100 == 3 || f % 100 == 4))
-			return text::few;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4cs(int64_t i, int64_t , int32_t v) {
-		if(i == 1 && v == 0)
-			return text::one;
-		else if(v == 0 && (i == 2 || i == 3 || i == 4))
-			return text::few;
-		else if(v != 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4pl(int64_t i, int64_t , int32_t v) {
-		if(i == 1 && v == 0)
-			return text::one;
-		else if(v == 0 && (i % 10 == 2 || i % 10 == 3 || i % 10 == 4) && i % 100 != 12 && i % 100 != 13 && i % 100 != 14)
-			return text::few;
-		else if(v == 0 && i != 1 && i % 10 != 2 && i % 10 != 3 && i % 10 != 4)
-			return text::many;
-		else if(v == 0 && (i % 100 == 12 || i % 100 == 13 || i % 100 == 14))
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4be(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) % 10 == 1 && std::abs(i) % 100 != 11)
-			return text::one;
-		else if(f == 0 && (std::abs(i) % 10 == 2 || std::abs(i) % 10 == 3 || std::abs(i) % 10 == 4) && std::abs(i) % 100 != 12 && std::abs(i) % 100 != 13 && std::abs(i) % 100 != 14)
-			return text::few;
-		else if(f == 0 && std::abs(i) % 10 == 0)
-			return text::many;
-		else if(f == 0 && std::abs(i) % 10 >= 5 && std::abs(i) % 10 <= 9)
-			return text::many;
-		else if(f == 0 && std::abs(i) % 100 >= 11 && std::abs(i) % 100 <= 14)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4lt(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) % 10 == 1 && (std::abs(i) % 100 < 11 || std::abs(i) % 100 > 19))
-			return text::one;
-		else if(f == 0 && std::abs(i) % 10 >= 2 && std::abs(i) % 10 <= 9 && (std::abs(i) % 100 < 11 || std::abs(i) % 100 > 19))
-			return text::few;
-		else if(f != 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_4ru(int64_t i, int64_t , int32_t v) {
-		if(v == 0 && i % 10 == 1 && i % 100 != 11)
-			return text::one;
-		else if(v == 0 && (std::abs(i) % 10 == 2 || std::abs(i) % 10 == 3 || std::abs(i) % 10 == 4) && std::abs(i) % 100 != 12 && std::abs(i) % 100 != 13 && std::abs(i) % 100 != 14)
-			return text::few;
-		else if(v == 0 && i % 10 == 0)
-			return text::many;
-		else if(v == 0 && i % 10 >= 5 && i % 10 <= 9)
-			return text::many;
-		else if(v == 0 && (i % 100 == 11 || i % 100 == 12 || i % 100 == 13 || i % 100 == 14))
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_5br(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) % 10 == 1 && std::abs(i) % 100 != 11 && std::abs(i) % 100 != 71 && std::abs(i) % 100 != 91)
-			return text::one;
-		else if(f == 0 && std::abs(i) % 10 == 2 && std::abs(i) % 100 != 12 && std::abs(i) % 100 != 72 && std::abs(i) % 100 != 92)
-			return text::two;
-		else if(f == 0 && (std::abs(i) % 10 == 3 || std::abs(i) % 10 == 4 || std::abs(i) % 10 == 9) && (std::abs(i) % 100 < 10 || (std::abs(i) % 100 > 19 && std::abs(i) % 100 < 70) || (std::abs(i) % 100 > 79 && std::abs(i) % 100 < 90)))
-			return text::few;
-		else if(f == 0 && i != 0 && i % 1000000 == 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_5mt(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && std::abs(i) == 2)
-			return text::two;
-		else if(f == 0 && i == 0)
-			return text::few;
-		else if(f == 0 && std::abs(i) % 100 >= 3 && std::abs(i) % 100 <= 10)
-			return text::few;
-		else if(f == 0 && std::abs(i) % 100 >= 11 && std::abs(i) % 100 <= 19)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_5ga(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && std::abs(i) == 2)
-			return text::two;
-		else if(f == 0 && std::abs(i) >= 3 && std::abs(i) <= 6)
-			return text::few;
-		else if(f == 0 && std::abs(i) >= 7 && std::abs(i) <= 10)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_5gv(int64_t i, int64_t , int32_t v) {
-		if(v == 0 && i % 10 == 1)
-			return text::one;
-		else if(v == 0 && i % 10 == 2)
-			return text::two;
-		else if(v == 0 && (i % 100 == 0 || i % 100 == 20 || i % 100 == 40 || i % 100 == 60 || i % 100 == 80))
-			return text::few;
-		else if(v != 0)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_6kw(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && i == 0)
-			return text::zero;
-		else if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && (std::abs(i) % 100 == 2 || std::abs(i) % 100 == 22 || std::abs(i) % 100 == 42 || std::abs(i) % 100 == 62 || std::abs(i) % 100 == 82))
-			return text::two;
-		else if(f == 0 && std::abs(i) % 1000 == 0
-			&& ((std::abs(i) % 100000 >= 1000 && std::abs(i) % 100000 <= 20000) || std::abs(i) % 100000 == 40000 || std::abs(i) % 100000 == 60000 || std::abs(i) % 100000 == 80000))
-			return text::two;
-		else if(f == 0 && std::abs(i) % 1000000 == 100000)
-			return text::two;
-		else if(f == 0 && (std::abs(i) % 100 == 3 || std::abs(i) % 100 == 23 || std::abs(i) % 100 == 43 || std::abs(i) % 100 == 63 || std::abs(i) % 100 == 83))
-			return text::few;
-		else if(f == 0 && std::abs(i) != 1 && (std::abs(i) % 100 == 1 || std::abs(i) % 100 == 21 || std::abs(i) % 100 == 41 || std::abs(i) % 100 == 61 || std::abs(i) % 100 == 81))
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_6ar(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && i == 0)
-			return text::zero;
-		else if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && std::abs(i) == 2)
-			return text::two;
-		else if(f == 0 && std::abs(i) % 100 >= 3 && std::abs(i) % 100 <= 10)
-			return text::few;
-		else if(f == 0 && std::abs(i) % 100 >= 11 && std::abs(i) % 100 <= 99)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type card_6cy(int64_t i, int64_t f, int32_t ) {
-		if(f == 0 && i == 0)
-			return text::zero;
-		else if(f == 0 && std::abs(i) == 1)
-			return text::one;
-		else if(f == 0 && std::abs(i) == 2)
-			return text::two;
-		else if(f == 0 && std::abs(i) == 3)
-			return text::few;
-		else if(f == 0 && std::abs(i) == 6)
-			return text::many;
-		else
-			return text::other;
-	}
-
-	attribute_type ord_2sv(int64_t i) {
-		if((std::abs(i) % 10 == 1 || std::abs(i) % 10 == 2) && std::abs(i) % 100 != 11 && std::abs(i) % 100 != 12)
-			return text::ord_one;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2bal(int64_t i) {
-		if(std::abs(i) == 1)
-			return text::ord_one;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2hu(int64_t i) {
-		if(std::abs(i) == 1 || std::abs(i) == 5)
-			return text::ord_one;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2ne(int64_t i) {
-		if(std::abs(i) >= 1 && std::abs(i) <= 4)
-			return text::ord_one;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2be(int64_t i) {
-		if((std::abs(i) % 10 == 2 || std::abs(i) % 10 == 3) && std::abs(i) % 100 != 12 && std::abs(i) % 100 != 13)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2uk(int64_t i) {
-		if(std::abs(i) % 10 == 3 && std::abs(i) % 100 != 13)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2tk(int64_t i) {
-		if(std::abs(i) % 10 == 9 || std::abs(i) % 10 == 6 || std::abs(i) == 10)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2kk(int64_t i) {
-		if(std::abs(i) % 10 == 9 || std::abs(i) % 10 == 6 || (std::abs(i) % 10 == 0 && i != 0))
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2it(int64_t i) {
-		if(std::abs(i) == 11 || std::abs(i) == 8 || std::abs(i) == 80 || std::abs(i) == 800)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_2lij(int64_t i) {
-		if(std::abs(i) == 11 || std::abs(i) == 8 || (std::abs(i) >= 80 && std::abs(i) <= 89) || (std::abs(i) >= 800 && std::abs(i) <= 899))
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_3ka(int64_t i) {
-		if(i == 1)
-			return text::ord_one;
-		else if(i == 0 || i % 100 == 40 || i % 100 == 60 || i % 100 == 80 || (i % 100 >= 2 && i % 100 <= 20))
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_3sq(int64_t i) {
-		if(std::abs(i) == 1)
-			return text::ord_one;
-		else if(std::abs(i) % 10 == 4 && std::abs(i) % 100 != 14)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_3kw(int64_t i) {
-		if(std::abs(i) >= 1 && std::abs(i) <= 4)
-			return text::ord_one;
-		else if(std::abs(i) % 100 >= 1 && std::abs(i) % 100 <= 4)
-			return text::ord_one;
-		else if(std::abs(i) % 100 >= 21 && std::abs(i) % 100 <= 24)
-			return text::ord_one;
-		else if(std::abs(i) % 100 >= 41 && std::abs(i) % 100 <= 44)
-			return text::ord_one;
-		else if(std::abs(i) % 100 >= 61 && std::abs(i) % 100 <= 64)
-			return text::ord_one;
-		else if(std::abs(i) % 100 >= 81 && std::abs(i) % 100 <= 84)
-			return text::ord_one;
-		else if(std::abs(i) == 5 || std::abs(i) % 100 == 5)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4en(int64_t i) {
-		if(std::abs(i) % 10 == 1 && std::abs(i) % 100 != 11)
-			return text::ord_one;
-		else if(std::abs(i) % 10 == 2 && std::abs(i) % 100 != 12)
-			return text::ord_two;
-		else if(std::abs(i) % 10 == 3 && std::abs(i) % 100 != 13)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4mr(int64_t i) {
-		if(std::abs(i) == 1)
-			return text::ord_one;
-		else if(std::abs(i) == 2 || std::abs(i) == 3)
-			return text::ord_two;
-		else if(std::abs(i) == 4)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4gd(int64_t i) {
-		if(std::abs(i) == 1 || std::abs(i) == 11)
-			return text::ord_one;
-		else if(std::abs(i) == 2 || std::abs(i) == 12)
-			return text::ord_two;
-		else if(std::abs(i) == 3 || std::abs(i) == 13)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4ca(int64_t i) {
-		if(std::abs(i) == 1 || std::abs(i) == 3)
-			return text::ord_one;
-		else if(std::abs(i) == 2)
-			return text::ord_two;
-		else if(std::abs(i) == 4)
-			return text::ord_few;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4mk(int64_t i) {
-		if(i % 10 == 1 && i % 100 != 11)
-			return text::ord_one;
-		else if(i % 10 == 2 && i % 100 != 12)
-			return text::ord_two;
-		else if((i % 10 == 7 || i % 10 == 8) && i % 100 != 17 && i % 100 != 18)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_4az(int64_t i) {
-		if(i % 10 == 1 || i % 10 == 2 || i % 10 == 5 || i % 10 == 7 || i % 10 == 8 || i % 100 == 20 || i % 100 == 50 || i % 100 == 70 || i % 100 == 80)
-			return text::ord_one;
-		else if(i % 10 == 3 || i % 10 == 4 || i % 1000 == 100 || i % 1000 == 200 || i % 1000 == 300 || i % 1000 == 400 || i % 1000 == 500 || i % 1000 == 600 || i % 1000 == 700 || i % 1000 == 800 || i % 1000 == 900)
-			return text::ord_few;
-		else if(i == 0 || i % 10 == 6 || i % 100 == 40 || i % 100 == 60 || i % 100 == 90)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_5gu(int64_t i) {
-		if(std::abs(i) == 1)
-			return text::ord_one;
-		else if(std::abs(i) == 2 || std::abs(i) == 3)
-			return text::ord_two;
-		else if(std::abs(i) == 4)
-			return text::ord_few;
-		else if(std::abs(i) == 6)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_5as(int64_t i) {
-		if(std::abs(i) == 1 || std::abs(i) == 5 || std::abs(i) == 7 || std::abs(i) == 8 || std::abs(i) == 9 || std::abs(i) == 10)
-			return text::ord_one;
-		else if(std::abs(i) == 2 || std::abs(i) == 3)
-			return text::ord_two;
-		else if(std::abs(i) == 4)
-			return text::ord_few;
-		else if(std::abs(i) == 6)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_5or(int64_t i) {
-		if(std::abs(i) == 1 || std::abs(i) == 5 || std::abs(i) == 7 || std::abs(i) == 8 || std::abs(i) == 9)
-			return text::ord_one;
-		else if(std::abs(i) == 2 || std::abs(i) == 3)
-			return text::ord_two;
-		else if(std::abs(i) == 4)
-			return text::ord_few;
-		else if(std::abs(i) == 6)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	attribute_type ord_6cy(int64_t i) {
-		if(i == 0 || std::abs(i) == 7 || std::abs(i) == 8 || std::abs(i) == 9)
-			return text::ord_zero;
-		else if(std::abs(i) == 1)
-			return text::ord_one;
-		else if(std::abs(i) == 2)
-			return text::ord_two;
-		else if(std::abs(i) == 4 || std::abs(i) == 3)
-			return text::ord_few;
-		else if(std::abs(i) == 6 || std::abs(i) == 5)
-			return text::ord_many;
-		else
-			return text::ord_other;
-	}
-
-	void parse_into_cardinality_fns(std::unordered_map<std::wstring_view, cardinal_plural_fn> & map, std::wstring_view list, cardinal_plural_fn fn) {
-
-		for(size_t pos = 0; pos < list.length(); pos = list.find(' ', pos)) {
-			if(pos != 0)
-				++pos;
-			auto next = std::min(list.find(L' ', pos), list.length());
-			map.insert_or_assign(list.substr(pos, next - pos), fn);
-		}
-	}
-
-	void parse_into_ordinal_fns(std::unordered_map<std::wstring_view, ordinal_plural_fn>& map, std::wstring_view list, ordinal_plural_fn fn) {
-
-		for(size_t pos = 0; pos < list.length(); pos = list.find(' ', pos)) {
-			if(pos != 0)
-				++pos;
-			auto next = std::min(list.find(L' ', pos), list.length());
-			map.insert_or_assign(list.substr(pos, next - pos), fn);
+			auto& fn = text_data.stored_functions[std::get<text_id>(p).id];
+			out.text_content.clear();
+			out.attributes = fn.attributes;
+			fn.instantiate_into(text_data, nullptr, nullptr, out.text_content);
 		}
 	}
 
 	text_manager::text_manager() {
-		parse_into_cardinality_fns(cardinal_functions, L"am as bn doi fa gu hi kn pcm zu", card_2am);
-		parse_into_cardinality_fns(cardinal_functions, L"ff hy kab", card_2ff);
-		parse_into_cardinality_fns(cardinal_functions, L"ast de en et fi fy gl ia io ji lij nl sc scn sv sw ur yi", card_2ast);
-		cardinal_functions.insert_or_assign(L"si", card_2si);
-		parse_into_cardinality_fns(cardinal_functions, L"ak bho guw ln mg nso pa ti wa", card_2ak);
-		cardinal_functions.insert_or_assign(L"tzm", card_2tzm);
-		parse_into_cardinality_fns(cardinal_functions, L"af an asa az bal bem bez bg brx ce cgg chr ckb dv ee el eo eu fo fur gsw ha haw hu jgo jmc ka kaj kcg kk kkj kl ks ksb ku ky lb lg mas mgo ml mn mr nah nb nd ne nn nnh no nr ny nyn om or os pap ps rm rof rwk saq sd sdh seh sn so sq ss ssy st syr ta te teo tig tk tn tr ts ug uz ve vo vun wae xh xog", card_2af);
-		cardinal_functions.insert_or_assign(L"da", card_2da);
-		cardinal_functions.insert_or_assign(L"is", card_2is);
-		cardinal_functions.insert_or_assign(L"mk", card_2mk);
-		parse_into_cardinality_fns(cardinal_functions, L"ceb fil tl", card_2ceb);
-
-		parse_into_cardinality_fns(cardinal_functions, L"lv prg", card_3lv);
-		cardinal_functions.insert_or_assign(L"lag", card_3lag);
-		cardinal_functions.insert_or_assign(L"ksh", card_3ksh);
-		parse_into_cardinality_fns(cardinal_functions, L"he iw", card_3he);
-		parse_into_cardinality_fns(cardinal_functions, L"iu naq sat se sma smi smj smn sms", card_3iu);
-
-		cardinal_functions.insert_or_assign(L"shi", card_3shi);
-		parse_into_cardinality_fns(cardinal_functions, L"mo ro", card_3mo);
-		parse_into_cardinality_fns(cardinal_functions, L"bs hr sh sr", card_3bs);
-
-		cardinal_functions.insert_or_assign(L"fr", card_3fr);
-		cardinal_functions.insert_or_assign(L"pt", card_3pt);
-		parse_into_cardinality_fns(cardinal_functions, L"ca it pt-PT vec", card_3ca);
-		cardinal_functions.insert_or_assign(L"es", card_3es);
-
-		cardinal_functions.insert_or_assign(L"gd", card_4gd);
-		cardinal_functions.insert_or_assign(L"sl", card_4sl);
-		parse_into_cardinality_fns(cardinal_functions, L"dsb hsb", card_4dsb);
-
-		parse_into_cardinality_fns(cardinal_functions, L"cs sk", card_4cs);
-		cardinal_functions.insert_or_assign(L"pl", card_4pl);
-		cardinal_functions.insert_or_assign(L"be", card_4be);
-		cardinal_functions.insert_or_assign(L"lt", card_4lt);
-		parse_into_cardinality_fns(cardinal_functions, L"ru uk", card_4ru);
-
-		cardinal_functions.insert_or_assign(L"br", card_5br);
-		cardinal_functions.insert_or_assign(L"mt", card_5mt);
-		cardinal_functions.insert_or_assign(L"ga", card_5ga);
-		cardinal_functions.insert_or_assign(L"gv", card_5gv);
-
-		cardinal_functions.insert_or_assign(L"kw", card_6kw);
-		parse_into_cardinality_fns(cardinal_functions, L"ar ars", card_6ar);
-		cardinal_functions.insert_or_assign(L"cy", card_6cy);
-
-
-		ordinal_functions.insert_or_assign(L"sv", ord_2sv);
-		parse_into_ordinal_fns(ordinal_functions, L"bal fil fr ga hy lo mo ms ro tl vi", ord_2bal);
-		ordinal_functions.insert_or_assign(L"hu", ord_2hu);
-		ordinal_functions.insert_or_assign(L"ne", ord_2ne);
-
-		ordinal_functions.insert_or_assign(L"be", ord_2be);
-		ordinal_functions.insert_or_assign(L"uk", ord_2uk);
-		ordinal_functions.insert_or_assign(L"tk", ord_2tk);
-
-		ordinal_functions.insert_or_assign(L"kk", ord_2kk);
-		parse_into_ordinal_fns(ordinal_functions, L"it sc scn vec", ord_2it);
-		ordinal_functions.insert_or_assign(L"lij", ord_2lij);
-
-		ordinal_functions.insert_or_assign(L"ka", ord_3ka);
-		ordinal_functions.insert_or_assign(L"sq", ord_3sq);
-		ordinal_functions.insert_or_assign(L"kw", ord_3kw);
-
-		ordinal_functions.insert_or_assign(L"en", ord_4en);
-		ordinal_functions.insert_or_assign(L"mr", ord_4mr);
-		ordinal_functions.insert_or_assign(L"gd", ord_4gd);
-		ordinal_functions.insert_or_assign(L"ca", ord_4ca);
-
-		ordinal_functions.insert_or_assign(L"mk", ord_4mk);
-
-		ordinal_functions.insert_or_assign(L"az", ord_4az);
-
-		parse_into_ordinal_fns(ordinal_functions, L"gu hi", ord_5gu);
-		parse_into_ordinal_fns(ordinal_functions, L"as bn", ord_5as);
-		ordinal_functions.insert_or_assign(L"or", ord_5or);
-
-		ordinal_functions.insert_or_assign(L"cy", ord_6cy);
-
-
-		register_name("ui_settings_name", ::text_id::ui_settings_name);
-		register_name("settings_header", ::text_id::settings_header);
-		register_name("orientation_label", ::text_id::orientation_label);
-		register_name("orientation_ltr", ::text_id::orientation_ltr);
-		register_name("orientation_rtl", ::text_id::orientation_rtl);
-		register_name("orientation_vltr", ::text_id::orientation_vltr);
-		register_name("orientation_vrtl", ::text_id::orientation_vrtl);
-		register_name("input_mode_label", ::text_id::input_mode_label);
-		register_name("input_mode_keyboard_only", ::text_id::input_mode_keyboard_only);
-		register_name("input_mode_mouse_only", ::text_id::input_mode_mouse_only);
-		register_name("input_mode_controller_only", ::text_id::input_mode_controller_only);
-		register_name("input_mode_controller_with_pointer", ::text_id::input_mode_controller_with_pointer);
-		register_name("input_mode_mouse_and_keyboard", ::text_id::input_mode_mouse_and_keyboard);
-		register_name("input_mode_follow_input", ::text_id::input_mode_follow_input);
-		register_name("language_label", ::text_id::language_label);
-		register_name("page_fraction", ::text_id::page_fraction);
-		register_name("minimize_info", ::text_id::minimize_info);
-		register_name("maximize_info", ::text_id::maximize_info);
-		register_name("restore_info", ::text_id::restore_info);
-		register_name("settings_info", ::text_id::settings_info);
-		register_name("info_info", ::text_id::info_info);
-		register_name("close_info", ::text_id::close_info);
-		register_name("orientation_info", ::text_id::orientation_info);
-		register_name("input_mode_info", ::text_id::input_mode_info);
-		register_name("input_mode_mouse_info", ::text_id::input_mode_mouse_info);
-		register_name("input_mode_automatic_info", ::text_id::input_mode_automatic_info);
-		register_name("input_mode_controller_info", ::text_id::input_mode_controller_info);
-		register_name("input_mode_controller_hybrid_info", ::text_id::input_mode_controller_hybrid_info);
-		register_name("input_mode_keyboard_info", ::text_id::input_mode_keyboard_info);
-		register_name("input_mode_mk_hybrid_info", ::text_id::input_mode_mk_hybrid_info);
-		register_name("language_info", ::text_id::language_info);
-		register_name("ui_settings_info", ::text_id::ui_settings_info);
-		register_name("minimize_name", ::text_id::minimize_name);
-		register_name("maximize_name", ::text_id::maximize_name);
-		register_name("restore_name", ::text_id::restore_name);
-		register_name("close_name", ::text_id::close_name);
-		register_name("settings_name", ::text_id::settings_name);
-		register_name("info_name", ::text_id::info_name);
-		register_name("info_name_on", ::text_id::info_name_on);
-		register_name("window_bar_name", ::text_id::window_bar_name);
-		register_name("expandable_container_localized_name", ::text_id::expandable_container_localized_name);
-		register_name("settings_tabs_name", ::text_id::settings_tabs_name);
-		register_name("selection_list_localized_name", ::text_id::selection_list_localized_name);
-		register_name("close_settings_name", ::text_id::close_settings_name);
-		register_name("close_menu_name", ::text_id::close_menu_name);
-		register_name("page_prev_name", ::text_id::page_prev_name);
-		register_name("page_next_name", ::text_id::page_next_name);
-		register_name("page_prev_prev_name", ::text_id::page_prev_prev_name);
-		register_name("page_next_next_name", ::text_id::page_next_next_name);
-		register_name("page_footer_name", ::text_id::page_footer_name);
-		register_name("page_footer_info", ::text_id::page_footer_info);
-		register_name("generic_toggle_on", ::text_id::generic_toggle_on);
-		register_name("generic_toggle_off", ::text_id::generic_toggle_off);
-		register_name("ui_animations_label", ::text_id::ui_animations_label);
-		register_name("ui_animations_info", ::text_id::ui_animations_info);
-		register_name("ui_scale", ::text_id::ui_scale);
-		register_name("ui_scale_edit_name", ::text_id::ui_scale_edit_name);
-		register_name("ui_scale_info", ::text_id::ui_scale_info);
-		register_name("primary_font_label", ::text_id::primary_font_label);
-		register_name("primary_font_info", ::text_id::primary_font_info);
-		register_name("small_font_label", ::text_id::small_font_label);
-		register_name("small_font_info", ::text_id::small_font_info);
-		register_name("fonts_header", ::text_id::fonts_header);
-		register_name("generic_toggle_yes", ::text_id::generic_toggle_yes);
-		register_name("generic_toggle_no", ::text_id::generic_toggle_no);
-		register_name("font_weight", ::text_id::font_weight);
-		register_name("font_stretch", ::text_id::font_stretch);
-		register_name("font_italic", ::text_id::font_italic);
-		register_name("font_weight_edit_name", ::text_id::font_weight_edit_name);
-		register_name("font_stretch_edit_name", ::text_id::font_stretch_edit_name);
-		register_name("font_italic_info", ::text_id::font_italic_info);
-		register_name("font_weight_info", ::text_id::font_weight_info);
-		register_name("font_stretch_info", ::text_id::font_stretch_info);
-		register_name("header_font_label", ::text_id::header_font_label);
-		register_name("header_font_info", ::text_id::header_font_info);
-		register_name("relative_size_label", ::text_id::relative_size_label);
-		register_name("relative_size_edit_name", ::text_id::relative_size_edit_name);
-		register_name("relative_size_small_info", ::text_id::relative_size_small_info);
-		register_name("relative_size_header_info", ::text_id::relative_size_header_info);
-		register_name("top_lead_label", ::text_id::top_lead_label);
-		register_name("top_lead_edit_name", ::text_id::top_lead_edit_name);
-		register_name("top_lead_edit_info", ::text_id::top_lead_edit_info);
-		register_name("bottom_lead_label", ::text_id::bottom_lead_label);
-		register_name("bottom_lead_edit_name", ::text_id::bottom_lead_edit_name);
-		register_name("bottom_lead_edit_info", ::text_id::bottom_lead_edit_info);
-		register_name("keyboard_header", ::text_id::keyboard_header);
-		register_name("key_ord_name", ::text_id::key_ord_name);
-		register_name("scan_code", ::text_id::scan_code);
-		register_name("key_display_name", ::text_id::key_display_name);
-		register_name("keyboard_arrangement", ::text_id::keyboard_arrangement);
-		register_name("keyboard_left", ::text_id::keyboard_left);
-		register_name("keyboard_right", ::text_id::keyboard_right);
-		register_name("keyboard_tilted", ::text_id::keyboard_tilted);
-		register_name("keyboard_custom", ::text_id::keyboard_custom);
-		register_name("keyboard_arragnement_info", ::text_id::keyboard_arragnement_info);
-		register_name("key_escape_name", ::text_id::key_escape_name);
-		register_name("key_escape_info", ::text_id::key_escape_info);
-		register_name("key_info_name", ::text_id::key_info_name);
-		register_name("key_info_info", ::text_id::key_info_info);
-		register_name("info_key_is_sticky", ::text_id::info_key_is_sticky);
-		register_name("keyboard_code_info", ::text_id::keyboard_code_info);
-		register_name("keyboard_display_name_info", ::text_id::keyboard_display_name_info);
-		register_name("keyboard_display_edit_name", ::text_id::keyboard_display_edit_name);
-		register_name("info_key_sticky_info", ::text_id::info_key_sticky_info);
-		register_name("controller_header", ::text_id::controller_header);
-		register_name("button_ord_name", ::text_id::button_ord_name);
-		register_name("button_group_name", ::text_id::button_group_name);
-		register_name("button_group_sticky", ::text_id::button_group_sticky);
-		register_name("buttons_escape_name", ::text_id::buttons_escape_name);
-		register_name("buttons_info_name", ::text_id::buttons_info_name);
-		register_name("first_button_label", ::text_id::first_button_label);
-		register_name("second_button_label", ::text_id::second_button_label);
-		register_name("buttons_are_sticky", ::text_id::buttons_are_sticky);
-		register_name("thumbstick_label", ::text_id::thumbstick_label);
-		register_name("thumbstick_left_name", ::text_id::thumbstick_left_name);
-		register_name("thumbstick_right_name", ::text_id::thumbstick_right_name);
-		register_name("sensitivity_label", ::text_id::sensitivity_label);
-		register_name("deadzone_label", ::text_id::deadzone_label);
-		register_name("button_assignment_info", ::text_id::button_assignment_info);
-		register_name("info_button_info", ::text_id::info_button_info);
-		register_name("escape_button_info", ::text_id::escape_button_info);
-		register_name("controller_sticky_info", ::text_id::controller_sticky_info);
-		register_name("thumbstick_info", ::text_id::thumbstick_info);
-		register_name("sensitivity_info", ::text_id::sensitivity_info);
-		register_name("deadzone_info", ::text_id::deadzone_info);
-		register_name("general_header", ::text_id::general_header);
-		register_name("cursor_blink_label", ::text_id::cursor_blink_label);
-		register_name("cursor_blink_info", ::text_id::cursor_blink_info);
-		register_name("label_font_label", ::text_id::label_font_label);
-		register_name("label_font_info", ::text_id::label_font_info);
+		for(uint16_t i = 0; i < ::text_id::first_free_id; ++i) {
+			register_name(::text_id::names[i], i);
+		}
 	}
 
 	UINT GetGrouping(WCHAR const* locale) {
@@ -1090,780 +104,189 @@ namespace printui::text {
 		} else {
 			return locale_name();
 		}
-	}
-
-	void text_manager::update_with_new_locale(window_data& win, bool update_settings) {
-		std::wstring full_compound = app_region.size() != 0 ? app_lang + L"-" + app_region : app_lang;
-
-		if(auto it = cardinal_functions.find(full_compound); it != cardinal_functions.end()) {
-			cardinal_classification = it->second;
-		} else if(auto itb = cardinal_functions.find(app_lang); itb != cardinal_functions.end()) {
-			cardinal_classification = itb->second;
-		} else {
-			cardinal_classification = [](int64_t, int64_t, int32_t) { return text::other; };
-		}
-
-		if(auto it = ordinal_functions.find(full_compound); it != ordinal_functions.end()) {
-			ordinal_classification = it->second;
-		} else if(auto itb = ordinal_functions.find(app_lang); itb != ordinal_functions.end()) {
-			ordinal_classification = itb->second;
-		} else {
-			ordinal_classification = [](int64_t) { return text::ord_other; };
-		}
-
-
-		{
-			DWORD temp = 0;
-			GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_ILZERO | LOCALE_RETURN_NUMBER, (LPWSTR)&temp, sizeof(temp) / sizeof(WCHAR));
-			LeadingZero = temp;
-		}
-		{
-			DWORD temp = 0;
-			GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_INEGNUMBER | LOCALE_RETURN_NUMBER, (LPWSTR)&temp, sizeof(temp) / sizeof(WCHAR));
-			NegativeOrder = temp;
-		}
-
-		Grouping = GetGrouping(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str());
-
-		GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_SDECIMAL, lpDecimalSep, 5);
-		GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_STHOUSAND, lpThousandSep, 5);
-		
-		lcid = os_locale_is_default ? LocaleNameToLCID(LOCALE_NAME_USER_DEFAULT, 0) : LocaleNameToLCID(full_compound.c_str(), LOCALE_ALLOW_NEUTRAL_NAMES);
-
-
-		{
-			std::wstring locale_path = win.file_system.get_root_directory() + win.dynamic_settings.text_directory + L"\\" + full_compound;
-			win.dynamic_settings.fallbacks.clear();
-			if(update_settings) {
-				win.load_locale_settings(locale_path);
-			} else {
-				win.load_locale_fonts(locale_path);
-			}
-
-			auto locale_name = get_locale_name(win,locale_path);
-			win.window_bar.print_ui_settings.lang_menu.open_button.set_text(win, locale_name.length() > 0 ? locale_name : full_compound);
-		}
-
-		win.dynamic_settings.fallbacks.clear();
-		win.text_interface.initialize_font_fallbacks(win);
-		win.text_interface.initialize_fonts(win);
-
-		// load text from files
-		populate_text_content(win);
-
-		auto window_title_id = text_id_from_name("window_title").id;
-		if(window_title_id != uint32_t(-1)) {
-			auto title_text = instantiate_text(uint16_t(window_title_id)).text_content.text;
-			win.set_window_title(title_text);
-		} else {
-			win.set_window_title(L"");
-		}
-
-		win.change_orientation(win.dynamic_settings.preferred_orientation);
-	}
-
-	void text_manager::update_fonts(window_data& win) {
-		win.text_interface.initialize_fonts(win);
-		win.change_orientation(win.dynamic_settings.preferred_orientation);
-	}
-
-
-	void text_manager::change_locale(std::wstring const& lang, std::wstring const& region, window_data& win, bool update_settings) {
-		app_lang = lang;
-		app_region = region;
-
-		std::wstring full_compound = app_region.size() != 0 ? app_lang + L"-" + app_region : app_lang;
-
-		if(IsValidLocaleName(full_compound.c_str())) {
-			os_locale = full_compound;
-			os_locale_is_default = false;
-		} else {
-			os_locale_is_default = true;
-		}
-
-		update_with_new_locale(win, update_settings);
-		win.dynamic_settings.locale_is_default = false;
-	}
-
-	void text_manager::default_locale(window_data& win, bool update_settings) {
-
-		WCHAR buffer[LOCALE_NAME_MAX_LENGTH] = { 0 };
-		GetUserDefaultLocaleName(buffer, LOCALE_NAME_MAX_LENGTH);
-
-		size_t first_dash = 0;
-		for(; buffer[first_dash] != 0; ++first_dash) {
-			if(buffer[first_dash] == L'-')
-				break;
-		}
-		size_t underscore_before_dash = 0;
-		for(; underscore_before_dash < first_dash; ++underscore_before_dash) {
-			if(buffer[underscore_before_dash] == L'_') {
-				break;
-			}
-		}
-
-		app_lang = std::wstring(buffer, buffer + underscore_before_dash);
-
-		size_t underscore_after_dash = buffer[first_dash] != 0 ? first_dash + 1 : first_dash;
-		for(; buffer[underscore_after_dash] != 0; ++underscore_after_dash) {
-			if(buffer[underscore_after_dash] == L'_') {
-				break;
-			}
-		}
-
-		app_region = buffer[first_dash] != 0
-			? std::wstring(buffer + first_dash + 1, buffer + underscore_after_dash)
-			: std::wstring();
-
-
-		os_locale = buffer;
-		os_locale_is_default = true;
-
-
-		update_with_new_locale(win, update_settings);
-	}
-
-
-	struct content_and_remainder {
-		std::string_view content;
-		std::string_view remainder;
-		bool insert_space;
-		bool insert_linebreak;
-	};
-
-	content_and_remainder consume_token(std::string_view in) {
-		content_and_remainder result;
-
-		uint32_t i = 0;
-
-		if(in.length() > 0 && (in[0] == '}' || in[0] == '{')) {
-			result.content = in.substr(0, 1);
-			i = 1;
-
-		} else {
-			for(; i < in.length(); ++i) {
-				if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n' && in[i] != '_') {
-					break;
-				}
-			}
-
-			auto const start = i;
-
-			for(; i < in.length(); ++i) {
-				if(in[i] == ' ' || in[i] == '\t' || in[i] == '\r' || in[i] == '\n' || in[i] == '_' || in[i] == '{' || in[i] == '}') {
-					break;
-				}
-			}
-
-			result.content = in.substr(start, i - start);
-		}
-
-		if(i == in.length() || in[i] == '_' || in[i] == '{' || in[i] == '}') {
-			result.insert_space = false;
-		} else {
-			result.insert_space = true;
-		}
-
-		result.insert_linebreak = false;
-		for(; i < in.length(); ++i) {
-			if(in[i] == '\n')
-				result.insert_linebreak = true;
-			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n' && in[i] != '_') {
-				break;
-			}
-		}
-
-		result.remainder = in.substr(i);
-		return result;
-	}
-
-	std::string_view text_data_storage::parse_match_conditions(std::string_view body) {
-		body = consume_token(body).remainder; // eat first token
-
-		while(body.length() > 0) {
-			auto consumed_token = consume_token(body);
-			body = consumed_token.remainder;
-
-			if(consumed_token.content.length() == 1 && consumed_token.content[0] == '}')
-				return body;
-
-			if(consumed_token.content.length() >= 3 && std::isdigit(consumed_token.content[0]) && consumed_token.content[0] != '0') {
-				auto parameter_id = consumed_token.content[0] - '1';
-				auto rem_string = consumed_token.content.substr(2); // skip dot
-
-				if(rem_string == "zero") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::zero, uint8_t(parameter_id) });
-				} else if(rem_string == "one") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::one, uint8_t(parameter_id) });
-				} else if(rem_string == "two") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::two, uint8_t(parameter_id) });
-				} else if(rem_string == "few") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::few, uint8_t(parameter_id) });
-				} else if(rem_string == "many") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::many, uint8_t(parameter_id) });
-				} else if(rem_string == "other") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::other, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-zero") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_zero, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-one") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_one, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-two") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_two, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-few") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_few, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-many") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_many, uint8_t(parameter_id) });
-				} else if(rem_string == "ord-other") {
-					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_other, uint8_t(parameter_id) });
-				} else {
-					if(auto it = attribute_name_to_id.find(rem_string); it != attribute_name_to_id.end()) {
-						match_keys_storage.push_back(param_attribute_pair{ it->second, uint8_t(parameter_id) });
-					} else {
-						++last_attribute_id_mapped;
-						attribute_name_to_id.insert_or_assign(std::string(rem_string), last_attribute_id_mapped);
-						match_keys_storage.push_back(param_attribute_pair{ last_attribute_id_mapped, uint8_t(parameter_id) });
-					}
-				}
-			}
-		}
-		return body;
-	}
-
-	std::string_view text_data_storage::assemble_entry_content(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index, bool allow_match) {
-		
-		size_t last_text_start = 0;
-		size_t formatting_start = 0;
-		uint8_t group = 0;
-
-		bool previous_insert_space = false;
-		bool previous_insert_line = false;
-		size_t current_matcher_index = size_t(-2);
-
-		std::vector<formatting_content> formatting_stack;
-
-		auto restart_match_body = [&]() {
-			if(current_matcher_index + 1 != static_matcher_storage.size()) {
-				last_text_start = codepoint_storage.length();
-				formatting_start = static_format_storage.size();
-
-				if(!static_matcher_storage.empty()) {
-					static_matcher_storage.back().base_text.code_points_count = uint16_t(last_text_start - static_matcher_storage.back().base_text.code_points_start);
-					static_matcher_storage.back().base_text.formatting_end = uint16_t(formatting_start);
-					group = static_matcher_storage.back().group + 1;
-				}
-
-				current_matcher_index = static_matcher_storage.size();
-				static_matcher_storage.emplace_back();
-
-				static_matcher_storage[current_matcher_index].base_text.code_points_start = uint32_t(last_text_start);
-				static_matcher_storage[current_matcher_index].base_text.formatting_start = uint16_t(formatting_start);
-				static_matcher_storage[current_matcher_index].group = group;
-			}
-		};
-		auto append_spaces = [&](content_and_remainder const& st) { 
-			if(previous_insert_line && previous_insert_space) {
-				restart_match_body();
-				codepoint_storage += L'\n';
-			} else if(previous_insert_space) {
-				restart_match_body();
-				codepoint_storage += L' ';
-			}
-			previous_insert_line = st.insert_linebreak;
-			previous_insert_space = st.insert_space;
-		};
-		auto update_spaces = [&](content_and_remainder const& st) {
-			previous_insert_line = st.insert_linebreak;
-			previous_insert_space = st.insert_space;
-		};
-
-		while(body.length() > 0) {
-			auto t = consume_token(body);
-
-			if(t.content.length() == 1 && t.content[0] == '}' && formatting_stack.empty()) {
-				if(current_matcher_index + 1 == static_matcher_storage.size()) {
-					static_matcher_storage.back().base_text.code_points_count = uint16_t(codepoint_storage.length() - static_matcher_storage.back().base_text.code_points_start);
-					static_matcher_storage.back().base_text.formatting_end = uint16_t(static_format_storage.size());
-				}
-				return body;
-			}
+	}
 
-			body = t.remainder;
-			
-			if(t.content.length() == 0) {
-				// do nothing
-			} else if(t.content.length() == 1 && t.content[0] == '}') {
-				restart_match_body();
-				static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), formatting_stack.back() });
-				formatting_stack.pop_back();
-				update_spaces(t);
-			} else {
-				append_spaces(t);
-				if(t.content != "\\match") {
-					restart_match_body();
-				}
+	void text_manager::update_with_new_locale(window_data& win, bool update_settings) {
+		// the arrangement workers read the font settings that are about to be replaced
+		win.text_interface.arrangement_jobs.cancel_pending();
 
-				if(t.content[0] != '\\') {
-					WCHAR* temp_buffer = new WCHAR[t.content.length() * 2];
-
-					auto chars_written = MultiByteToWideChar(
-						CP_UTF8,
-						MB_PRECOMPOSED,
-						t.content.data(),
-						int32_t(t.content.length()),
-						temp_buffer,
-						int32_t(t.content.length()) * 2
-					);
-					codepoint_storage.append(temp_buffer, chars_written);
-
-					delete[] temp_buffer;
-				} else if(t.content == "\\it") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::italic });
-						formatting_stack.push_back(extra_formatting::italic);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\b") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::bold });
-						formatting_stack.push_back(extra_formatting::bold);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\sc") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::small_caps });
-						formatting_stack.push_back(extra_formatting::small_caps);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\os") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::old_numbers });
-						formatting_stack.push_back(extra_formatting::old_numbers);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\sup") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::superscript });
-						formatting_stack.push_back(extra_formatting::superscript);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\sub") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::subscript });
-						formatting_stack.push_back(extra_formatting::subscript);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\tb") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), extra_formatting::tabular_numbers });
-						formatting_stack.push_back(extra_formatting::tabular_numbers);
-						previous_insert_space = false;
-					}
-				} else if(t.content == "\\c") {
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+		std::wstring full_compound = app_region.size() != 0 ? app_lang + L"-" + app_region : app_lang;
 
-						body = next_token.remainder;
+		if(auto fn = find_cardinal_plural_rule(full_compound); fn) {
+			cardinal_classification = fn;
+		} else if(auto fnb = find_cardinal_plural_rule(app_lang); fnb) {
+			cardinal_classification = fnb;
+		} else {
+			cardinal_classification = [](int64_t, int64_t, int32_t) { return text::other; };
+		}
 
-						while(true) {
-							auto content_token = consume_token(body);
-							body = content_token.remainder;
+		if(auto fn = find_ordinal_plural_rule(full_compound); fn) {
+			ordinal_classification = fn;
+		} else if(auto fnb = find_ordinal_plural_rule(app_lang); fnb) {
+			ordinal_classification = fnb;
+		} else {
+			ordinal_classification = [](int64_t) { return text::ord_other; };
+		}
 
-							if(content_token.content.length() == 1 && content_token.content[0] == '}') {
-								update_spaces(content_token);
-								break;
-							}
-							if(content_token.content.length() == 0)
-								break;
-
-							if(content_token.content == "left-brace") {
-								codepoint_storage += L'{';
-							} else if(content_token.content == "right-brace") {
-								codepoint_storage += L'}';
-							} else if(std::isdigit(content_token.content[0])) {
-								std::string temp(content_token.content);
-								uint32_t val = std::strtoul(temp.c_str(), nullptr, 0);
-
-								if(val < 0x10000) {
-									codepoint_storage += wchar_t(val);
-								} else {
-									auto p = make_surrogate_pair(val);
-									codepoint_storage += wchar_t(p.high);
-									codepoint_storage += wchar_t(p.low);
-								}
-							} else if(content_token.content == "em-space") {
-								codepoint_storage += wchar_t(0x2003);
-							} else if(content_token.content == "en-space") {
-								codepoint_storage += wchar_t(0x2002);
-							} else if(content_token.content == "3rd-em") {
-								codepoint_storage += wchar_t(0x2004);
-							} else if(content_token.content == "4th-em") {
-								codepoint_storage += wchar_t(0x2005);
-							} else if(content_token.content == "6th-em") {
-								codepoint_storage += wchar_t(0x2006);
-							} else if(content_token.content == "thin-space") {
-								codepoint_storage += wchar_t(0x2009);
-							} else if(content_token.content == "hair-space") {
-								codepoint_storage += wchar_t(0x200A);
-							} else if(content_token.content == "figure-space") {
-								codepoint_storage += wchar_t(0x2007);
-							} else if(content_token.content == "ideo-space") {
-								codepoint_storage += wchar_t(0x3000);
-							} else if(content_token.content == "hyphen") {
-								codepoint_storage += wchar_t(0x2010);
-							} else if(content_token.content == "figure-dash") {
-								codepoint_storage += wchar_t(0x2012);
-							} else if(content_token.content == "en-dash") {
-								codepoint_storage += wchar_t(0x2013);
-							} else if(content_token.content == "em-dash") {
-								codepoint_storage += wchar_t(0x2014);
-							} else if(content_token.content == "minus") {
-								codepoint_storage += wchar_t(0x2212);
-							} else {
-								WCHAR* temp_buffer = new WCHAR[content_token.content.length() * 2];
-
-								auto chars_written = MultiByteToWideChar(
-									CP_UTF8,
-									MB_PRECOMPOSED,
-									content_token.content.data(),
-									int32_t(content_token.content.length()),
-									temp_buffer,
-									int32_t(content_token.content.length()) * 2
-								);
-								codepoint_storage.append(temp_buffer, chars_written);
-
-								delete[] temp_buffer;
-							}
-						}
 
-					}
-				} else if(t.content.length() == 2 && std::isdigit(t.content[1]) && t.content[1] != '0') {
-					static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), parameter_id{ uint8_t(t.content[1] - '1') } });
-					codepoint_storage += L'?';
-				} else if(t.content == "\\match" && allow_match) {
-					++group;
-					for(; body.length() > 0 && body[0] == '{';) {
-
-						auto condition_id = match_keys_storage.size();
-						body = parse_match_conditions(body);
-						auto conditions_count = match_keys_storage.size() - condition_id;
-
-						if(body.length() > 0 && body[0] == '{') {
-							auto id_before = static_matcher_storage.size();
-
-							body = consume_token(body).remainder;
-							body = assemble_entry_content(body, font_name_to_index, false);
-
-							if(static_matcher_storage.size() != id_before) {
-								static_matcher_storage.back().group = group;
-								static_matcher_storage.back().match_key_start = uint16_t(condition_id);
-								static_matcher_storage.back().num_keys = uint8_t(conditions_count);
-							}
+		{
+			DWORD temp = 0;
+			GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_ILZERO | LOCALE_RETURN_NUMBER, (LPWSTR)&temp, sizeof(temp) / sizeof(WCHAR));
+			number_fmt.leading_zero = temp;
+		}
+		{
+			DWORD temp = 0;
+			GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_INEGNUMBER | LOCALE_RETURN_NUMBER, (LPWSTR)&temp, sizeof(temp) / sizeof(WCHAR));
+			number_fmt.negative_order = temp;
+		}
 
-							auto end_token = consume_token(body);
-							update_spaces(end_token);
-							body = end_token.remainder;
-						}
-					}
-					++group;
+		number_fmt.grouping = GetGrouping(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str());
 
-				} else { // other = font name
-					uint8_t fid = 0;
+		GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_SDECIMAL, number_fmt.decimal_separator, 5);
+		GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_STHOUSAND, number_fmt.thousand_separator, 5);
+		GetLocaleInfoEx(os_locale_is_default ? LOCALE_NAME_USER_DEFAULT : full_compound.c_str(), LOCALE_SNEGATIVESIGN, number_fmt.negative_sign, 5);
+		
+		lcid = os_locale_is_default ? LocaleNameToLCID(LOCALE_NAME_USER_DEFAULT, 0) : LocaleNameToLCID(full_compound.c_str(), LOCALE_ALLOW_NEUTRAL_NAMES);
 
-					if(auto it = font_name_to_index.find(t.content.substr(1)); it != font_name_to_index.end()) {
-						fid = uint8_t(it->second);
-					}
 
-					auto next_token = consume_token(body);
-					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
-						body = next_token.remainder;
-						static_format_storage.emplace_back(format_marker{ uint16_t(codepoint_storage.length() - last_text_start), font_id{fid} });
-						formatting_stack.push_back(font_id{ fid });
-						previous_insert_space = false;
-					}
-				}
+		{
+			std::wstring locale_path = win.file_system.get_root_directory() + win.dynamic_settings.text_directory + L"\\" + full_compound;
+			win.dynamic_settings.fallbacks.clear();
+			if(update_settings) {
+				win.load_locale_settings(locale_path);
+			} else {
+				win.load_locale_fonts(locale_path);
 			}
-		} // while body not empty loop
 
-		if(current_matcher_index + 1 == static_matcher_storage.size()) {
-			static_matcher_storage.back().base_text.code_points_count = uint16_t(codepoint_storage.length() - static_matcher_storage.back().base_text.code_points_start);
-			static_matcher_storage.back().base_text.formatting_end = uint16_t(static_format_storage.size());
+			auto locale_name = get_locale_name(win,locale_path);
+			win.window_bar.print_ui_settings.lang_menu.open_button.set_text(win, locale_name.length() > 0 ? locale_name : full_compound);
 		}
-		return body;
-	}
-
-	struct top_level_cr {
-		std::string_view content;
-		std::string_view remainder;
-	};
 
-	top_level_cr consume_text_name(std::string_view in) {
-		top_level_cr result;
+		win.dynamic_settings.fallbacks.clear();
+		win.text_interface.initialize_font_fallbacks(win);
+		win.text_interface.initialize_fonts(win);
 
-		uint32_t i = 0;
+		// load text from files
+		populate_text_content(win);
 
-		for(; i < in.length(); ++i) {
-			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n') {
-				break;
-			}
+		auto window_title_id = text_id_from_name("window_title").id;
+		if(window_title_id != uint32_t(-1)) {
+			auto title_text = instantiate_text(uint16_t(window_title_id)).text_content.text;
+			win.set_window_title(title_text);
+		} else {
+			win.set_window_title(L"");
 		}
 
-		auto const start = i;
+		win.change_orientation(win.dynamic_settings.preferred_orientation);
+	}
 
-		for(; i < in.length(); ++i) {
-			if(in[i] == ' ' || in[i] == '\t' || in[i] == '\r' || in[i] == '\n' || in[i] == '{' || in[i] == '}') {
-				break;
-			}
-		}
+	void text_manager::update_fonts(window_data& win) {
+		win.text_interface.initialize_fonts(win);
+		win.change_orientation(win.dynamic_settings.preferred_orientation);
+	}
 
-		result.content = in.substr(start, i - start);
 
-		for(; i < in.length(); ++i) {
-			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n') {
-				break;
-			}
+	void text_manager::change_locale(std::wstring const& lang, std::wstring const& region, window_data& win, bool update_settings) {
+		app_lang = lang;
+		app_region = region;
+
+		std::wstring full_compound = app_region.size() != 0 ? app_lang + L"-" + app_region : app_lang;
+
+		if(IsValidLocaleName(full_compound.c_str())) {
+			os_locale = full_compound;
+			os_locale_is_default = false;
+		} else {
+			os_locale_is_default = true;
 		}
 
-		result.remainder = in.substr(i);
-		return result;
+		update_with_new_locale(win, update_settings);
+		win.dynamic_settings.locale_is_default = false;
 	}
-	
-	top_level_cr consume_braced_content(std::string_view in) {
-		top_level_cr result;
-		
-		uint32_t i = 0;
-		int32_t depth = 0;
-
-		for(; i < in.length(); ++i) {
-			if(in[i] == '{') {
-				++depth;
-			} else if(in[i] == '}') {
-				--depth;
-			}
-			if(depth <= 0) {
-				break;
-			}
-		}
-		++i;
 
-		result.content = in.substr(1, i > 1 ? (i - 2) : 0);
+	void text_manager::default_locale(window_data& win, bool update_settings) {
+
+		WCHAR buffer[LOCALE_NAME_MAX_LENGTH] = { 0 };
+		GetUserDefaultLocaleName(buffer, LOCALE_NAME_MAX_LENGTH);
 
-		for(; i < in.length(); ++i) {
-			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r') {
+		size_t first_dash = 0;
+		for(; buffer[first_dash] != 0; ++first_dash) {
+			if(buffer[first_dash] == L'-')
 				break;
-			}
 		}
-
-		result.remainder = in.substr(i);
-		return result;
-	}
-
-	std::array<attribute_type, replaceable_instance::max_attributes> text_data_storage::parse_attributes(std::string_view body) {
-		std::array<attribute_type, replaceable_instance::max_attributes> result = {-1i16, -1i16, -1i16, -1i16, -1i16, -1i16, -1i16, -1i16};
-		uint32_t used = 0;
-
-		while(body.length() > 0 && used < replaceable_instance::max_attributes) {
-			auto consumed_token = consume_token(body);
-			body = consumed_token.remainder;
-
-
-			if(consumed_token.content.length() != 0) {
-
-				if(consumed_token.content == "zero") {
-					result[used] = text::zero;
-					++used;
-				} else if(consumed_token.content == "one") {
-					result[used] = text::one;
-					++used;
-				} else if(consumed_token.content == "two") {
-					result[used] = text::two;
-					++used;
-				} else if(consumed_token.content == "few") {
-					result[used] = text::few;
-					++used;
-				} else if(consumed_token.content == "many") {
-					result[used] = text::many;
-					++used;
-				} else if(consumed_token.content == "other") {
-					result[used] = text::other;
-					++used;
-				} else if(consumed_token.content == "ord-zero") {
-					result[used] = text::ord_zero;
-					++used;
-				} else if(consumed_token.content == "ord-one") {
-					result[used] = text::ord_one;
-					++used;
-				} else if(consumed_token.content == "ord-two") {
-					result[used] = text::ord_two;
-					++used;
-				} else if(consumed_token.content == "ord-few") {
-					result[used] = text::ord_few;
-					++used;
-				} else if(consumed_token.content == "ord-many") {
-					result[used] = text::ord_many;
-					++used;
-				} else if(consumed_token.content == "ord-other") {
-					result[used] = text::ord_other;
-					++used;
-				} else {
-					if(auto it = attribute_name_to_id.find(consumed_token.content); it != attribute_name_to_id.end()) {
-						result[used] = it->second;
-						++used;
-					} else {
-						++last_attribute_id_mapped;
-						attribute_name_to_id.insert_or_assign(std::string(consumed_token.content), last_attribute_id_mapped);
-						result[used] = last_attribute_id_mapped;
-						++used;
-					}
-				}
+		size_t underscore_before_dash = 0;
+		for(; underscore_before_dash < first_dash; ++underscore_before_dash) {
+			if(buffer[underscore_before_dash] == L'_') {
+				break;
 			}
 		}
-		return result;
-	}
 
-	std::string_view text_data_storage::consume_single_entry(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index) {
-		top_level_cr entry_name;
-
-		while(body.length() > 0) {
-			entry_name = consume_text_name(body);
-			body = entry_name.remainder;
+		app_lang = std::wstring(buffer, buffer + underscore_before_dash);
 
-			if(body.length() != 0 && body[0] == '{')
-				break; //name begins some content
-		}
-		bool already_exists = false;
-		uint16_t id = 0;
-		if(auto it = internal_text_name_map.find(std::string(entry_name.content)); it == internal_text_name_map.end()) {
-			stored_functions.emplace_back();
-			id = uint16_t(stored_functions.size() - 1);
-			internal_text_name_map.insert_or_assign(std::string(entry_name.content), id);
-		} else {
-			id = it->second;
-			if(stored_functions[it->second].pattern_count != 0) {
-				already_exists = true;
+		size_t underscore_after_dash = buffer[first_dash] != 0 ? first_dash + 1 : first_dash;
+		for(; buffer[underscore_after_dash] != 0; ++underscore_after_dash) {
+			if(buffer[underscore_after_dash] == L'_') {
+				break;
 			}
 		}
 
-		auto first_content = consume_braced_content(body);
-		if(first_content.remainder.length() > 0 && first_content.remainder[0] == '{') {
-			auto second_content = consume_braced_content(first_content.remainder);
-
-			if(!already_exists) {
+		app_region = buffer[first_dash] != 0
+			? std::wstring(buffer + first_dash + 1, buffer + underscore_after_dash)
+			: std::wstring();
 
-				auto pre_entry_size = static_matcher_storage.size();
-				assemble_entry_content(second_content.content, font_name_to_index, true);
-				auto created_entries = static_matcher_storage.size() - pre_entry_size;
-				if(created_entries != 0) {
 
-					stored_functions[id].attributes = parse_attributes(first_content.content);
-					stored_functions[id].begin_patterns = uint16_t(pre_entry_size);
-					stored_functions[id].pattern_count = uint16_t(created_entries);
-				}
-			}
+		os_locale = buffer;
+		os_locale_is_default = true;
 
-			return second_content.remainder;
-		} else {
-			if(first_content.content.length() > 0 && !already_exists) {
-				auto pre_entry_size = static_matcher_storage.size();
-				assemble_entry_content(first_content.content, font_name_to_index, true);
-				auto created_entries = static_matcher_storage.size() - pre_entry_size;
-				if(created_entries != 0) {
-					stored_functions[id].begin_patterns = uint16_t(pre_entry_size);
-					stored_functions[id].pattern_count = uint16_t(created_entries);
-				}
-			}
-			return first_content.remainder;
-		}
 
+		update_with_new_locale(win, update_settings);
 	}
 
-	void text_data_storage::consume_text_file(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index) {
-		while(body.length() > 0) {
-			body = consume_single_entry(body, font_name_to_index);
-		}
-	}
 
 	replaceable_instance text_manager::format_int(int64_t value, uint32_t decimal_places) const {
 		replaceable_instance result;
-
-		NUMBERFMTW fmt;
-		fmt.Grouping = Grouping;
-		fmt.LeadingZero = LeadingZero;
-		fmt.lpDecimalSep = const_cast<wchar_t*>(lpDecimalSep);
-		fmt.lpThousandSep = const_cast<wchar_t*>(lpThousandSep);
-		fmt.NegativeOrder = NegativeOrder;
-		fmt.NumDigits = decimal_places;
-
-		auto value_string = std::to_wstring(value);
-		WCHAR local_buffer[MAX_PATH] = {0};
-
-		if(os_locale_is_default) {	
-			GetNumberFormatEx(LOCALE_NAME_USER_DEFAULT, 0, value_string.c_str(), &fmt, local_buffer, MAX_PATH);
-			result.text_content.text = std::wstring(local_buffer);
-		} else {
-			GetNumberFormatEx(os_locale.c_str(), 0, value_string.c_str(), &fmt, local_buffer, MAX_PATH);
-			result.text_content.text = std::wstring(local_buffer);
-		}
-		result.attributes[0] = cardinal_classification(value, 0, decimal_places);
-		result.attributes[1] = ordinal_classification(value);
+		format_int_into(value, decimal_places, result);
 		return result;
 	}
 	replaceable_instance text_manager::format_double(double value, uint32_t decimal_places) const {
 		replaceable_instance result;
+		format_double_into(value, decimal_places, result);
+		return result;
+	}
 
-		NUMBERFMTW fmt;
-		fmt.Grouping = Grouping;
-		fmt.LeadingZero = LeadingZero;
-		fmt.lpDecimalSep = const_cast<wchar_t*>(lpDecimalSep);
-		fmt.lpThousandSep = const_cast<wchar_t*>(lpThousandSep);
-		fmt.NegativeOrder = NegativeOrder;
-		fmt.NumDigits = decimal_places;
-		
-		if(std::isfinite(value)) {
-			auto value_string = std::to_wstring(value);
-			WCHAR local_buffer[MAX_PATH] = { 0 };
+	void text_manager::format_int_into(int64_t value, uint32_t decimal_places, replaceable_instance& out) const {
+		out.text_content.text.clear();
+		append_formatted_integer(out.text_content.text, value, decimal_places, number_fmt);
+		out.text_content.formatting.clear();
+		out.attributes.fill(attribute_type(-1));
+		out.attributes[0] = cardinal_classification(value, 0, decimal_places);
+		out.attributes[1] = ordinal_classification(value);
+	}
+	void text_manager::format_double_into(double value, uint32_t decimal_places, replaceable_instance& out) const {
+		out.text_content.formatting.clear();
+		out.attributes.fill(attribute_type(-1));
 
-			if(os_locale_is_default) {
-				GetNumberFormatEx(LOCALE_NAME_USER_DEFAULT, 0, value_string.c_str(), &fmt, local_buffer, MAX_PATH);
-				result.text_content.text = std::wstring(local_buffer);
-			} else {
-				GetNumberFormatEx(os_locale.c_str(), 0, value_string.c_str(), &fmt, local_buffer, MAX_PATH);
-				result.text_content.text = std::wstring(local_buffer);
-			}
+		if(std::isfinite(value)) {
+			out.text_content.text.clear();
+			append_formatted_decimal(out.text_content.text, value, decimal_places, number_fmt);
 
 			auto decimal_part = (value >= 0) ? (value - std::floor(value)) : (value - std::ceil(value));
 			for(uint32_t i = 0; i < decimal_places; ++i) {
 				decimal_part *= 10.0;
 			}
 
-			result.attributes[0] = cardinal_classification(int64_t(value), int64_t(std::nearbyint(decimal_places)), decimal_places);
-			result.attributes[1] = ordinal_classification(int64_t(value));
+			out.attributes[0] = cardinal_classification(int64_t(value), int64_t(std::nearbyint(std::abs(decimal_part))), decimal_places);
+			out.attributes[1] = ordinal_classification(int64_t(value));
 		} else if(std::isnan(value)) {
-			result.text_content.text = L"#NAN";
+			out.text_content.text.assign(L"#NAN");
 		} else { // infinite
 			if(value > 0) {
-				result.text_content.text = L"∞";
+				out.text_content.text.assign(L"∞");
 			} else {
-				result.text_content.text = L"-∞";
+				out.text_content.text.assign(L"-∞");
 			}
-			result.attributes[0] = text::other;
-			result.attributes[1] = text::ord_other;
+			out.attributes[0] = text::other;
+			out.attributes[1] = text::ord_other;
 		}
-
-		return result;
 	}
 
 	wchar_t const* text_manager::locale_string() const {
@@ -1889,59 +312,118 @@ namespace printui::text {
 	}
 
 	double text_manager::text_to_double(wchar_t const* start, uint32_t count) const {
-		auto olestr = SysAllocStringLen(start, count);
-		double result = 0;
-		if(olestr) {
-			VarR8FromStr(olestr, lcid, 0, &result);
-			SysFreeString(olestr);
-		}
-		return result;
+		return parse_formatted_decimal(std::wstring_view(start, count), number_fmt);
 	}
 	int64_t text_manager::text_to_int(wchar_t const* start, uint32_t count) const {
-		auto olestr = SysAllocStringLen(start, count);
-		int64_t result = 0;
-		if(olestr) {
-			VarI8FromStr(olestr, lcid, 0, &result);
-			SysFreeString(olestr);
-		}
-		return result;
-		/*
-		VARIANT var;
-
-		VariantInit(&var);
-		var.bstrVal = SysAllocStringLen(start, count);
-		var.vt = VT_BSTR;
-
-		HRESULT hr = VariantChangeTypeEx(&var, &var, lcid, 0, VT_R8);
-
-		
-			return = var.dblVal;
-
-		VariantClear(&var);
-		*/
+		return parse_formatted_integer(std::wstring_view(start, count), number_fmt);
 	}
 
 	void text_manager::load_text_from_directory(window_data const& win, std::wstring const& directory) {
 		std::wstring txt = directory + L"\\*.txt";
 
+		std::vector<std::wstring> file_names;
 		win.file_system.for_each_filtered_file(txt, [&](std::wstring const& name) {
-			std::wstring fname = directory + L"\\" + name;
-			win.file_system.with_file_content(fname, [&](std::string_view content) {
-				text_data.consume_text_file(content, font_name_to_index);
-			});
+			file_names.push_back(directory + L"\\" + name);
 		});
+
+		// the bundle depends on the text files, in load order, and on the font names resolved while parsing them
+		uint64_t font_stamp = 0;
+		for(auto& [name, index] : font_name_to_index) {
+			font_stamp ^= hash_bundle_source(text_bundle_stamp_seed + index, name);
+		}
+		auto const font_bytes = std::string_view(reinterpret_cast<char const*>(&font_stamp), sizeof(font_stamp));
+
+		// reading every file to hash it would cost nearly as much as parsing it, so the names, sizes, and write times are
+		// checked first, and the contents are only hashed when those have changed
+		uint64_t listing_stamp = text_bundle_stamp_seed;
+		for(auto& fname : file_names) {
+			listing_stamp = hash_bundle_source(listing_stamp, std::string_view(reinterpret_cast<char const*>(fname.data()), fname.length() * sizeof(wchar_t)));
+			if(auto metadata = win.file_system.get_file_metadata(fname); metadata) {
+				listing_stamp = hash_bundle_source(listing_stamp, std::string_view(reinterpret_cast<char const*>(&(*metadata)), sizeof(file_metadata)));
+			}
+		}
+		listing_stamp = hash_bundle_source(listing_stamp, font_bytes);
+
+		auto source_stamp = [&]() {
+			uint64_t stamp = text_bundle_stamp_seed;
+			for(auto& fname : file_names) {
+				stamp = hash_bundle_source(stamp, std::string_view(reinterpret_cast<char const*>(fname.data()), fname.length() * sizeof(wchar_t)));
+				win.file_system.with_file_content(fname, [&](std::string_view content) {
+					stamp = hash_bundle_source(stamp, content);
+				});
+			}
+			return hash_bundle_source(stamp, font_bytes);
+		};
+
+		// bundles are kept per user, named for the directory and encoding they were compiled for, since the text directory may not be writable
+		std::wstring cache_directory = win.file_system.get_cache_directory();
+		if(cache_directory.length() == 0) {
+			OutputDebugStringW((L"text bundle: no cache directory, compiling " + directory + L" without saving it\n").c_str());
+		}
+		auto const directory_hash = hash_bundle_source(text_bundle_stamp_seed, std::string_view(reinterpret_cast<char const*>(directory.data()), directory.length() * sizeof(wchar_t)));
+		std::wstring bundle_name = cache_directory + L"\\text_" + std::to_wstring(directory_hash) + L"_" + std::to_wstring(int32_t(text_data.encoding)) + L".bundle";
+
+		uint64_t stamp = 0;
+		bool stamp_known = false;
+		bool bundle_loaded = false;
+		std::string restamped;
+		if(cache_directory.length() != 0) {
+			win.file_system.with_file_content(bundle_name, [&](std::string_view content) {
+				auto stamps = read_text_bundle_stamps(content);
+				if(!stamps)
+					return;
+				if(stamps->listing == listing_stamp) {
+					bundle_loaded = load_text_bundle(text_data, content, stamps->source);
+					return;
+				}
+				stamp = source_stamp();
+				stamp_known = true;
+				if(stamps->source == stamp) {
+					// touched but not changed: keep the bundle, and stamp it with the new listing so the next load is cheap again
+					restamped = std::string(content);
+					restamp_text_bundle(restamped, listing_stamp);
+					bundle_loaded = load_text_bundle(text_data, restamped, stamp);
+				}
+			});
+		}
+		if(bundle_loaded) {
+			if(restamped.length() != 0 && !win.file_system.write_file(bundle_name, restamped)) {
+				OutputDebugStringW((L"text bundle: could not restamp " + bundle_name + L" (error " + std::to_wstring(GetLastError()) + L")\n").c_str());
+			}
+			return;
+		}
+		if(!stamp_known)
+			stamp = source_stamp();
+
+		// missing or stale: compile the directory on its own, save the result for the next load, and merge it in
+		text_data_storage compiled;
+		compiled.encoding = text_data.encoding;
+		consume_text_files(compiled, file_names.size(), [&](size_t i, text_data_storage& partial) {
+			win.file_system.with_file_content(file_names[i], [&](std::string_view content) {
+				partial.consume_text_file(content, font_name_to_index);
+			});
+		}, std::thread::hardware_concurrency());
+		auto bundle = serialize_text_bundle(compiled, stamp, listing_stamp);
+		if(cache_directory.length() != 0 && !win.file_system.write_file(bundle_name, bundle)) {
+			OutputDebugStringW((L"text bundle: could not write " + bundle_name + L" (error " + std::to_wstring(GetLastError()) + L"), " + directory + L" will be compiled again on the next load\n").c_str());
+		}
+		load_text_bundle(text_data, bundle, stamp);
 	}
 
 	void text_manager::populate_text_content(window_data const& win) {
 		// reset all data 
 
-		text_data.codepoint_storage.clear();
+		text_data.clear_stored_text();
+		text_data.encoding = win.dynamic_settings.compact_text ? text_storage_encoding::utf8 : text_storage_encoding::utf16;
 		text_data.static_format_storage.clear();
 		text_data.static_matcher_storage.clear();
 		text_data.match_keys_storage.clear();
+		text_data.compiled_matchers.clear();
+		text_data.requirement_storage.clear();
 		text_data.attribute_name_to_id.clear();
 		text_data.last_attribute_id_mapped = last_predefined;
 		++text_generation;
+		instantiation_results.clear();
 
 		for(auto& f : text_data.stored_functions) {
 			f.attributes = std::array<attribute_type, replaceable_instance::max_attributes>{ -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8, -1i8 };
@@ -1989,7 +471,7 @@ namespace printui::text {
 	}
 
 	text_id text_manager::text_id_from_name(std::string_view name) const {
-		if(auto it = text_data.internal_text_name_map.find(std::string(name)); it != text_data.internal_text_name_map.end()) {
+		if(auto it = text_data.internal_text_name_map.find(name); it != text_data.internal_text_name_map.end()) {
 			return text_id{ it->second };
 		} else {
 			return text_id{ uint32_t(-1) };
@@ -1998,23 +480,45 @@ namespace printui::text {
 
 	replaceable_instance text_manager::instantiate_text(uint16_t id, text_parameter const* s, text_parameter const* e) const {
 		replaceable_instance result;
-		if(id == uint16_t(-1)) {
-			return result;
-		} else {
-			std::vector< replaceable_instance> parameters;
-			parameters.reserve(e - s);
+		if(id != uint16_t(-1)) {
+			result.attributes = text_data.stored_functions[id].attributes;
+			instantiate_text_into(id, result.text_content, s, e);
+		}
+		return result;
+	}
+	void text_manager::instantiate_text_into(uint16_t id, text_with_formatting& out, text_parameter const* s, text_parameter const* e) const {
+		out.clear();
+		if(id == uint16_t(-1))
+			return;
 
-			for(uint32_t i = 0; i < e - s; ++i) {
-				parameters.emplace_back(parameter_to_text(s[i]));
-			}
+		// the converted parameters keep their buffers between calls, so in the common case nothing here allocates
+		thread_local std::array<replaceable_instance, max_instantiation_parameters> parameter_scratch;
+		thread_local std::vector<replaceable_instance> overflow_parameters;
 
-			result = text_data.stored_functions[id].instantiate(text_data, parameters.data(), parameters.data() + (e - s));
-			result.text_content.make_substitutions(parameters.data(), parameters.data() + (e - s));
-			return result;
+		auto const count = size_t(e - s);
+		replaceable_instance* parameters = parameter_scratch.data();
+		if(count > parameter_scratch.size()) {
+			overflow_parameters.resize(count);
+			parameters = overflow_parameters.data();
+		}
+
+		for(size_t i = 0; i < count; ++i) {
+			parameter_to_text(s[i], parameters[i]);
 		}
+
+		text_data.stored_functions[id].instantiate_into(text_data, parameters, parameters + count, out);
+	}
+	void text_manager::instantiate_text_cached(uint16_t id, text_with_formatting& out, text_parameter const* s, text_parameter const* e) const {
+		if(instantiation_results.retrieve(id, s, e, text_generation, out))
+			return;
+		instantiate_text_into(id, out, s, e);
+		instantiation_results.store(id, s, e, text_generation, out);
+	}
+	instantiation_cache_counters text_manager::instantiation_cache_statistics() const {
+		return instantiation_results.get_counters();
 	}
 	replaceable_instance text_manager::instantiate_text(std::string_view key, text_parameter const* s, text_parameter const* e) const {
-		if(auto it = text_data.internal_text_name_map.find(std::string(key)); it != text_data.internal_text_name_map.end()) {
+		if(auto it = text_data.internal_text_name_map.find(key); it != text_data.internal_text_name_map.end()) {
 			return instantiate_text(it->second, s, e);
 		} else {
 			return replaceable_instance{};
@@ -2170,27 +674,6 @@ namespace printui::text {
 		return u_getIntPropertyValue(c, UCHAR_NUMERIC_TYPE) != U_NT_NONE;
 	}
 
-	uint32_t assemble_codepoint(uint16_t high, uint16_t low) noexcept {
-		uint32_t high_bits = (high & 0x03FF) << 10;
-		uint32_t low_bits = low & 0x03FF;
-		uint32_t temp = high_bits | low_bits;
-		return temp + 0x10000;
-	}
-	
-	surrogate_pair make_surrogate_pair(uint32_t val) noexcept {
-		uint32_t v = val - 0x10000;
-		uint32_t h = ((v >> 10) & 0x03FF) | 0xD800;
-		uint32_t l = (v & 0x03FF) | 0xDC00;
-		return surrogate_pair{uint16_t(h), uint16_t(l) };
-	}
-
-	bool is_low_surrogate(uint16_t char_code) noexcept {
-		return char_code >= 0xDC00 && char_code <= 0xDFFF;
-	}
-	bool is_high_surrogate(uint16_t char_code) noexcept {
-		return char_code >= 0xD800 && char_code <= 0xDBFF;
-	}
-
 	bool cursor_ignorable16(uint16_t at_position, uint16_t trailing) {
 		if(at_position >= 0xDC00 && at_position <= 0xDFFF) {
 			return false; // low surrogate
@@ -2281,8 +764,14 @@ namespace printui::text {
 	}
 
 	struct text_analysis_object {
-		std::vector<SCRIPT_LOGATTR> char_attributes;
-		std::vector<uint16_t> line_breaks;
+		std::vector<logical_attributes> char_attributes;
+		std::vector<uint32_t> line_breaks;
+
+		// what the attributes were made from, so that the next update only has to analyze the paragraphs that changed
+		std::wstring analyzed_text;
+		bool analyzed_ltr = true;
+		bool analyzed_arabic_numbers = false;
+		bool has_analysis = false;
 	};
 
 	void release_text_analysis_object(text_analysis_object* ptr) {
@@ -2291,7 +780,52 @@ namespace printui::text {
 	text_analysis_object* make_analysis_object() {
 		return new text_analysis_object();
 	}
-	void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring const& str, bool ltr, text_manager const& tm) {
+
+	// -1 for characters that don't affect numeric runs, otherwise whether the character is numeric
+	int32_t numeric_run_class(std::wstring_view str, uint32_t i) {
+		if(is_high_surrogate(str[i])) {
+			if(i + 1 < str.length())
+				return codepoint32_is_numeric(assemble_codepoint(str[i], str[i + 1])) ? 1 : 0;
+			return -1;
+		} else if(is_low_surrogate(str[i]) || is_space(str[i])) {
+			return -1;
+		} else {
+			return codepoint16_is_numeric(str[i]) ? 1 : 0;
+		}
+	}
+
+	// starting at start, adds word stops at the points where a numeric run starts or ends, and removes the ones added
+	// before that no longer apply; it stops at the first character at or after stop_after that was classified,
+	// because from there on the earlier results are still correct
+	void mark_numeric_runs(std::vector<logical_attributes>& attributes, std::wstring_view str, uint32_t start, uint32_t stop_after) {
+		bool in_numeric_run = false;
+		for(uint32_t j = start; j-- > 0; ) {
+			if(auto c = numeric_run_class(str, j); c != -1) {
+				in_numeric_run = c == 1;
+				break;
+			}
+		}
+
+		for(uint32_t i = start; i < str.length(); ++i) {
+			if((attributes[i].flags & logical_attributes::numeric_word_stop) != 0) {
+				attributes[i].flags &= uint8_t(~(logical_attributes::word_stop | logical_attributes::numeric_word_stop));
+			}
+			auto c = numeric_run_class(str, i);
+			if(c == -1)
+				continue;
+
+			if((c == 1) != in_numeric_run) {
+				if((attributes[i].flags & logical_attributes::word_stop) == 0) {
+					attributes[i].flags |= logical_attributes::word_stop | logical_attributes::numeric_word_stop;
+				}
+				in_numeric_run = c == 1;
+			}
+			if(i >= stop_after)
+				break;
+		}
+	}
+
+	void impl_update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring_view str, bool ltr, text_manager const& tm) {
 		IDWriteTextLayout* formatted_text = (IDWriteTextLayout*)txt;
 
 		if(formatted_text) {
@@ -2306,88 +840,39 @@ namespace printui::text {
 			uint32_t running_total = 0;
 			for(uint32_t i = 0; i < lines.size(); ++i) {
 				running_total += lines[i].length;
-				ptr->line_breaks[i] = uint16_t(running_total);
+				ptr->line_breaks[i] = running_total;
 			}
 		} else {
 			ptr->line_breaks.clear();
 		}
 
-		int32_t items_got = 0;
-		std::vector<SCRIPT_ITEM> processed_items(8);
-		int32_t current_size = 8;
-
-		SCRIPT_CONTROL control;
-		memset(&control, 0, sizeof(SCRIPT_CONTROL));
-		SCRIPT_STATE state;
-		memset(&state, 0, sizeof(SCRIPT_STATE));
-
-		control.uDefaultLanguage = LANGIDFROMLCID(tm.lcid);
-		state.uBidiLevel = ltr ? 0 : 1;
-		state.fArabicNumContext = tm.app_lang == L"ar" ? 1 : 0;
-
-		while(ScriptItemize(
-			str.data(),
-			int32_t(str.length()),
-			current_size - 1,
-			&control,
-			&state,
-			processed_items.data(),
-			&items_got) == E_OUTOFMEMORY) {
-			current_size *= 2;
-			processed_items.resize(current_size);
-		}
-
-		ptr->char_attributes.resize(str.length());
-		memset(ptr->char_attributes.data(), 0, sizeof(SCRIPT_LOGATTR) * str.length());
-		for(int32_t i = 0; i < items_got; ++i) {
-			auto char_count = processed_items[i + 1].iCharPos - processed_items[i].iCharPos;
-			ScriptBreak(str.data() + processed_items[i].iCharPos,
-				char_count,
-				&(processed_items[i].a),
-				ptr->char_attributes.data() + processed_items[i].iCharPos);
-			for(int32_t j = processed_items[i].iCharPos; j < processed_items[i + 1].iCharPos; ++j) {
-				ptr->char_attributes[j].fReserved = (processed_items[i].a.s.uBidiLevel & 0x01);
+		bool const arabic_numbers = tm.app_lang == L"ar";
+		auto const length = uint32_t(str.length());
+
+		if(!ptr->has_analysis || ptr->analyzed_ltr != ltr || ptr->analyzed_arabic_numbers != arabic_numbers) {
+			ptr->char_attributes.resize(length);
+			segment_text(ptr->char_attributes.data(), str, ltr, arabic_numbers);
+			mark_numeric_runs(ptr->char_attributes, str, 0, length);
+		} else {
+			// paragraphs are segmented independently, so only the ones that were edited have to be analyzed again
+			auto const edit = find_edited_paragraphs(ptr->analyzed_text, str);
+			if(edit.old_end > edit.new_end) {
+				ptr->char_attributes.erase(ptr->char_attributes.begin() + edit.new_end, ptr->char_attributes.begin() + edit.old_end);
+			} else if(edit.new_end > edit.old_end) {
+				ptr->char_attributes.insert(ptr->char_attributes.begin() + edit.old_end, edit.new_end - edit.old_end, logical_attributes{});
 			}
-		}
-		
-		bool in_numeric_run = false;
-		for(uint32_t i = 0; i < str.length(); ++i) {
-			if(is_high_surrogate(str[i])) {
-				if(i + 1 < str.length()) {
-					auto code_point = assemble_codepoint(str[i], str[i + 1]);
-					if(codepoint32_is_numeric(code_point)) {
-						if(!in_numeric_run) {
-							ptr->char_attributes[i].fWordStop = 1;
-							in_numeric_run = true;
-						}
-					} else {
-						if(in_numeric_run) {
-							ptr->char_attributes[i].fWordStop = 1;
-							in_numeric_run = false;
-						}
-					}
-				}
-			} else if(is_low_surrogate(str[i])) {
-				// ignore
-			} else {
-				if(is_space(str[i])) {
-					//ignore 
-				} else if(codepoint16_is_numeric(str[i])) {
-					if(!in_numeric_run) {
-						ptr->char_attributes[i].fWordStop = 1;
-						in_numeric_run = true;
-					}
-				} else {
-					if(in_numeric_run) {
-						ptr->char_attributes[i].fWordStop = 1;
-						in_numeric_run = false;
-					}
-				}
+			if(edit.start != edit.new_end || edit.start != edit.old_end) {
+				segment_text(ptr->char_attributes.data() + edit.start, std::wstring_view(str).substr(edit.start, edit.new_end - edit.start), ltr, arabic_numbers);
+				mark_numeric_runs(ptr->char_attributes, str, edit.start, edit.new_end);
 			}
 		}
-		
+
+		ptr->analyzed_text = str;
+		ptr->analyzed_ltr = ltr;
+		ptr->analyzed_arabic_numbers = arabic_numbers;
+		ptr->has_analysis = true;
 	}
-	void update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring const& str, bool ltr, text_manager const& tm) {
+	void update_analyzed_text(text_analysis_object* ptr, arranged_text* txt, std::wstring_view str, bool ltr, text_manager const& tm) {
 		impl_update_analyzed_text(ptr, txt, str, ltr, tm);
 	}
 
@@ -2395,11 +880,10 @@ namespace printui::text {
 		return int32_t(ptr->line_breaks.size());
 	}
 	int32_t line_of_position(text_analysis_object* ptr, int32_t position) {
-		for(uint32_t j = 0; j < ptr->line_breaks.size(); ++j) {
-			if(uint16_t(position) < ptr->line_breaks[j]) {
-				return int32_t(j);
-			}
-		}
+		// the first line that ends after the position
+		auto it = std::upper_bound(ptr->line_breaks.begin(), ptr->line_breaks.end(), uint32_t(std::max(position, 0)));
+		if(it != ptr->line_breaks.end())
+			return int32_t(it - ptr->line_breaks.begin());
 		return std::max(int32_t(ptr->line_breaks.size()) - 1, 0);
 	}
 	int32_t start_of_line(text_analysis_object* ptr, int32_t line) {
@@ -2419,7 +903,7 @@ namespace printui::text {
 			return int32_t(ptr->line_breaks.back());
 	}
 
-	int32_t left_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm) {
+	int32_t left_visual_cursor_position(text_analysis_object* ptr, int32_t position) {
 		auto is_ltr = position_is_ltr(ptr, position);
 		auto in_line = line_of_position(ptr, position);
 		auto default_pos = is_ltr ? get_previous_cursor_position(ptr, position) : get_next_cursor_position(ptr, position);
@@ -2439,44 +923,14 @@ namespace printui::text {
 		if(default_ltr == is_ltr && in_line == default_in_line)
 			return default_pos;
 
-		int32_t items_got = 0;
-		std::vector<SCRIPT_ITEM> processed_items(8);
-		int32_t current_size = 8;
-
-		SCRIPT_CONTROL control;
-		memset(&control, 0, sizeof(SCRIPT_CONTROL));
-		SCRIPT_STATE state;
-		memset(&state, 0, sizeof(SCRIPT_STATE));
-
-		control.uDefaultLanguage = LANGIDFROMLCID(tm.lcid);
-		state.uBidiLevel = ltr ? 0 : 1;
-		state.fArabicNumContext = tm.app_lang == L"ar" ? 1 : 0;
-
-		while(ScriptItemize(
-			str.data() + line_begin,
-			line_end - line_begin,
-			current_size - 1,
-			&control,
-			&state,
-			processed_items.data(),
-			&items_got) == E_OUTOFMEMORY) {
-			current_size *= 2;
-			processed_items.resize(current_size);
-		}
-		int32_t run_position = 0;
-		std::vector<BYTE> run_embedding_levels(items_got);
-		std::vector<int32_t> visual_to_logical(items_got);
-		std::vector<int32_t> logical_to_visual(items_got);
-
-		for(int32_t i = 0; i < items_got; ++i) {
-			if(processed_items[i].iCharPos <= (position - line_begin) && (position - line_begin) < processed_items[i + 1].iCharPos) {
-				run_position = i;
+		auto runs = visual_runs(ptr->char_attributes.data() + line_begin, uint32_t(line_end - line_begin));
+		size_t visual_position_of_run = 0;
+		for(size_t i = 0; i < runs.size(); ++i) {
+			if(int32_t(runs[i].start) <= (position - line_begin) && (position - line_begin) < int32_t(runs[i].end)) {
+				visual_position_of_run = i;
 			}
-			run_embedding_levels[i] = processed_items[i].a.s.uBidiLevel;
 		}
 
-		ScriptLayout(items_got, run_embedding_levels.data(), visual_to_logical.data(), logical_to_visual.data());
-		auto visual_position_of_run = logical_to_visual[run_position];
 		if(visual_position_of_run == 0) {
 			if(is_ltr) {
 				return text::get_previous_cursor_position(ptr, end_of_line(ptr, in_line - 1));
@@ -2484,17 +938,16 @@ namespace printui::text {
 				return start_of_line(ptr, in_line + 1);
 			}
 		}
-		auto logical_position_of_left_run = visual_to_logical[visual_position_of_run - 1];
-		auto next_run_is_ltr = (processed_items[logical_position_of_left_run].a.s.uBidiLevel & 0x01) == 0;
-		if(next_run_is_ltr) {
+		auto const& left_run = runs[visual_position_of_run - 1];
+		if((left_run.level & 0x01) == 0) {
 			// find rightmost char position by moving back from the run after it
-			return get_previous_cursor_position(ptr, line_begin + processed_items[logical_position_of_left_run + 1].iCharPos);
+			return get_previous_cursor_position(ptr, line_begin + int32_t(left_run.end));
 		} else {
 			// rightmost char position is first char
-			return line_begin + processed_items[logical_position_of_left_run].iCharPos;
+			return line_begin + int32_t(left_run.start);
 		}
 	}
-	int32_t right_visual_cursor_position(text_analysis_object* ptr, int32_t position, std::wstring const& str, bool ltr, text_manager const& tm) {
+	int32_t right_visual_cursor_position(text_analysis_object* ptr, int32_t position) {
 		auto is_ltr = position_is_ltr(ptr, position);
 		auto in_line = line_of_position(ptr, position);
 		auto default_pos = is_ltr ? get_next_cursor_position(ptr, position) : get_previous_cursor_position(ptr, position);
@@ -2514,59 +967,28 @@ namespace printui::text {
 		if(default_ltr == is_ltr && default_in_line == in_line)
 			return default_pos;
 
-		int32_t items_got = 0;
-		std::vector<SCRIPT_ITEM> processed_items(8);
-		int32_t current_size = 8;
-
-		SCRIPT_CONTROL control;
-		memset(&control, 0, sizeof(SCRIPT_CONTROL));
-		SCRIPT_STATE state;
-		memset(&state, 0, sizeof(SCRIPT_STATE));
-
-		control.uDefaultLanguage = LANGIDFROMLCID(tm.lcid);
-		state.uBidiLevel = ltr ? 0 : 1;
-		state.fArabicNumContext = tm.app_lang == L"ar" ? 1 : 0;
-
-		while(ScriptItemize(
-			str.data() + line_begin,
-			line_end - line_begin,
-			current_size - 1,
-			&control,
-			&state,
-			processed_items.data(),
-			&items_got) == E_OUTOFMEMORY) {
-			current_size *= 2;
-			processed_items.resize(current_size);
-		}
-		int32_t run_position = 0;
-		std::vector<BYTE> run_embedding_levels(items_got);
-		std::vector<int32_t> visual_to_logical(items_got);
-		std::vector<int32_t> logical_to_visual(items_got);
-
-		for(int32_t i = 0; i < items_got; ++i) {
-			if(processed_items[i].iCharPos <= (position - line_begin) && (position - line_begin) < processed_items[i + 1].iCharPos) {
-				run_position = i;
+		auto runs = visual_runs(ptr->char_attributes.data() + line_begin, uint32_t(line_end - line_begin));
+		size_t visual_position_of_run = 0;
+		for(size_t i = 0; i < runs.size(); ++i) {
+			if(int32_t(runs[i].start) <= (position - line_begin) && (position - line_begin) < int32_t(runs[i].end)) {
+				visual_position_of_run = i;
 			}
-			run_embedding_levels[i] = processed_items[i].a.s.uBidiLevel;
 		}
 
-		ScriptLayout(items_got, run_embedding_levels.data(), visual_to_logical.data(), logical_to_visual.data());
-		auto visual_position_of_run = logical_to_visual[run_position];
-		if(visual_position_of_run == items_got - 1) { // is already rightmost
+		if(visual_position_of_run + 1 >= runs.size()) { // is already rightmost
 			if(is_ltr) {
 				return start_of_line(ptr, in_line + 1);
 			} else {
 				return text::get_previous_cursor_position(ptr, end_of_line(ptr, in_line - 1));
 			}
 		}
-		auto logical_position_of_left_run = visual_to_logical[visual_position_of_run + 1];
-		auto next_run_is_ltr = (processed_items[logical_position_of_left_run].a.s.uBidiLevel & 0x01) == 0;
-		if(next_run_is_ltr) {
+		auto const& right_run = runs[visual_position_of_run + 1];
+		if((right_run.level & 0x01) == 0) {
 			// leftmost char position is first char
-			return processed_items[logical_position_of_left_run].iCharPos + line_begin;
+			return line_begin + int32_t(right_run.start);
 		} else {
 			// find leftmost char position by moving back from the run after it
-			return get_previous_cursor_position(ptr, processed_items[logical_position_of_left_run + 1].iCharPos + line_begin);
+			return get_previous_cursor_position(ptr, line_begin + int32_t(right_run.end));
 		}
 	}
 
@@ -2574,7 +996,7 @@ namespace printui::text {
 		int32_t total = 0;
 		auto const array_size = ptr->char_attributes.size();
 		for(int32_t i = 0; i < count && start + i < array_size; ++i) {
-			if(ptr->char_attributes[start + i].fCharStop)
+			if((ptr->char_attributes[start + i].flags & logical_attributes::char_stop) != 0)
 				++total;
 		}
 		return total;
@@ -2583,7 +1005,7 @@ namespace printui::text {
 		--position;
 		if(position < ptr->char_attributes.size()) {
 			for(; position > 0; --position) {
-				if(ptr->char_attributes[position].fCharStop) {
+				if((ptr->char_attributes[position].flags & logical_attributes::char_stop) != 0) {
 					return position;
 				}
 			}
@@ -2594,7 +1016,7 @@ namespace printui::text {
 		++position;
 		auto const array_size = ptr->char_attributes.size();
 		for(; position < array_size; ++position) {
-			if(ptr->char_attributes[position].fCharStop) {
+			if((ptr->char_attributes[position].flags & logical_attributes::char_stop) != 0) {
 				return position;
 			}
 		}
@@ -2618,7 +1040,7 @@ namespace printui::text {
 		--position;
 		if(position < ptr->char_attributes.size()) {
 			for(; position > 0; --position) {
-				if(ptr->char_attributes[position].fWordStop || ptr->char_attributes[position].fSoftBreak) {
+				if((ptr->char_attributes[position].flags & (logical_attributes::word_stop | logical_attributes::soft_break)) != 0) {
 					return position;
 				}
 			}
@@ -2629,7 +1051,7 @@ namespace printui::text {
 		++position;
 		auto const array_size = ptr->char_attributes.size();
 		for(; position < array_size; ++position) {
-			if(ptr->char_attributes[position].fWordStop || ptr->char_attributes[position].fSoftBreak) {
+			if((ptr->char_attributes[position].flags & (logical_attributes::word_stop | logical_attributes::soft_break)) != 0) {
 				return position;
 			}
 		}
@@ -2637,9 +1059,9 @@ namespace printui::text {
 	}
 	bool position_is_ltr(text_analysis_object* ptr, int32_t position) {
 		if(position < ptr->char_attributes.size()) {
-			return  ptr->char_attributes[position].fReserved == 0;
+			return (ptr->char_attributes[position].bidi_level & 0x01) == 0;
 		} else if(ptr->char_attributes.size() > 0){
-			return ptr->char_attributes[ptr->char_attributes.size() - 1].fReserved == 0;
+			return (ptr->char_attributes[ptr->char_attributes.size() - 1].bidi_level & 0x01) == 0;
 		} else {
 			return false;
 		}
@@ -2648,14 +1070,14 @@ namespace printui::text {
 	bool is_cursor_position(text_analysis_object* ptr, int32_t position) {
 		bool result = false;
 		if(position < ptr->char_attributes.size()) {
-			result = ptr->char_attributes[position].fCharStop != 0;
+			result = (ptr->char_attributes[position].flags & logical_attributes::char_stop) != 0;
 		}
 		return result;
 	}
 	bool is_word_position(text_analysis_object* ptr, int32_t position) {
 		bool result = false;
 		if(position < ptr->char_attributes.size()) {
-			result = ptr->char_attributes[position].fWordStop != 0;
+			result = (ptr->char_attributes[position].flags & logical_attributes::word_stop) != 0;
 		}
 		return result;
 	}
@@ -3734,6 +2156,9 @@ namespace printui::text {
 	}
 
 	void direct_write_text::initialize_fonts(window_data& win) {
+		arrangement_jobs.cancel_pending();
+		++font_generation;
+		arrangements.clear();
 
 		auto locale_str = win.text_data.locale_string() != nullptr ? win.text_data.locale_string() : L"";
 
@@ -3999,6 +2424,10 @@ namespace printui::text {
 		auto p = (IDWriteTextLayout*)(ptr);
 		p->Release();
 	}
+	void retain_arranged_text(arranged_text* ptr) {
+		auto p = (IDWriteTextLayout*)(ptr);
+		p->AddRef();
+	}
 
 	void direct_write_text::apply_formatting(IDWriteTextLayout* target, std::vector<format_marker> const& formatting, std::vector<font_description> const& named_fonts) const {
 		{
@@ -4253,6 +2682,8 @@ namespace printui::text {
 
 	arrangement_result direct_write_text::create_text_arragement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting) const {
 
+		std::lock_guard<std::mutex> guard(arrangement_lock);
+
 		IDWriteTextLayout* formatted_text = nullptr;
 		arrangement_result result;
 
@@ -4373,6 +2804,63 @@ namespace printui::text {
 		}
 	}
 
+	arrangement_result direct_write_text::shared_text_arrangement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting, screen_space_point region) const {
+		arrangement_key key;
+		key.text = text;
+		key.formatting = formatting;
+		key.max_width = max_width;
+		key.region = region;
+		key.layout_size = win.layout_size;
+		key.font_generation = font_generation;
+		key.text_sz = text_sz;
+		key.alignment = text_alignment;
+		key.orientation = win.orientation;
+		key.single_line = single_line;
+
+		if(auto found = arrangements.find(key); found.ptr)
+			return found;
+
+		auto result = create_text_arragement(win, text, text_alignment, text_sz, single_line, max_width, formatting);
+		if(region.x >= 0 && region.y >= 0)
+			adjust_layout_region(result.ptr, region.x, region.y);
+		arrangements.insert(key, result);
+		return result;
+	}
+	arrangement_result direct_write_text::refit_text_arrangement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting, arrangement_result current, screen_space_point from, screen_space_point to) const {
+		arrangement_key key;
+		key.text = text;
+		key.formatting = formatting;
+		key.max_width = max_width;
+		key.region = to;
+		key.layout_size = win.layout_size;
+		key.font_generation = font_generation;
+		key.text_sz = text_sz;
+		key.alignment = text_alignment;
+		key.orientation = win.orientation;
+		key.single_line = single_line;
+
+		if(auto found = arrangements.find(key); found.ptr)
+			return found;
+
+		auto from_key = key;
+		from_key.region = from;
+		arrangement_result result;
+		if(current.ptr && arrangements.take_exclusive(from_key, current.ptr)) {
+			// the caller's reference is released when it replaces its arrangement with this one
+			retain_arranged_text(current.ptr);
+			result = current;
+		} else {
+			result = create_text_arragement(win, text, text_alignment, text_sz, single_line, max_width, formatting);
+		}
+		if(to.x >= 0 && to.y >= 0)
+			adjust_layout_region(result.ptr, to.x, to.y);
+		arrangements.insert(key, result);
+		return result;
+	}
+	arrangement_cache_counters direct_write_text::arrangement_cache_statistics() const {
+		return arrangements.get_counters();
+	}
+
 	bool adjust_layout_region(arranged_text* txt, int32_t width, int32_t height) {
 		IDWriteTextLayout* formatted_text = (IDWriteTextLayout*)txt;
 
@@ -0,0 +1,351 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace printui::text {
+	static_assert(std::is_trivially_copyable_v<matched_pattern>);
+	static_assert(std::is_trivially_copyable_v<param_attribute_pair>);
+	static_assert(std::is_trivially_copyable_v<text_function>);
+
+	namespace {
+		constexpr char bundle_magic[8] = { 'P', 'U', 'I', 'T', 'X', 'T', 'B', 'N' };
+
+		// a bundle is a cache for the machine that wrote it, so the native layout of the stored structs is part of its identity
+		constexpr uint32_t bundle_layout = uint32_t(sizeof(matched_pattern)) | uint32_t(sizeof(param_attribute_pair) << 8)
+			| uint32_t(sizeof(text_function) << 16) | uint32_t(sizeof(wchar_t) << 24);
+
+		struct bundle_header {
+			char magic[8];
+			uint32_t version;
+			uint32_t layout;
+			uint64_t source_stamp;
+			uint64_t listing_stamp;
+			uint32_t encoding;
+			uint32_t codepoint_count;
+			uint32_t format_count;
+			uint32_t matcher_count;
+			uint32_t key_count;
+			uint32_t function_count;
+			uint32_t attribute_name_count;
+		};
+
+		// format markers hold a variant, so they are flattened to a position, the variant index, and its single byte of content
+		struct packed_format_marker {
+			uint16_t position;
+			uint8_t kind;
+			uint8_t value;
+		};
+
+		packed_format_marker pack(format_marker const& m) {
+			packed_format_marker result{ m.position, uint8_t(m.format.index()), 0 };
+			if(std::holds_alternative<font_id>(m.format))
+				result.value = std::get<font_id>(m.format).id;
+			else if(std::holds_alternative<parameter_id>(m.format))
+				result.value = std::get<parameter_id>(m.format).id;
+			else if(std::holds_alternative<substitution_mark>(m.format))
+				result.value = std::get<substitution_mark>(m.format).id;
+			else if(std::holds_alternative<extra_formatting>(m.format))
+				result.value = uint8_t(std::get<extra_formatting>(m.format));
+			return result;
+		}
+
+		format_marker unpack(packed_format_marker const& m) {
+			switch(m.kind) {
+				case 1:
+					return format_marker{ m.position, font_id{ m.value } };
+				case 2:
+					return format_marker{ m.position, parameter_id{ m.value } };
+				case 3:
+					return format_marker{ m.position, substitution_mark{ m.value } };
+				case 4:
+					return format_marker{ m.position, extra_formatting(m.value) };
+				default:
+					return format_marker{ m.position, std::monostate{} };
+			}
+		}
+
+		template<typename T>
+		void write_value(std::string& out, T const& v) {
+			out.append(reinterpret_cast<char const*>(&v), sizeof(T));
+		}
+		template<typename T>
+		void write_array(std::string& out, T const* data, size_t count) {
+			out.append(reinterpret_cast<char const*>(data), sizeof(T) * count);
+		}
+		void write_name(std::string& out, std::string_view name) {
+			write_value(out, uint16_t(name.length()));
+			out.append(name);
+		}
+
+		struct bundle_reader {
+			std::string_view data;
+			size_t position = 0;
+			bool failed = false;
+
+			char const* take(size_t bytes) {
+				if(failed || data.length() - position < bytes) {
+					failed = true;
+					return nullptr;
+				}
+				auto result = data.data() + position;
+				position += bytes;
+				return result;
+			}
+			template<typename T>
+			T read_value() {
+				T result{};
+				if(auto p = take(sizeof(T)); p)
+					std::memcpy(&result, p, sizeof(T));
+				return result;
+			}
+			std::string_view read_name() {
+				auto length = read_value<uint16_t>();
+				if(auto p = take(length); p)
+					return std::string_view(p, length);
+				return std::string_view{};
+			}
+		};
+
+		struct bundle_function {
+			std::string_view name;
+			text_function fn;
+		};
+		struct bundle_attribute_name {
+			std::string_view name;
+			attribute_type id;
+		};
+
+		// storage to be merged into another, as it is laid out in a bundle; the arrays may be unaligned
+		struct merge_source {
+			char const* codepoints = nullptr; // code units of the target's encoding
+			uint32_t codepoint_count = 0;
+			uint32_t format_count = 0;
+			char const* matchers = nullptr;
+			uint32_t matcher_count = 0;
+			char const* keys = nullptr;
+			uint32_t key_count = 0;
+			std::vector<bundle_function> functions;
+			std::vector<bundle_attribute_name> attribute_names;
+		};
+
+		size_t code_unit_size(text_storage_encoding encoding) {
+			return encoding == text_storage_encoding::utf8 ? sizeof(char) : sizeof(wchar_t);
+		}
+
+		template<typename F>
+		void merge_into(text_data_storage& target, merge_source const& source, F const& format_at) {
+			// attribute ids beyond the predefined ones are local to the source and must be mapped into the target
+			std::array<attribute_type, 256> attribute_map;
+			for(uint32_t i = 0; i < attribute_map.size(); ++i) {
+				attribute_map[i] = attribute_type(i);
+			}
+			for(auto const& a : source.attribute_names) {
+				if(auto it = target.attribute_name_to_id.find(a.name); it != target.attribute_name_to_id.end()) {
+					attribute_map[uint8_t(a.id)] = it->second;
+				} else {
+					++target.last_attribute_id_mapped;
+					target.attribute_name_to_id.insert_or_assign(std::string(a.name), target.last_attribute_id_mapped);
+					attribute_map[uint8_t(a.id)] = target.last_attribute_id_mapped;
+				}
+			}
+			auto map_attribute = [&](attribute_type a) {
+				return a > last_predefined ? attribute_map[uint8_t(a)] : a;
+			};
+
+			auto const codepoint_offset = uint32_t(target.stored_length());
+			auto const format_offset = uint16_t(target.static_format_storage.size());
+			auto const matcher_offset = uint16_t(target.static_matcher_storage.size());
+			auto const key_offset = uint16_t(target.match_keys_storage.size());
+
+			if(target.encoding == text_storage_encoding::utf8) {
+				target.utf8_storage.append(source.codepoints, source.codepoint_count);
+			} else {
+				target.codepoint_storage.resize(codepoint_offset + source.codepoint_count);
+				if(source.codepoint_count != 0)
+					std::memcpy(target.codepoint_storage.data() + codepoint_offset, source.codepoints, sizeof(wchar_t) * source.codepoint_count);
+			}
+
+			target.static_format_storage.reserve(format_offset + source.format_count);
+			for(uint32_t i = 0; i < source.format_count; ++i) {
+				target.static_format_storage.push_back(format_at(i));
+			}
+
+			target.static_matcher_storage.resize(matcher_offset + source.matcher_count);
+			if(source.matcher_count != 0)
+				std::memcpy(target.static_matcher_storage.data() + matcher_offset, source.matchers, sizeof(matched_pattern) * source.matcher_count);
+			if(codepoint_offset != 0 || format_offset != 0 || key_offset != 0) {
+				for(size_t i = matcher_offset; i < target.static_matcher_storage.size(); ++i) {
+					auto& m = target.static_matcher_storage[i];
+					m.base_text.code_points_start += codepoint_offset;
+					m.base_text.formatting_start += format_offset;
+					m.base_text.formatting_end += format_offset;
+					m.match_key_start += key_offset;
+				}
+			}
+
+			target.match_keys_storage.resize(key_offset + source.key_count);
+			if(source.key_count != 0)
+				std::memcpy(target.match_keys_storage.data() + key_offset, source.keys, sizeof(param_attribute_pair) * source.key_count);
+			for(size_t i = key_offset; i < target.match_keys_storage.size(); ++i) {
+				target.match_keys_storage[i].attribute = map_attribute(target.match_keys_storage[i].attribute);
+			}
+
+			// as with text files, an existing definition of a name takes precedence over a later one
+			for(auto const& f : source.functions) {
+				uint16_t id = 0;
+				if(auto it = target.internal_text_name_map.find(f.name); it != target.internal_text_name_map.end()) {
+					id = it->second;
+					if(target.stored_functions[id].pattern_count != 0)
+						continue;
+				} else {
+					target.stored_functions.emplace_back();
+					id = uint16_t(target.stored_functions.size() - 1);
+					target.internal_text_name_map.insert_or_assign(std::string(f.name), id);
+				}
+
+				auto& fn = target.stored_functions[id];
+				if(f.fn.pattern_count != 0) {
+					fn.begin_patterns = uint16_t(f.fn.begin_patterns + matcher_offset);
+					fn.pattern_count = f.fn.pattern_count;
+					for(uint32_t i = 0; i < replaceable_instance::max_attributes; ++i) {
+						fn.attributes[i] = map_attribute(f.fn.attributes[i]);
+					}
+				}
+			}
+
+			target.compile_matchers();
+		}
+	}
+
+	uint64_t hash_bundle_source(uint64_t running_stamp, std::string_view data) {
+		// fnv-1a
+		for(auto c : data) {
+			running_stamp ^= uint8_t(c);
+			running_stamp *= 0x100000001B3;
+		}
+		return running_stamp;
+	}
+
+	std::string serialize_text_bundle(text_data_storage const& source, uint64_t source_stamp, uint64_t listing_stamp) {
+		std::string result;
+
+		bundle_header header{};
+		std::memcpy(header.magic, bundle_magic, sizeof(bundle_magic));
+		header.version = text_bundle_version;
+		header.layout = bundle_layout;
+		header.source_stamp = source_stamp;
+		header.listing_stamp = listing_stamp;
+		header.encoding = uint32_t(source.encoding);
+		header.codepoint_count = uint32_t(source.stored_length());
+		header.format_count = uint32_t(source.static_format_storage.size());
+		header.matcher_count = uint32_t(source.static_matcher_storage.size());
+		header.key_count = uint32_t(source.match_keys_storage.size());
+		header.function_count = uint32_t(source.internal_text_name_map.size());
+		header.attribute_name_count = uint32_t(source.attribute_name_to_id.size());
+		write_value(result, header);
+
+		if(source.encoding == text_storage_encoding::utf8)
+			write_array(result, source.utf8_storage.data(), source.utf8_storage.length());
+		else
+			write_array(result, source.codepoint_storage.data(), source.codepoint_storage.length());
+		for(auto const& m : source.static_format_storage) {
+			write_value(result, pack(m));
+		}
+		write_array(result, source.static_matcher_storage.data(), source.static_matcher_storage.size());
+		write_array(result, source.match_keys_storage.data(), source.match_keys_storage.size());
+
+		// functions are stored by name, since ids are assigned by whichever storage the bundle is loaded into
+		for(auto const& [name, id] : source.internal_text_name_map) {
+			write_name(result, name);
+			write_value(result, source.stored_functions[id]);
+		}
+		for(auto const& [name, id] : source.attribute_name_to_id) {
+			write_name(result, name);
+			write_value(result, id);
+		}
+
+		return result;
+	}
+
+	std::optional<text_bundle_stamps> read_text_bundle_stamps(std::string_view bundle) {
+		bundle_reader reader{ bundle };
+
+		auto header = reader.read_value<bundle_header>();
+		if(reader.failed || std::memcmp(header.magic, bundle_magic, sizeof(bundle_magic)) != 0 || header.version != text_bundle_version
+			|| header.layout != bundle_layout) {
+			return std::nullopt;
+		}
+		return text_bundle_stamps{ header.source_stamp, header.listing_stamp };
+	}
+
+	void restamp_text_bundle(std::string& bundle, uint64_t listing_stamp) {
+		if(bundle.length() >= sizeof(bundle_header))
+			std::memcpy(bundle.data() + offsetof(bundle_header, listing_stamp), &listing_stamp, sizeof(listing_stamp));
+	}
+
+	bool load_text_bundle(text_data_storage& target, std::string_view bundle, uint64_t expected_stamp) {
+		bundle_reader reader{ bundle };
+
+		auto header = reader.read_value<bundle_header>();
+		if(reader.failed || std::memcmp(header.magic, bundle_magic, sizeof(bundle_magic)) != 0 || header.version != text_bundle_version
+			|| header.layout != bundle_layout || header.source_stamp != expected_stamp || header.encoding != uint32_t(target.encoding)) {
+			return false;
+		}
+
+		// validate the whole bundle before touching the target so that a damaged file leaves it unchanged
+		merge_source source;
+		source.codepoint_count = header.codepoint_count;
+		source.codepoints = reader.take(code_unit_size(target.encoding) * header.codepoint_count);
+		source.format_count = header.format_count;
+		auto formats = reader.take(sizeof(packed_format_marker) * header.format_count);
+		source.matcher_count = header.matcher_count;
+		source.matchers = reader.take(sizeof(matched_pattern) * header.matcher_count);
+		source.key_count = header.key_count;
+		source.keys = reader.take(sizeof(param_attribute_pair) * header.key_count);
+
+		source.functions.reserve(header.function_count);
+		for(uint32_t i = 0; i < header.function_count && !reader.failed; ++i) {
+			auto name = reader.read_name();
+			source.functions.push_back(bundle_function{ name, reader.read_value<text_function>() });
+		}
+		source.attribute_names.reserve(header.attribute_name_count);
+		for(uint32_t i = 0; i < header.attribute_name_count && !reader.failed; ++i) {
+			auto name = reader.read_name();
+			source.attribute_names.push_back(bundle_attribute_name{ name, reader.read_value<attribute_type>() });
+		}
+
+		if(reader.failed || reader.position != bundle.length())
+			return false;
+
+		merge_into(target, source, [formats](uint32_t i) {
+			packed_format_marker m;
+			std::memcpy(&m, formats + sizeof(packed_format_marker) * i, sizeof(packed_format_marker));
+			return unpack(m);
+		});
+		return true;
+	}
+
+	void merge_text_data(text_data_storage& target, text_data_storage const& source) {
+		merge_source from;
+		from.codepoints = source.encoding == text_storage_encoding::utf8 ? source.utf8_storage.data() : reinterpret_cast<char const*>(source.codepoint_storage.data());
+		from.codepoint_count = uint32_t(source.stored_length());
+		from.format_count = uint32_t(source.static_format_storage.size());
+		from.matchers = reinterpret_cast<char const*>(source.static_matcher_storage.data());
+		from.matcher_count = uint32_t(source.static_matcher_storage.size());
+		from.keys = reinterpret_cast<char const*>(source.match_keys_storage.data());
+		from.key_count = uint32_t(source.match_keys_storage.size());
+
+		from.functions.reserve(source.internal_text_name_map.size());
+		for(auto const& [name, id] : source.internal_text_name_map) {
+			from.functions.push_back(bundle_function{ name, source.stored_functions[id] });
+		}
+		from.attribute_names.reserve(source.attribute_name_to_id.size());
+		for(auto const& [name, id] : source.attribute_name_to_id) {
+			from.attribute_names.push_back(bundle_attribute_name{ name, id });
+		}
+
+		merge_into(target, from, [&](uint32_t i) { return source.static_format_storage[i]; });
+	}
+}
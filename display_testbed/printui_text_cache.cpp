@@ -0,0 +1,118 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace printui::text {
+	namespace {
+		uint64_t hash_key(uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t generation) {
+			// fnv-1a, over the fields of each parameter rather than its bytes, which include padding
+			uint64_t result = 0xCBF29CE484222325;
+			auto mix = [&](uint64_t v) {
+				result ^= v;
+				result *= 0x100000001B3;
+			};
+			mix(id);
+			mix(generation);
+			for(auto p = s; p != e; ++p) {
+				mix(p->index());
+				if(std::holds_alternative<int_param>(*p)) {
+					mix(uint64_t(std::get<int_param>(*p).value));
+					mix(std::get<int_param>(*p).decimal_places);
+				} else if(std::holds_alternative<fp_param>(*p)) {
+					uint64_t bits = 0;
+					auto v = std::get<fp_param>(*p).value;
+					std::memcpy(&bits, &v, sizeof(bits));
+					mix(bits);
+					mix(std::get<fp_param>(*p).decimal_places);
+				} else if(std::holds_alternative<text_id>(*p)) {
+					mix(std::get<text_id>(*p).id);
+				}
+			}
+			return result;
+		}
+
+		bool same_parameter(text_parameter const& a, text_parameter const& b) {
+			if(a.index() != b.index())
+				return false;
+			if(std::holds_alternative<int_param>(a))
+				return std::get<int_param>(a).value == std::get<int_param>(b).value && std::get<int_param>(a).decimal_places == std::get<int_param>(b).decimal_places;
+			if(std::holds_alternative<fp_param>(a))
+				return std::memcmp(&std::get<fp_param>(a).value, &std::get<fp_param>(b).value, sizeof(double)) == 0 && std::get<fp_param>(a).decimal_places == std::get<fp_param>(b).decimal_places;
+			return std::get<text_id>(a).id == std::get<text_id>(b).id;
+		}
+	}
+
+	bool instantiation_cache::entry::matches(uint64_t h, uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t gen) const {
+		if(hash != h || text_id != id || generation != gen || parameter_count != uint8_t(e - s))
+			return false;
+		for(uint32_t i = 0; i < parameter_count; ++i) {
+			if(!same_parameter(parameters[i], s[i]))
+				return false;
+		}
+		return true;
+	}
+
+	bool instantiation_cache::retrieve(uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t generation, text_with_formatting& out) {
+		if(e - s > ptrdiff_t(max_parameters))
+			return false;
+
+		auto const h = hash_key(id, s, e, generation);
+		std::lock_guard guard(lock);
+
+		if(!entries.empty()) {
+			auto const set_start = (h % sets) * ways;
+			for(uint32_t i = 0; i < ways; ++i) {
+				auto& en = entries[set_start + i];
+				if(en.matches(h, id, s, e, generation)) {
+					en.last_used = ++use_counter;
+					out.text.assign(en.result.text);
+					out.formatting.assign(en.result.formatting.begin(), en.result.formatting.end());
+					++counters.hits;
+					return true;
+				}
+			}
+		}
+		++counters.misses;
+		return false;
+	}
+
+	void instantiation_cache::store(uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t generation, text_with_formatting const& result) {
+		if(e - s > ptrdiff_t(max_parameters))
+			return;
+
+		auto const h = hash_key(id, s, e, generation);
+		std::lock_guard guard(lock);
+
+		if(entries.empty())
+			entries.resize(size_t(sets) * ways);
+
+		// replace the least recently used entry of the set; empty entries have never been used
+		auto const set_start = (h % sets) * ways;
+		auto* victim = &entries[set_start];
+		for(uint32_t i = 1; i < ways; ++i) {
+			if(entries[set_start + i].last_used < victim->last_used)
+				victim = &entries[set_start + i];
+		}
+
+		victim->hash = h;
+		victim->text_id = id;
+		victim->generation = generation;
+		victim->parameter_count = uint8_t(e - s);
+		std::copy(s, e, victim->parameters.begin());
+		victim->last_used = ++use_counter;
+		victim->result.text.assign(result.text);
+		victim->result.formatting.assign(result.formatting.begin(), result.formatting.end());
+	}
+
+	void instantiation_cache::clear() {
+		std::lock_guard guard(lock);
+		entries.clear();
+		use_counter = 0;
+	}
+
+	instantiation_cache_counters instantiation_cache::get_counters() const {
+		std::lock_guard guard(lock);
+		return counters;
+	}
+}
@@ -0,0 +1,976 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <thread>
+
+namespace printui::text {
+
+	text_with_formatting& text_with_formatting::operator+=(text_with_formatting const& o) {
+		auto old_length = text.length();
+		text += o.text;
+		for(auto& f : o.formatting) {
+			formatting.push_back(format_marker{ uint16_t(f.position + old_length), f.format });
+		}
+		return *this;
+	}
+
+	void text_with_formatting::append(text_data_storage const& tm, static_text_with_formatting const& o) {
+		if(tm.encoding == text_storage_encoding::utf8) {
+			// marker positions are byte offsets, so the text is transcoded in pieces, one marker at a time
+			auto const source = std::string_view(tm.utf8_storage).substr(o.code_points_start, o.code_points_count);
+			uint32_t copied = 0;
+			for(uint32_t i = o.formatting_start; i < o.formatting_end; ++i) {
+				auto const& m = tm.static_format_storage[i];
+				append_utf8_as_utf16(text, source.substr(copied, m.position - copied));
+				copied = m.position;
+				formatting.push_back(format_marker{ uint16_t(text.length()), m.format });
+			}
+			append_utf8_as_utf16(text, source.substr(copied));
+			return;
+		}
+
+		auto old_length = text.length();
+
+		text.append(tm.codepoint_storage.data() + o.code_points_start, tm.codepoint_storage.data() + o.code_points_start + o.code_points_count);
+
+		for(uint32_t i = o.formatting_start; i < o.formatting_end; ++i) {
+			formatting.push_back(format_marker{ uint16_t(tm.static_format_storage[i].position + old_length), tm.static_format_storage[i].format });
+		}
+	}
+
+	namespace {
+		void append_stored_text(std::wstring& out, wchar_t const* from, wchar_t const* to) {
+			out.append(from, to);
+		}
+		void append_stored_text(std::wstring& out, char const* from, char const* to) {
+			append_utf8_as_utf16(out, std::string_view(from, size_t(to - from)));
+		}
+
+		// one pass over the markers, which must be in position order: text is copied up to each marker in turn
+		// and a parameter placeholder is replaced by the parameter's text, bracketed by substitution marks
+		template<typename C>
+		void append_with_substitutions(text_with_formatting& out, C const* source, uint32_t source_length, format_marker const* markers_begin, format_marker const* markers_end, replaceable_instance const* start, replaceable_instance const* end) {
+			auto const num_params = end - start;
+			uint32_t copied = 0;
+
+			for(auto m = markers_begin; m != markers_end; ++m) {
+				if(std::holds_alternative<parameter_id>(m->format) && std::get<parameter_id>(m->format).id < num_params) {
+					auto id = std::get<parameter_id>(m->format).id;
+					auto const& param = start[id].text_content;
+
+					append_stored_text(out.text, source + copied, source + m->position);
+					copied = uint32_t(m->position) + 1; // skip placeholder
+
+					auto const param_start = out.text.length();
+					out.formatting.push_back(format_marker{ uint16_t(param_start), substitution_mark{ id } });
+					out.text += param.text;
+					for(auto& f : param.formatting) {
+						out.formatting.push_back(format_marker{ uint16_t(f.position + param_start), f.format });
+					}
+					out.formatting.push_back(format_marker{ uint16_t(out.text.length()), substitution_mark{ id } });
+				} else {
+					if(m->position > copied) {
+						append_stored_text(out.text, source + copied, source + m->position);
+						copied = m->position;
+					}
+					out.formatting.push_back(format_marker{ uint16_t(out.text.length()), m->format });
+				}
+			}
+
+			append_stored_text(out.text, source + copied, source + source_length);
+		}
+	}
+
+	void text_with_formatting::make_substitutions(replaceable_instance const* start, replaceable_instance const* end) {
+		auto is_parameter = [](format_marker const& m) { return std::holds_alternative<parameter_id>(m.format); };
+		if(std::none_of(formatting.begin(), formatting.end(), is_parameter))
+			return;
+
+		if(!std::is_sorted(formatting.begin(), formatting.end()))
+			std::stable_sort(formatting.begin(), formatting.end());
+
+		// the result is built in scratch buffers that then trade places with this object's, so that they are reused by the next call
+		thread_local text_with_formatting scratch;
+		scratch.clear();
+		append_with_substitutions(scratch, text.data(), uint32_t(text.length()), formatting.data(), formatting.data() + formatting.size(), start, end);
+		std::swap(text, scratch.text);
+		std::swap(formatting, scratch.formatting);
+	}
+
+	void text_with_formatting::append_substituted(text_data_storage const& tm, static_text_with_formatting const& o, replaceable_instance const* start, replaceable_instance const* end) {
+		auto const markers_begin = tm.static_format_storage.data() + o.formatting_start;
+		auto const markers_end = tm.static_format_storage.data() + o.formatting_end;
+		if(tm.encoding == text_storage_encoding::utf8)
+			append_with_substitutions(*this, tm.utf8_storage.data() + o.code_points_start, o.code_points_count, markers_begin, markers_end, start, end);
+		else
+			append_with_substitutions(*this, tm.codepoint_storage.data() + o.code_points_start, o.code_points_count, markers_begin, markers_end, start, end);
+	}
+
+	void text_with_formatting::clear() noexcept {
+		text.clear();
+		formatting.clear();
+	}
+
+	bool matched_pattern::matches_parameters(text_data_storage const& tm, replaceable_instance const* param_start, replaceable_instance const* param_end) const {
+
+		for(uint32_t i = 0; i < num_keys; ++i) {
+			auto key = tm.match_keys_storage[match_key_start + i];
+			if(key.parameter_id >= (param_end - param_start))
+				return false;
+			bool matched_one = false;
+			for(uint32_t j = 0; !matched_one && j < replaceable_instance::max_attributes; ++j) {
+				if(param_start[key.parameter_id].attributes[j] == key.attribute)
+					matched_one = true;
+			}
+			if(!matched_one)
+				return false;
+		}
+
+		return true;
+	}
+
+
+	namespace {
+		// calls f with the base text of each pattern selected by the parameters: the first match in each group
+		template<typename F>
+		void for_each_selected_pattern(text_data_storage const& tm, text_function const& fn, replaceable_instance const* start, replaceable_instance const* end, F&& f) {
+			auto const num_params = uint32_t(end - start);
+			auto const compiled = size_t(fn.begin_patterns) + fn.pattern_count <= tm.compiled_matchers.size();
+
+			std::array<attribute_set, max_matched_parameters> parameter_attributes;
+			if(compiled) {
+				for(uint32_t i = 0; i < num_params && i < max_matched_parameters; ++i) {
+					for(auto a : start[i].attributes) {
+						parameter_attributes[i].add(a);
+					}
+				}
+			}
+
+			int32_t last_matched_group = -1;
+
+			for(uint32_t j = 0; j < fn.pattern_count; ++j) {
+				auto& pattern = tm.static_matcher_storage[fn.begin_patterns + j];
+				if(int32_t(pattern.group) == last_matched_group)
+					continue;
+
+				bool matched = true;
+				if(compiled) {
+					auto const& c = tm.compiled_matchers[fn.begin_patterns + j];
+					for(uint32_t k = 0; matched && k < c.requirement_count; ++k) {
+						auto const& r = tm.requirement_storage[c.requirement_start + k];
+						matched = r.parameter_id < num_params && parameter_attributes[r.parameter_id].contains_all(r.required);
+					}
+				} else {
+					matched = pattern.matches_parameters(tm, start, end);
+				}
+
+				if(matched) {
+					last_matched_group = int32_t(pattern.group);
+					f(pattern.base_text);
+				}
+			}
+		}
+	}
+
+	replaceable_instance text_function::instantiate(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end) const {
+
+		replaceable_instance result;
+		result.attributes = attributes;
+
+		for_each_selected_pattern(tm, *this, start, end, [&](static_text_with_formatting const& base_text) {
+			result.text_content.append(tm, base_text);
+		});
+
+		return result;
+	}
+
+	void text_function::instantiate_into(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end, text_with_formatting& out) const {
+		for_each_selected_pattern(tm, *this, start, end, [&](static_text_with_formatting const& base_text) {
+			out.append_substituted(tm, base_text, start, end);
+		});
+	}
+
+	namespace {
+		// decodes the sequence starting at position, advancing past it; a malformed sequence becomes U+FFFD
+		uint32_t decode_utf8(std::string_view in, size_t& position) {
+			uint8_t const lead = uint8_t(in[position]);
+			if(lead < 0x80) {
+				++position;
+				return lead;
+			}
+
+			uint32_t length = 0;
+			uint32_t value = 0;
+			uint32_t minimum = 0;
+			if((lead & 0xE0) == 0xC0) {
+				length = 2; value = lead & 0x1F; minimum = 0x80;
+			} else if((lead & 0xF0) == 0xE0) {
+				length = 3; value = lead & 0x0F; minimum = 0x800;
+			} else if((lead & 0xF8) == 0xF0) {
+				length = 4; value = lead & 0x07; minimum = 0x10000;
+			} else {
+				++position;
+				return 0xFFFD;
+			}
+
+			uint32_t consumed = 1;
+			for(; consumed < length && position + consumed < in.length(); ++consumed) {
+				uint8_t const next = uint8_t(in[position + consumed]);
+				if((next & 0xC0) != 0x80)
+					break;
+				value = (value << 6) | (next & 0x3F);
+			}
+			position += consumed;
+
+			if(consumed != length || value < minimum || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF))
+				return 0xFFFD;
+			return value;
+		}
+
+		void append_codepoint_as_utf8(std::string& out, uint32_t c) {
+			if(c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+				c = 0xFFFD;
+
+			if(c < 0x80) {
+				out += char(c);
+			} else if(c < 0x800) {
+				out += char(0xC0 | (c >> 6));
+				out += char(0x80 | (c & 0x3F));
+			} else if(c < 0x10000) {
+				out += char(0xE0 | (c >> 12));
+				out += char(0x80 | ((c >> 6) & 0x3F));
+				out += char(0x80 | (c & 0x3F));
+			} else {
+				out += char(0xF0 | (c >> 18));
+				out += char(0x80 | ((c >> 12) & 0x3F));
+				out += char(0x80 | ((c >> 6) & 0x3F));
+				out += char(0x80 | (c & 0x3F));
+			}
+		}
+	}
+
+	size_t text_data_storage::stored_length() const noexcept {
+		return encoding == text_storage_encoding::utf8 ? utf8_storage.length() : codepoint_storage.length();
+	}
+
+	void text_data_storage::store_codepoint(uint32_t c) {
+		if(encoding == text_storage_encoding::utf8) {
+			append_codepoint_as_utf8(utf8_storage, c);
+		} else if(c < 0x10000) {
+			codepoint_storage += wchar_t(c);
+		} else {
+			auto p = make_surrogate_pair(c);
+			codepoint_storage += wchar_t(p.high);
+			codepoint_storage += wchar_t(p.low);
+		}
+	}
+
+	void text_data_storage::store_utf8(std::string_view text) {
+		if(encoding != text_storage_encoding::utf8) {
+			append_utf8_as_utf16(codepoint_storage, text);
+			return;
+		}
+		// stored as given when well formed, so that instantiation can transcode any piece of it without checking
+		size_t i = 0;
+		while(i < text.length()) {
+			auto const start = i;
+			auto const c = decode_utf8(text, i);
+			if(c == 0xFFFD && text.substr(start, i - start) != "\xEF\xBF\xBD")
+				append_codepoint_as_utf8(utf8_storage, c);
+			else
+				utf8_storage.append(text.data() + start, i - start);
+		}
+	}
+
+	void text_data_storage::clear_stored_text() noexcept {
+		codepoint_storage.clear();
+		utf8_storage.clear();
+	}
+
+	void text_data_storage::compile_matchers() {
+		if(compiled_matchers.size() > static_matcher_storage.size()) {
+			compiled_matchers.clear();
+			requirement_storage.clear();
+		}
+
+		for(size_t i = compiled_matchers.size(); i < static_matcher_storage.size(); ++i) {
+			auto const& m = static_matcher_storage[i];
+			compiled_pattern c;
+			c.requirement_start = uint16_t(requirement_storage.size());
+
+			for(uint32_t k = 0; k < m.num_keys; ++k) {
+				auto const& key = match_keys_storage[m.match_key_start + k];
+				auto existing = std::find_if(requirement_storage.begin() + c.requirement_start, requirement_storage.end(), [&](attribute_requirement const& r) { return r.parameter_id == key.parameter_id; });
+				if(existing == requirement_storage.end()) {
+					requirement_storage.emplace_back();
+					requirement_storage.back().parameter_id = key.parameter_id;
+					existing = requirement_storage.end() - 1;
+				}
+				existing->required.add(key.attribute);
+			}
+
+			c.requirement_count = uint8_t(requirement_storage.size() - c.requirement_start);
+			compiled_matchers.push_back(c);
+		}
+	}
+
+	struct content_and_remainder {
+		std::string_view content;
+		std::string_view remainder;
+		bool insert_space;
+		bool insert_linebreak;
+	};
+
+	content_and_remainder consume_token(std::string_view in) {
+		content_and_remainder result;
+
+		uint32_t i = 0;
+
+		if(in.length() > 0 && (in[0] == '}' || in[0] == '{')) {
+			result.content = in.substr(0, 1);
+			i = 1;
+
+		} else {
+			for(; i < in.length(); ++i) {
+				if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n' && in[i] != '_') {
+					break;
+				}
+			}
+
+			auto const start = i;
+
+			for(; i < in.length(); ++i) {
+				if(in[i] == ' ' || in[i] == '\t' || in[i] == '\r' || in[i] == '\n' || in[i] == '_' || in[i] == '{' || in[i] == '}') {
+					break;
+				}
+			}
+
+			result.content = in.substr(start, i - start);
+		}
+
+		if(i == in.length() || in[i] == '_' || in[i] == '{' || in[i] == '}') {
+			result.insert_space = false;
+		} else {
+			result.insert_space = true;
+		}
+
+		result.insert_linebreak = false;
+		for(; i < in.length(); ++i) {
+			if(in[i] == '\n')
+				result.insert_linebreak = true;
+			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n' && in[i] != '_') {
+				break;
+			}
+		}
+
+		result.remainder = in.substr(i);
+		return result;
+	}
+
+	std::string_view text_data_storage::parse_match_conditions(std::string_view body) {
+		body = consume_token(body).remainder; // eat first token
+
+		while(body.length() > 0) {
+			auto consumed_token = consume_token(body);
+			body = consumed_token.remainder;
+
+			if(consumed_token.content.length() == 1 && consumed_token.content[0] == '}')
+				return body;
+
+			if(consumed_token.content.length() >= 3 && std::isdigit(consumed_token.content[0]) && consumed_token.content[0] != '0') {
+				auto parameter_id = consumed_token.content[0] - '1';
+				auto rem_string = consumed_token.content.substr(2); // skip dot
+
+				if(rem_string == "zero") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::zero, uint8_t(parameter_id) });
+				} else if(rem_string == "one") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::one, uint8_t(parameter_id) });
+				} else if(rem_string == "two") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::two, uint8_t(parameter_id) });
+				} else if(rem_string == "few") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::few, uint8_t(parameter_id) });
+				} else if(rem_string == "many") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::many, uint8_t(parameter_id) });
+				} else if(rem_string == "other") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::other, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-zero") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_zero, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-one") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_one, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-two") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_two, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-few") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_few, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-many") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_many, uint8_t(parameter_id) });
+				} else if(rem_string == "ord-other") {
+					this->match_keys_storage.push_back(param_attribute_pair{ text::ord_other, uint8_t(parameter_id) });
+				} else {
+					if(auto it = attribute_name_to_id.find(rem_string); it != attribute_name_to_id.end()) {
+						match_keys_storage.push_back(param_attribute_pair{ it->second, uint8_t(parameter_id) });
+					} else {
+						++last_attribute_id_mapped;
+						attribute_name_to_id.insert_or_assign(std::string(rem_string), last_attribute_id_mapped);
+						match_keys_storage.push_back(param_attribute_pair{ last_attribute_id_mapped, uint8_t(parameter_id) });
+					}
+				}
+			}
+		}
+		return body;
+	}
+
+	std::string_view text_data_storage::assemble_entry_content(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index, bool allow_match) {
+		
+		size_t last_text_start = 0;
+		size_t formatting_start = 0;
+		uint8_t group = 0;
+
+		bool previous_insert_space = false;
+		bool previous_insert_line = false;
+		size_t current_matcher_index = size_t(-2);
+
+		std::vector<formatting_content> formatting_stack;
+
+		auto restart_match_body = [&]() {
+			if(current_matcher_index + 1 != static_matcher_storage.size()) {
+				last_text_start = stored_length();
+				formatting_start = static_format_storage.size();
+
+				if(!static_matcher_storage.empty()) {
+					static_matcher_storage.back().base_text.code_points_count = uint16_t(last_text_start - static_matcher_storage.back().base_text.code_points_start);
+					static_matcher_storage.back().base_text.formatting_end = uint16_t(formatting_start);
+					group = static_matcher_storage.back().group + 1;
+				}
+
+				current_matcher_index = static_matcher_storage.size();
+				static_matcher_storage.emplace_back();
+
+				static_matcher_storage[current_matcher_index].base_text.code_points_start = uint32_t(last_text_start);
+				static_matcher_storage[current_matcher_index].base_text.formatting_start = uint16_t(formatting_start);
+				static_matcher_storage[current_matcher_index].group = group;
+			}
+		};
+		auto append_spaces = [&](content_and_remainder const& st) { 
+			if(previous_insert_line && previous_insert_space) {
+				restart_match_body();
+				store_codepoint('\n');
+			} else if(previous_insert_space) {
+				restart_match_body();
+				store_codepoint(' ');
+			}
+			previous_insert_line = st.insert_linebreak;
+			previous_insert_space = st.insert_space;
+		};
+		auto update_spaces = [&](content_and_remainder const& st) {
+			previous_insert_line = st.insert_linebreak;
+			previous_insert_space = st.insert_space;
+		};
+
+		while(body.length() > 0) {
+			auto t = consume_token(body);
+
+			if(t.content.length() == 1 && t.content[0] == '}' && formatting_stack.empty()) {
+				if(current_matcher_index + 1 == static_matcher_storage.size()) {
+					static_matcher_storage.back().base_text.code_points_count = uint16_t(stored_length() - static_matcher_storage.back().base_text.code_points_start);
+					static_matcher_storage.back().base_text.formatting_end = uint16_t(static_format_storage.size());
+				}
+				return body;
+			}
+
+			body = t.remainder;
+			
+			if(t.content.length() == 0) {
+				// do nothing
+			} else if(t.content.length() == 1 && t.content[0] == '}') {
+				restart_match_body();
+				static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), formatting_stack.back() });
+				formatting_stack.pop_back();
+				update_spaces(t);
+			} else {
+				append_spaces(t);
+				if(t.content != "\\match") {
+					restart_match_body();
+				}
+
+				if(t.content[0] != '\\') {
+					store_utf8(t.content);
+				} else if(t.content == "\\it") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::italic });
+						formatting_stack.push_back(extra_formatting::italic);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\b") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::bold });
+						formatting_stack.push_back(extra_formatting::bold);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\sc") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::small_caps });
+						formatting_stack.push_back(extra_formatting::small_caps);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\os") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::old_numbers });
+						formatting_stack.push_back(extra_formatting::old_numbers);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\sup") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::superscript });
+						formatting_stack.push_back(extra_formatting::superscript);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\sub") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::subscript });
+						formatting_stack.push_back(extra_formatting::subscript);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\tb") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), extra_formatting::tabular_numbers });
+						formatting_stack.push_back(extra_formatting::tabular_numbers);
+						previous_insert_space = false;
+					}
+				} else if(t.content == "\\c") {
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+
+						body = next_token.remainder;
+
+						while(true) {
+							auto content_token = consume_token(body);
+							body = content_token.remainder;
+
+							if(content_token.content.length() == 1 && content_token.content[0] == '}') {
+								update_spaces(content_token);
+								break;
+							}
+							if(content_token.content.length() == 0)
+								break;
+
+							if(content_token.content == "left-brace") {
+								store_codepoint('{');
+							} else if(content_token.content == "right-brace") {
+								store_codepoint('}');
+							} else if(std::isdigit(content_token.content[0])) {
+								std::string temp(content_token.content);
+								uint32_t val = std::strtoul(temp.c_str(), nullptr, 0);
+
+								store_codepoint(val);
+							} else if(content_token.content == "em-space") {
+								store_codepoint(0x2003);
+							} else if(content_token.content == "en-space") {
+								store_codepoint(0x2002);
+							} else if(content_token.content == "3rd-em") {
+								store_codepoint(0x2004);
+							} else if(content_token.content == "4th-em") {
+								store_codepoint(0x2005);
+							} else if(content_token.content == "6th-em") {
+								store_codepoint(0x2006);
+							} else if(content_token.content == "thin-space") {
+								store_codepoint(0x2009);
+							} else if(content_token.content == "hair-space") {
+								store_codepoint(0x200A);
+							} else if(content_token.content == "figure-space") {
+								store_codepoint(0x2007);
+							} else if(content_token.content == "ideo-space") {
+								store_codepoint(0x3000);
+							} else if(content_token.content == "hyphen") {
+								store_codepoint(0x2010);
+							} else if(content_token.content == "figure-dash") {
+								store_codepoint(0x2012);
+							} else if(content_token.content == "en-dash") {
+								store_codepoint(0x2013);
+							} else if(content_token.content == "em-dash") {
+								store_codepoint(0x2014);
+							} else if(content_token.content == "minus") {
+								store_codepoint(0x2212);
+							} else {
+								store_utf8(content_token.content);
+							}
+						}
+
+					}
+				} else if(t.content.length() == 2 && std::isdigit(t.content[1]) && t.content[1] != '0') {
+					static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), parameter_id{ uint8_t(t.content[1] - '1') } });
+					store_codepoint('?');
+				} else if(t.content == "\\match" && allow_match) {
+					++group;
+					for(; body.length() > 0 && body[0] == '{';) {
+
+						auto condition_id = match_keys_storage.size();
+						body = parse_match_conditions(body);
+						auto conditions_count = match_keys_storage.size() - condition_id;
+
+						if(body.length() > 0 && body[0] == '{') {
+							auto id_before = static_matcher_storage.size();
+
+							body = consume_token(body).remainder;
+							body = assemble_entry_content(body, font_name_to_index, false);
+
+							if(static_matcher_storage.size() != id_before) {
+								static_matcher_storage.back().group = group;
+								static_matcher_storage.back().match_key_start = uint16_t(condition_id);
+								static_matcher_storage.back().num_keys = uint8_t(conditions_count);
+							}
+
+							auto end_token = consume_token(body);
+							update_spaces(end_token);
+							body = end_token.remainder;
+						}
+					}
+					++group;
+
+				} else { // other = font name
+					uint8_t fid = 0;
+
+					if(auto it = font_name_to_index.find(t.content.substr(1)); it != font_name_to_index.end()) {
+						fid = uint8_t(it->second);
+					}
+
+					auto next_token = consume_token(body);
+					if(next_token.content.length() == 1 && next_token.content[0] == '{') {
+						body = next_token.remainder;
+						static_format_storage.emplace_back(format_marker{ uint16_t(stored_length() - last_text_start), font_id{fid} });
+						formatting_stack.push_back(font_id{ fid });
+						previous_insert_space = false;
+					}
+				}
+			}
+		} // while body not empty loop
+
+		if(current_matcher_index + 1 == static_matcher_storage.size()) {
+			static_matcher_storage.back().base_text.code_points_count = uint16_t(stored_length() - static_matcher_storage.back().base_text.code_points_start);
+			static_matcher_storage.back().base_text.formatting_end = uint16_t(static_format_storage.size());
+		}
+		return body;
+	}
+
+	struct top_level_cr {
+		std::string_view content;
+		std::string_view remainder;
+	};
+
+	top_level_cr consume_text_name(std::string_view in) {
+		top_level_cr result;
+
+		uint32_t i = 0;
+
+		for(; i < in.length(); ++i) {
+			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n') {
+				break;
+			}
+		}
+
+		auto const start = i;
+
+		for(; i < in.length(); ++i) {
+			if(in[i] == ' ' || in[i] == '\t' || in[i] == '\r' || in[i] == '\n' || in[i] == '{' || in[i] == '}') {
+				break;
+			}
+		}
+
+		result.content = in.substr(start, i - start);
+
+		for(; i < in.length(); ++i) {
+			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r' && in[i] != '\n') {
+				break;
+			}
+		}
+
+		result.remainder = in.substr(i);
+		return result;
+	}
+	
+	top_level_cr consume_braced_content(std::string_view in) {
+		top_level_cr result;
+		
+		uint32_t i = 0;
+		int32_t depth = 0;
+
+		for(; i < in.length(); ++i) {
+			if(in[i] == '{') {
+				++depth;
+			} else if(in[i] == '}') {
+				--depth;
+			}
+			if(depth <= 0) {
+				break;
+			}
+		}
+		++i;
+
+		result.content = in.substr(1, i > 1 ? (i - 2) : 0);
+
+		for(; i < in.length(); ++i) {
+			if(in[i] != ' ' && in[i] != '\t' && in[i] != '\r') {
+				break;
+			}
+		}
+
+		result.remainder = in.substr(i);
+		return result;
+	}
+
+	std::array<attribute_type, replaceable_instance::max_attributes> text_data_storage::parse_attributes(std::string_view body) {
+		std::array<attribute_type, replaceable_instance::max_attributes> result = { attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1) };
+		uint32_t used = 0;
+
+		while(body.length() > 0 && used < replaceable_instance::max_attributes) {
+			auto consumed_token = consume_token(body);
+			body = consumed_token.remainder;
+
+
+			if(consumed_token.content.length() != 0) {
+
+				if(consumed_token.content == "zero") {
+					result[used] = text::zero;
+					++used;
+				} else if(consumed_token.content == "one") {
+					result[used] = text::one;
+					++used;
+				} else if(consumed_token.content == "two") {
+					result[used] = text::two;
+					++used;
+				} else if(consumed_token.content == "few") {
+					result[used] = text::few;
+					++used;
+				} else if(consumed_token.content == "many") {
+					result[used] = text::many;
+					++used;
+				} else if(consumed_token.content == "other") {
+					result[used] = text::other;
+					++used;
+				} else if(consumed_token.content == "ord-zero") {
+					result[used] = text::ord_zero;
+					++used;
+				} else if(consumed_token.content == "ord-one") {
+					result[used] = text::ord_one;
+					++used;
+				} else if(consumed_token.content == "ord-two") {
+					result[used] = text::ord_two;
+					++used;
+				} else if(consumed_token.content == "ord-few") {
+					result[used] = text::ord_few;
+					++used;
+				} else if(consumed_token.content == "ord-many") {
+					result[used] = text::ord_many;
+					++used;
+				} else if(consumed_token.content == "ord-other") {
+					result[used] = text::ord_other;
+					++used;
+				} else {
+					if(auto it = attribute_name_to_id.find(consumed_token.content); it != attribute_name_to_id.end()) {
+						result[used] = it->second;
+						++used;
+					} else {
+						++last_attribute_id_mapped;
+						attribute_name_to_id.insert_or_assign(std::string(consumed_token.content), last_attribute_id_mapped);
+						result[used] = last_attribute_id_mapped;
+						++used;
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	std::string_view text_data_storage::consume_single_entry(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index) {
+		top_level_cr entry_name;
+
+		while(body.length() > 0) {
+			entry_name = consume_text_name(body);
+			body = entry_name.remainder;
+
+			if(body.length() != 0 && body[0] == '{')
+				break; //name begins some content
+		}
+		if(body.length() == 0)
+			return body; // trailing whitespace, no entry
+
+		bool already_exists = false;
+		uint16_t id = 0;
+		if(auto it = internal_text_name_map.find(entry_name.content); it == internal_text_name_map.end()) {
+			stored_functions.emplace_back();
+			id = uint16_t(stored_functions.size() - 1);
+			internal_text_name_map.insert_or_assign(std::string(entry_name.content), id);
+		} else {
+			id = it->second;
+			if(stored_functions[it->second].pattern_count != 0) {
+				already_exists = true;
+			}
+		}
+
+		auto first_content = consume_braced_content(body);
+		if(first_content.remainder.length() > 0 && first_content.remainder[0] == '{') {
+			auto second_content = consume_braced_content(first_content.remainder);
+
+			if(!already_exists) {
+
+				auto pre_entry_size = static_matcher_storage.size();
+				assemble_entry_content(second_content.content, font_name_to_index, true);
+				auto created_entries = static_matcher_storage.size() - pre_entry_size;
+				if(created_entries != 0) {
+
+					stored_functions[id].attributes = parse_attributes(first_content.content);
+					stored_functions[id].begin_patterns = uint16_t(pre_entry_size);
+					stored_functions[id].pattern_count = uint16_t(created_entries);
+				}
+			}
+
+			return second_content.remainder;
+		} else {
+			if(first_content.content.length() > 0 && !already_exists) {
+				auto pre_entry_size = static_matcher_storage.size();
+				assemble_entry_content(first_content.content, font_name_to_index, true);
+				auto created_entries = static_matcher_storage.size() - pre_entry_size;
+				if(created_entries != 0) {
+					stored_functions[id].begin_patterns = uint16_t(pre_entry_size);
+					stored_functions[id].pattern_count = uint16_t(created_entries);
+				}
+			}
+			return first_content.remainder;
+		}
+
+	}
+
+	void text_data_storage::consume_text_file(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index) {
+		while(body.length() > 0) {
+			body = consume_single_entry(body, font_name_to_index);
+		}
+		compile_matchers();
+	}
+
+	void consume_text_files(text_data_storage& target, size_t file_count, text_file_loader const& load_file, uint32_t thread_count) {
+		if(file_count <= 1 || thread_count <= 1) {
+			for(size_t i = 0; i < file_count; ++i) {
+				load_file(i, target);
+			}
+			return;
+		}
+
+		std::vector<text_data_storage> partials(file_count);
+		for(auto& p : partials) {
+			p.encoding = target.encoding;
+		}
+		std::atomic<size_t> next_file{ 0 };
+		auto worker = [&]() {
+			for(size_t f = next_file++; f < file_count; f = next_file++) {
+				load_file(f, partials[f]);
+			}
+		};
+
+		auto const extra_threads = uint32_t(std::min(size_t(thread_count), file_count) - 1);
+		std::vector<std::thread> threads;
+		threads.reserve(extra_threads);
+		for(uint32_t i = 0; i < extra_threads; ++i) {
+			threads.emplace_back(worker);
+		}
+		worker();
+		for(auto& t : threads) {
+			t.join();
+		}
+
+		// merging in file order keeps the first definition of a name, just as parsing the files one after another would
+		for(auto const& p : partials) {
+			merge_text_data(target, p);
+		}
+	}
+
+	uint32_t assemble_codepoint(uint16_t high, uint16_t low) noexcept {
+		uint32_t high_bits = (high & 0x03FF) << 10;
+		uint32_t low_bits = low & 0x03FF;
+		uint32_t temp = high_bits | low_bits;
+		return temp + 0x10000;
+	}
+	
+	surrogate_pair make_surrogate_pair(uint32_t val) noexcept {
+		uint32_t v = val - 0x10000;
+		uint32_t h = ((v >> 10) & 0x03FF) | 0xD800;
+		uint32_t l = (v & 0x03FF) | 0xDC00;
+		return surrogate_pair{uint16_t(h), uint16_t(l) };
+	}
+
+	bool is_low_surrogate(uint16_t char_code) noexcept {
+		return char_code >= 0xDC00 && char_code <= 0xDFFF;
+	}
+	bool is_high_surrogate(uint16_t char_code) noexcept {
+		return char_code >= 0xD800 && char_code <= 0xDBFF;
+	}
+	bool is_paragraph_separator(uint16_t char_code) noexcept {
+		// the characters of bidi class B
+		return char_code == 0x000A || char_code == 0x000D || (0x001C <= char_code && char_code <= 0x001E) || char_code == 0x0085 || char_code == 0x2029;
+	}
+
+	edited_range find_edited_paragraphs(std::wstring_view old_text, std::wstring_view new_text) noexcept {
+		auto const shorter = std::min(old_text.length(), new_text.length());
+		size_t prefix = 0;
+		while(prefix < shorter && old_text[prefix] == new_text[prefix])
+			++prefix;
+		size_t suffix = 0;
+		while(suffix < shorter - prefix && old_text[old_text.length() - 1 - suffix] == new_text[new_text.length() - 1 - suffix])
+			++suffix;
+
+		if(prefix == old_text.length() && prefix == new_text.length())
+			return edited_range{ uint32_t(prefix), uint32_t(prefix), uint32_t(prefix) };
+
+		// both boundaries are searched for in the unchanged text, so that they are paragraph boundaries in both versions
+		size_t start = prefix;
+		while(start > 0 && !is_paragraph_separator(uint16_t(new_text[start - 1])))
+			--start;
+
+		size_t end = new_text.length() - suffix;
+		while(end < new_text.length() && !is_paragraph_separator(uint16_t(new_text[end])))
+			++end;
+		if(end < new_text.length()) {
+			++end;
+			if(new_text[end - 1] == L'\r' && end < new_text.length() && new_text[end] == L'\n')
+				++end;
+		}
+
+		return edited_range{ uint32_t(start), uint32_t(end + old_text.length() - new_text.length()), uint32_t(end) };
+	}
+
+	void append_utf8_as_utf16(std::wstring& out, std::string_view in) {
+		size_t i = 0;
+		while(i < in.length()) {
+			uint8_t const lead = uint8_t(in[i]);
+			if(lead < 0x80) {
+				out += wchar_t(lead);
+				++i;
+				continue;
+			}
+
+			auto const c = decode_utf8(in, i);
+			if(c < 0x10000) {
+				out += wchar_t(c);
+			} else {
+				auto p = make_surrogate_pair(c);
+				out += wchar_t(p.high);
+				out += wchar_t(p.low);
+			}
+		}
+	}
+}
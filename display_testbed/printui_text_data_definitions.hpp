@@ -0,0 +1,498 @@
+#ifndef PRINTUI_TEXT_DATA_HEADER
+#define PRINTUI_TEXT_DATA_HEADER
+
+// the localization core: loading text files and instantiating text from them
+// nothing in here may depend on the OS; see printui_text.cpp for the windows side
+
+#include "printui_datatypes.hpp"
+#include "unordered_dense.h"
+
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+
+namespace printui::text {
+	struct format_marker;
+
+	enum class extra_formatting : uint8_t {
+		none, small_caps, italic, old_numbers, tabular_numbers, bold, superscript, subscript
+	};
+	struct font_id {
+		uint8_t id = 0;
+	};
+	struct parameter_id {
+		uint8_t id = 0;
+	};
+	struct substitution_mark {
+		uint8_t id = 0;
+	};
+
+	using formatting_content = std::variant<std::monostate, font_id, parameter_id, substitution_mark, extra_formatting>;
+
+	struct format_marker {
+		uint16_t position;
+		formatting_content format;
+
+		bool operator<(const format_marker& o) const noexcept {
+			return position < o.position;
+		}
+	};
+
+	struct string_hash {
+		using is_transparent = void;
+		[[nodiscard]] size_t operator()(const char* txt) const {
+			return std::hash<std::string_view>{}(txt);
+		}
+		[[nodiscard]] size_t operator()(std::string_view txt) const {
+			return std::hash<std::string_view>{}(txt);
+		}
+		[[nodiscard]] size_t operator()(const std::string& txt) const {
+			return std::hash<std::string_view>{}(std::string_view(txt));
+		}
+	};
+	struct text_id {
+		uint32_t id = 0;
+	};
+	struct fp_param {
+		double value = 0.0;
+		uint8_t decimal_places = 0;
+	};
+	struct int_param {
+		int64_t value = 0;
+		uint8_t decimal_places = 0;
+	};
+	using text_parameter = std::variant<int_param, fp_param, text_id>;
+
+	class text_manager;
+	struct text_data_storage;
+
+	using attribute_type = int8_t;
+
+	struct replaceable_instance;
+	struct static_text_with_formatting;
+
+	// contains a string plus indices where formatting must be applied
+	struct text_with_formatting {
+		std::wstring text;
+		std::vector<format_marker> formatting;
+
+		text_with_formatting& operator+=(text_with_formatting const& other);
+		void append(text_data_storage const& tm, static_text_with_formatting const& other);
+		void make_substitutions(replaceable_instance const* start, replaceable_instance const* end);
+		// appends the static text with its parameters already substituted; does not allocate once the buffers have grown large enough
+		void append_substituted(text_data_storage const& tm, static_text_with_formatting const& other, replaceable_instance const* start, replaceable_instance const* end);
+		void clear() noexcept;
+	};
+
+	// as above, but formatting and text itself are fixed after load
+	struct static_text_with_formatting {
+		uint32_t code_points_start;
+		uint16_t code_points_count;
+		uint16_t formatting_start;
+		uint16_t formatting_end;
+	};
+
+	// result of calling a text function, holds attributes
+	struct replaceable_instance {
+		static constexpr uint32_t max_attributes = 8;
+
+		text_with_formatting text_content;
+		std::array<attribute_type, max_attributes> attributes = { attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1) };
+	};
+
+	struct param_attribute_pair {
+		attribute_type attribute = attribute_type(-1);
+		uint8_t parameter_id = 0;
+	};
+
+	struct matched_pattern {
+		static_text_with_formatting base_text;
+		uint16_t match_key_start = 0;
+		uint8_t num_keys = 0;
+		uint8_t group = 0;
+
+		bool matches_parameters(text_data_storage const& tm, replaceable_instance const* param_start, replaceable_instance const* param_end) const;
+	};
+
+
+	// the attributes of a parameter as a bitset, so that a pattern's keys can be checked with a few masks
+	struct attribute_set {
+		uint64_t bits[2] = { 0, 0 };
+
+		void add(attribute_type a) noexcept {
+			if(a >= 0)
+				bits[uint8_t(a) >> 6] |= uint64_t(1) << (uint8_t(a) & 63);
+		}
+		bool contains_all(attribute_set const& o) const noexcept {
+			return (bits[0] & o.bits[0]) == o.bits[0] && (bits[1] & o.bits[1]) == o.bits[1];
+		}
+	};
+
+	// all the keys of a pattern that refer to one parameter
+	struct attribute_requirement {
+		attribute_set required;
+		uint8_t parameter_id = 0;
+	};
+
+	// a matched_pattern reduced to its requirements, built by text_data_storage::compile_matchers
+	struct compiled_pattern {
+		uint16_t requirement_start = 0;
+		uint8_t requirement_count = 0;
+	};
+
+	// match keys are written as a single digit, so only the first nine parameters can be matched on
+	inline constexpr uint32_t max_matched_parameters = 9;
+
+	// takes parameters -> fn or pattern match -> replaceable instance
+	struct text_function {
+		uint16_t begin_patterns = 0;
+		uint16_t pattern_count = 0;
+
+		// attributes assigend to results
+		std::array<attribute_type, replaceable_instance::max_attributes> attributes = { attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1), attribute_type(-1) };
+
+		replaceable_instance instantiate(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end) const;
+		// appends the result, with substitutions made, to out; equivalent to instantiate followed by make_substitutions
+		void instantiate_into(text_data_storage const& tm, replaceable_instance const* start, replaceable_instance const* end, text_with_formatting& out) const;
+	};
+
+
+	inline constexpr attribute_type zero = 0;
+	inline constexpr attribute_type one = 1;
+	inline constexpr attribute_type two = 2;
+	inline constexpr attribute_type few = 3;
+	inline constexpr attribute_type many = 4;
+	inline constexpr attribute_type other = 5;
+
+	inline constexpr attribute_type ord_zero = 6;
+	inline constexpr attribute_type ord_one = 7;
+	inline constexpr attribute_type ord_two = 8;
+	inline constexpr attribute_type ord_few = 9;
+	inline constexpr attribute_type ord_many = 10;
+	inline constexpr attribute_type ord_other = 11;
+
+	inline constexpr attribute_type last_predefined = 11;
+
+
+	using cardinal_plural_fn = attribute_type(*)(int64_t, int64_t, int32_t);
+	using ordinal_plural_fn = attribute_type(*)(int64_t);
+
+	// the plural rules of a language, or of a language and region such as pt-PT; nullptr when it has only the other form
+	cardinal_plural_fn find_cardinal_plural_rule(std::wstring_view locale);
+	ordinal_plural_fn find_ordinal_plural_rule(std::wstring_view locale);
+
+	// how a text_data_storage keeps its text: utf16, as it is instantiated, or utf8, which is transcoded as it is instantiated
+	// but which for most of our languages takes half the memory, or a quarter where wchar_t is 32 bits
+	enum class text_storage_encoding : uint8_t {
+		utf16, utf8
+	};
+
+	struct text_data_storage {
+		// only the string matching the encoding holds text; the positions of the static text and of its format markers count its code units
+		std::wstring codepoint_storage;
+		std::string utf8_storage;
+		text_storage_encoding encoding = text_storage_encoding::utf16; // must be chosen while the storage is empty
+		std::vector<format_marker> static_format_storage;
+		std::vector<matched_pattern> static_matcher_storage;
+		std::vector<param_attribute_pair> match_keys_storage;
+		std::vector<text_function> stored_functions;
+
+		// looked up by string_view, so that finding a name never allocates
+		ankerl::unordered_dense::map<std::string, uint16_t, string_hash, std::equal_to<>> internal_text_name_map;
+		std::unordered_map<std::string, int8_t, string_hash, std::equal_to<>> attribute_name_to_id;
+		int8_t last_attribute_id_mapped = last_predefined;
+
+		// derived from the matchers and match keys, parallel to static_matcher_storage; see compile_matchers
+		std::vector<compiled_pattern> compiled_matchers;
+		std::vector<attribute_requirement> requirement_storage;
+
+		size_t stored_length() const noexcept;
+		void store_codepoint(uint32_t c);
+		void store_utf8(std::string_view text);
+		void clear_stored_text() noexcept;
+
+		std::string_view parse_match_conditions(std::string_view in);
+		std::string_view assemble_entry_content(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index, bool allow_match);
+		std::array<attribute_type, replaceable_instance::max_attributes> parse_attributes(std::string_view in);
+		std::string_view consume_single_entry(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index);
+		void consume_text_file(std::string_view body, std::unordered_map<std::string, uint32_t, string_hash, std::equal_to<>> const& font_name_to_index);
+		// compiles any matchers added since the last call; until then, they are matched by scanning their keys
+		void compile_matchers();
+	};
+
+	// precompiled text: the storage built from a directory of text files, saved so that it can be reloaded without parsing
+	inline constexpr uint32_t text_bundle_version = 3;
+	inline constexpr uint64_t text_bundle_stamp_seed = 0xCBF29CE484222325;
+
+	// the stamp identifies the sources a bundle was compiled from; a bundle with a different stamp is stale
+	uint64_t hash_bundle_source(uint64_t running_stamp, std::string_view data);
+	// the listing stamp is a cheap stand-in for it, built from the names, sizes, and write times of the sources; while
+	// the listing is unchanged the source stamp is trusted without reading the sources again
+	std::string serialize_text_bundle(text_data_storage const& source, uint64_t source_stamp, uint64_t listing_stamp = 0);
+	struct text_bundle_stamps {
+		uint64_t source = 0;
+		uint64_t listing = 0;
+	};
+	// reads only the header; returns nothing if the bundle was not written by this version
+	std::optional<text_bundle_stamps> read_text_bundle_stamps(std::string_view bundle);
+	// replaces the listing stamp of a bundle whose sources were touched without being changed
+	void restamp_text_bundle(std::string& bundle, uint64_t listing_stamp);
+	// merges the bundle into the target, as if its text files had been parsed; returns false, leaving the target unchanged,
+	// if it is stale, damaged, or stores its text in an encoding other than the target's
+	bool load_text_bundle(text_data_storage& target, std::string_view bundle, uint64_t expected_stamp);
+	// merges a separately built storage into the target, as if its text files had been parsed after the target's own; both must use the same encoding
+	void merge_text_data(text_data_storage& target, text_data_storage const& source);
+
+	// parses one file into the storage it is given; called from worker threads, so it must not touch any other storage
+	using text_file_loader = std::function<void(size_t file_index, text_data_storage& partial)>;
+	// parses each file into its own storage, in the target's encoding, on up to thread_count threads, then merges them into the target in file order
+	void consume_text_files(text_data_storage& target, size_t file_count, text_file_loader const& load_file, uint32_t thread_count);
+
+	struct instantiation_cache_counters {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+	};
+
+	// a bounded, set associative cache of instantiated text, keyed by text id, parameter values and text generation
+	// it locks internally, so it may be shared between threads
+	class instantiation_cache {
+	public:
+		static constexpr uint32_t ways = 4;
+		static constexpr uint32_t sets = 64;
+		static constexpr uint32_t max_parameters = 10; // text with more parameters than this is never cached
+	private:
+		struct entry {
+			text_with_formatting result;
+			std::array<text_parameter, max_parameters> parameters;
+			uint64_t hash = 0;
+			uint32_t last_used = 0;
+			uint16_t text_id = uint16_t(-1);
+			uint8_t parameter_count = 0;
+			uint8_t generation = 0;
+
+			bool matches(uint64_t h, uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t gen) const;
+		};
+
+		std::vector<entry> entries;
+		instantiation_cache_counters counters;
+		uint32_t use_counter = 0;
+		mutable std::mutex lock;
+	public:
+		// copies the cached result into out, reusing its buffers; returns false if it was not cached
+		bool retrieve(uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t generation, text_with_formatting& out);
+		void store(uint16_t id, text_parameter const* s, text_parameter const* e, uint8_t generation, text_with_formatting const& result);
+		void clear();
+		instantiation_cache_counters get_counters() const;
+	};
+
+	struct arrangement_result {
+		arranged_text* ptr = nullptr;
+		int32_t width_used = 0;
+		int32_t lines_used = 0;
+	};
+
+	// everything that determines how a piece of text is arranged; arrangements made from equal keys are interchangeable
+	struct arrangement_key {
+		std::wstring_view text;
+		std::vector<format_marker> const* formatting = nullptr;
+		int32_t max_width = 0;
+		screen_space_point region{ -1, -1 }; // the region the arrangement was fitted to, or -1 if it is as first arranged
+		int32_t layout_size = 0;
+		uint32_t font_generation = 0;
+		text_size text_sz = text_size::standard;
+		content_alignment alignment = content_alignment::leading;
+		layout_orientation orientation = layout_orientation::horizontal_left_to_right;
+		bool single_line = false;
+
+		uint64_t hash() const;
+	};
+
+	struct arrangement_cache_counters {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+	};
+
+	// a bounded cache of text arrangements, shared between everything that displays the same text in the same way
+	// it holds a reference to each arrangement, and adds one for each caller that it hands an arrangement to, so an evicted
+	// arrangement lives on until its last user releases it; arrangements that are shared must not be modified
+	// it may be used from the text arrangement workers as well as from the ui thread
+	// an arrangement that was never handed to anyone but the caller that inserted it can be taken back out with
+	// take_exclusive, after which that caller is free to modify it
+	class arrangement_cache {
+	public:
+		using reference_fn = void(*)(arranged_text*);
+		static constexpr uint32_t capacity = 512;
+	private:
+		struct entry {
+			std::wstring text;
+			std::vector<format_marker> formatting;
+			arrangement_result value;
+			uint64_t hash = 0;
+			uint32_t last_used = 0;
+			uint32_t handed_out = 0; // callers given the arrangement, counting the one that inserted it
+			int32_t max_width = 0;
+			screen_space_point region{ -1, -1 };
+			int32_t layout_size = 0;
+			uint32_t font_generation = 0;
+			text_size text_sz = text_size::standard;
+			content_alignment alignment = content_alignment::leading;
+			layout_orientation orientation = layout_orientation::horizontal_left_to_right;
+			bool single_line = false;
+
+			bool matches(arrangement_key const& k, uint64_t h) const;
+		};
+
+		mutable std::mutex lock;
+		std::vector<entry> entries;
+		ankerl::unordered_dense::map<uint64_t, uint32_t> slot_by_hash;
+		arrangement_cache_counters counters;
+		uint32_t use_counter = 0;
+		reference_fn retain = nullptr;
+		reference_fn release = nullptr;
+	public:
+		arrangement_cache(reference_fn retain, reference_fn release) : retain(retain), release(release) { }
+		arrangement_cache(arrangement_cache const&) = delete;
+		arrangement_cache& operator=(arrangement_cache const&) = delete;
+		~arrangement_cache();
+
+		// the cached arrangement, with a reference added for the caller, or a result with a null ptr
+		arrangement_result find(arrangement_key const& key);
+		// adds the cache's own reference; the caller keeps the one it has
+		void insert(arrangement_key const& key, arrangement_result const& value);
+		// removes the arrangement from the cache if it is stored under the key and only its inserter was ever given it;
+		// the caller keeps its own reference
+		bool take_exclusive(arrangement_key const& key, arranged_text* ptr);
+		void clear();
+		arrangement_cache_counters get_counters() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return counters;
+		}
+		uint32_t size() const {
+			std::lock_guard<std::mutex> guard(lock);
+			return uint32_t(slot_by_hash.size());
+		}
+	};
+
+	// the size an arrangement of text of the given length will probably need, in the same units as an arrangement_result,
+	// for use while the real arrangement is being made; it assumes glyphs half as wide as the line spacing
+	arrangement_result estimate_arrangement(size_t text_length, float line_spacing, int32_t layout_size, int32_t max_width, bool single_line);
+
+	// the parts of a locale's number format used by the formatter; the same values that NUMBERFMTW takes
+	struct number_format {
+		uint32_t leading_zero = 1; // whether 0.5 is written as 0.5 or as .5
+		uint32_t grouping = 3; // group sizes as decimal digits, leftwards from the point; the last size repeats unless it is followed by a 0
+		uint32_t negative_order = 1; // 0: (1.1), 1: -1.1, 2: - 1.1, 3: 1.1-, 4: 1.1 -
+		wchar_t decimal_separator[5] = L".";
+		wchar_t thousand_separator[5] = L",";
+		wchar_t negative_sign[5] = L"-";
+	};
+
+	// append the number following the documented behaviour of GetNumberFormatEx for its decimal string, rounding half away
+	// from zero to decimal_places; on windows, the tests compare the two directly
+	void append_formatted_integer(std::wstring& out, int64_t value, uint32_t decimal_places, number_format const& fmt);
+	// value must be finite; it is formatted as its %f representation would be
+	void append_formatted_decimal(std::wstring& out, double value, uint32_t decimal_places, number_format const& fmt);
+	// parse a number written in the format, with or without its group separators; text that is not a number parses as 0
+	double parse_formatted_decimal(std::wstring_view text, number_format const& fmt);
+	// as above; a fractional value is rounded to the nearest integer, and one that does not fit parses as 0
+	int64_t parse_formatted_integer(std::wstring_view text, number_format const& fmt);
+
+	struct surrogate_pair {
+		uint16_t high = 0; // aka leading
+		uint16_t low = 0; // aka trailing
+	};
+
+	uint32_t assemble_codepoint(uint16_t high, uint16_t low) noexcept;
+	surrogate_pair make_surrogate_pair(uint32_t val) noexcept;
+	bool is_low_surrogate(uint16_t char_code) noexcept;
+	bool is_high_surrogate(uint16_t char_code) noexcept;
+	bool is_paragraph_separator(uint16_t char_code) noexcept;
+
+	// the paragraphs that differ between two versions of a text: [start, old_end) of the old text became
+	// [start, new_end) of the new one, and everything outside of those ranges is the same in both
+	struct edited_range {
+		uint32_t start = 0;
+		uint32_t old_end = 0;
+		uint32_t new_end = 0;
+	};
+	edited_range find_edited_paragraphs(std::wstring_view old_text, std::wstring_view new_text) noexcept;
+
+	// a change to a text: what had been [position, position + removed.length()) became inserted
+	struct text_edit {
+		uint32_t position = 0;
+		std::wstring removed;
+		std::wstring inserted;
+	};
+
+	// the content of an editable control; it also collects the net change made since take_edit was last called,
+	// so that undo can store just that change instead of a copy of the whole text. the text is kept in one piece
+	// because shaping and analysis read all of it after every edit
+	class editable_text_buffer {
+		std::wstring storage;
+
+		// the net change: [pending_position, pending_position + pending_inserted) of the current text replaced pending_removed
+		std::wstring pending_removed;
+		uint32_t pending_position = 0;
+		uint32_t pending_inserted = 0;
+		bool has_pending = false;
+	public:
+		uint32_t length() const noexcept {
+			return uint32_t(storage.length());
+		}
+		wchar_t operator[](uint32_t position) const noexcept {
+			return storage[position];
+		}
+		// replaces [start, end) with the content; positions past the end are treated as the end
+		void replace(uint32_t start, uint32_t end, std::wstring_view content);
+		void assign(std::wstring_view content) {
+			replace(0, length(), content);
+		}
+		// valid only until the next edit
+		std::wstring_view view() const noexcept {
+			return storage;
+		}
+		std::wstring substr(uint32_t start, uint32_t count) const;
+		std::wstring to_string() const {
+			return storage;
+		}
+
+		bool has_edit() const noexcept;
+		// returns the change made by the edits since the last call, and starts collecting again
+		text_edit take_edit();
+	};
+
+	// what segmentation found out about a utf16 code unit: the stops uniscribe's SCRIPT_LOGATTR provides, plus the bidi level
+	struct logical_attributes {
+		static constexpr uint8_t char_stop = 0x01; // a grapheme cluster, and so a cursor position, starts here
+		static constexpr uint8_t word_stop = 0x02; // a word starts here
+		static constexpr uint8_t soft_break = 0x04; // a line may be broken before this
+		static constexpr uint8_t white_space = 0x08;
+		static constexpr uint8_t numeric_word_stop = 0x10; // the word stop is there only because a numeric run starts or ends here
+
+		uint8_t flags = 0;
+		uint8_t bidi_level = 0;
+	};
+
+	// fills out with the attributes of each code unit of the text, which must consist of whole paragraphs: the stops
+	// follow UAX #29 and the levels UAX #9 at the given paragraph level; soft breaks are placed only after white space,
+	// rather than by the full UAX #14 rules. arabic_number_context makes european digits that have no strong character
+	// before them into arabic numbers, as uniscribe's fArabicNumContext does
+	void segment_text(logical_attributes* out, std::wstring_view text, bool ltr, bool arabic_number_context);
+
+	struct bidi_run {
+		uint32_t start = 0;
+		uint32_t end = 0;
+		uint8_t level = 0;
+	};
+	// the runs of same-level text among count attributes, from left to right in visual order (rule L2 of UAX #9)
+	std::vector<bidi_run> visual_runs(logical_attributes const* attributes, uint32_t count);
+
+	// appends the utf8 input to the utf16 output; malformed sequences become U+FFFD
+	void append_utf8_as_utf16(std::wstring& out, std::string_view in);
+}
+
+#endif
@@ -8,9 +8,9 @@
 #define WIN32_LEAN_AND_MEAN
 
 #include "printui_datatypes.hpp"
+#include "printui_text_data_definitions.hpp"
 
 #include <msctf.h>
-#include <usp10.h>
 #include <dwrite_3.h>
 #include <variant>
 
@@ -19,32 +19,6 @@ namespace printui {
 }
 
 namespace printui::text {
-	struct format_marker;
-
-	enum class extra_formatting : uint8_t {
-		none, small_caps, italic, old_numbers, tabular_numbers, bold, superscript, subscript
-	};
-	struct font_id {
-		uint8_t id = 0;
-	};
-	struct parameter_id {
-		uint8_t id = 0;
-	};
-	struct substitution_mark {
-		uint8_t id = 0;
-	};
-
-	using formatting_content = std::variant<std::monostate, font_id, parameter_id, substitution_mark, extra_formatting>;
-
-	struct format_marker {
-		uint16_t position;
-		formatting_content format;
-
-		bool operator<(const format_marker& o) const noexcept {
-			return position < o.position;
-		}
-	};
-
 	struct arranged_text;
 	struct text_format_ptr;
 
@@ -53,12 +27,6 @@ namespace printui::text {
 		float baseline;
 	};
 
-	struct arrangement_result {
-		arranged_text* ptr = nullptr;
-		int32_t width_used = 0;
-		int32_t lines_used = 0;
-	};
-
 
 	struct text_metrics {
 		uint32_t textPosition;
@@ -91,9 +59,19 @@ namespace printui::text {
 		IDWriteRenderingParams3* common_text_params = nullptr;
 		IDWriteRenderingParams3* small_text_params = nullptr;
 		IDWriteRenderingParams3* header_text_params = nullptr;
+
+		uint32_t font_generation = 0; // changes whenever the fonts are reinitialized, which makes every arrangement stale
+		mutable arrangement_cache arrangements{ retain_arranged_text, release_arranged_text };
+		mutable std::mutex arrangement_lock; // create_text_arragement configures the shared text formats before using them
 	public:
+		// a single worker: create_text_arragement holds arrangement_lock throughout, so more would only wait on each other
+		background_queue arrangement_jobs{ 1 };
+		bool asynchronous_arrangement = true; // text re-arranged after a locale or font change is arranged by arrangement_jobs
+
 		direct_write_text();
 		virtual ~direct_write_text() {
+			arrangement_jobs.cancel_pending();
+			arrangements.clear();
 			safe_release(common_text_params);
 			safe_release(small_text_params);
 			safe_release(header_text_params);
@@ -111,6 +89,13 @@ namespace printui::text {
 		void initialize_font_fallbacks(window_data& win);
 		void create_font_collection(window_data& win);
 		arrangement_result create_text_arragement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting = nullptr) const;
+		// as above, but an identical arrangement made earlier is shared rather than made again; the result must not be modified
+		// a region other than -1, -1 makes an arrangement fitted to that region, as adjust_layout_region would
+		arrangement_result shared_text_arrangement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting = nullptr, screen_space_point region = screen_space_point{ -1, -1 }) const;
+		// the current arrangement, made for the from region, fitted to the to region instead: an arrangement cached for the
+		// new region is shared if there is one, otherwise the current one is adjusted in place if no one else was given it
+		arrangement_result refit_text_arrangement(window_data const& win, std::wstring_view text, content_alignment text_alignment, text_size text_sz, bool single_line, int32_t max_width, std::vector<format_marker> const* formatting, arrangement_result current, screen_space_point from, screen_space_point to) const;
+		arrangement_cache_counters arrangement_cache_statistics() const;
 		text_format create_text_format(window_data const& win, wchar_t const* name, int32_t capheight, bool italic, float stretch, int32_t weight, int32_t top_lead, int32_t bottom_lead) const;
 		void release_text_format(text_format fmt) const;
 		void* to_dwrite_format(text_format fmt) const;
@@ -0,0 +1,322 @@
+#include "printui_text_data_definitions.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+
+namespace printui::text {
+	namespace {
+		constexpr char digit_pairs[] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		// writes the digits of v so that they end at end, two at a time; returns where they begin
+		char* write_digits_backwards(char* end, uint64_t v) {
+			while(v >= 100) {
+				auto const pair = (v % 100) * 2;
+				v /= 100;
+				end -= 2;
+				end[0] = digit_pairs[pair];
+				end[1] = digit_pairs[pair + 1];
+			}
+			if(v >= 10) {
+				end -= 2;
+				end[0] = digit_pairs[v * 2];
+				end[1] = digit_pairs[v * 2 + 1];
+			} else {
+				--end;
+				end[0] = char('0' + v);
+			}
+			return end;
+		}
+
+		struct grouping_rule {
+			uint8_t sizes[10] = {};
+			uint32_t count = 0;
+			bool repeat_last = true;
+
+			explicit grouping_rule(uint32_t grouping) {
+				char digits[10];
+				auto end = std::to_chars(digits, digits + sizeof(digits), grouping).ptr;
+				if(end[-1] == '0') {
+					repeat_last = false;
+					--end;
+				}
+				for(auto d = digits; d != end; ++d) {
+					if(*d != '0')
+						sizes[count++] = uint8_t(*d - '0');
+				}
+			}
+			// whether a separator goes between the digits with digits_right digits to their right
+			bool separates(uint32_t digits_right) const {
+				uint32_t total = 0;
+				for(uint32_t i = 0; i < count; ++i) {
+					total += sizes[i];
+					if(total >= digits_right)
+						return total == digits_right;
+				}
+				return repeat_last && count != 0 && (digits_right - total) % sizes[count - 1] == 0;
+			}
+		};
+
+		void append_ascii(std::wstring& out, char const* start, char const* end) {
+			for(; start != end; ++start) {
+				out.push_back(wchar_t(*start));
+			}
+		}
+
+		// the digits are modified in place by rounding, so integer_start must have a spare character before it
+		void append_number(std::wstring& out, bool negative, char* integer_start, char* integer_end, char const* fraction_start, char const* fraction_end, uint32_t decimal_places, number_format const& fmt) {
+			auto const fraction_available = uint32_t(fraction_end - fraction_start);
+			bool round_up = fraction_available > decimal_places && fraction_start[decimal_places] >= '5';
+
+			// rounding may carry through the fraction into the integer digits, so the kept fraction digits are copied out first
+			char fraction[16];
+			auto const fraction_kept = std::min(std::min(fraction_available, decimal_places), uint32_t(sizeof(fraction)));
+			std::copy(fraction_start, fraction_start + fraction_kept, fraction);
+			for(uint32_t i = fraction_kept; round_up && i-- > 0; ) {
+				if(fraction[i] == '9') {
+					fraction[i] = '0';
+				} else {
+					++fraction[i];
+					round_up = false;
+				}
+			}
+			for(auto d = integer_end; round_up && d-- != integer_start; ) {
+				if(*d == '9') {
+					*d = '0';
+				} else {
+					++(*d);
+					round_up = false;
+				}
+			}
+			if(round_up) {
+				--integer_start;
+				*integer_start = '1';
+			}
+			while(integer_end - integer_start > 1 && *integer_start == '0') {
+				++integer_start;
+			}
+
+			// a value that rounds to zero is not written as negative
+			if(negative) {
+				negative = !(integer_end - integer_start == 1 && *integer_start == '0') || std::any_of(fraction, fraction + fraction_kept, [](char c) { return c != '0'; });
+			}
+
+			if(negative) {
+				if(fmt.negative_order == 0) {
+					out.push_back(L'(');
+				} else if(fmt.negative_order == 1) {
+					out.append(fmt.negative_sign);
+				} else if(fmt.negative_order == 2) {
+					out.append(fmt.negative_sign);
+					out.push_back(L' ');
+				}
+			}
+
+			auto const integer_count = uint32_t(integer_end - integer_start);
+			if(!(decimal_places != 0 && fmt.leading_zero == 0 && integer_count == 1 && *integer_start == '0')) {
+				grouping_rule const groups(fmt.grouping);
+				for(uint32_t i = 0; i < integer_count; ++i) {
+					out.push_back(wchar_t(integer_start[i]));
+					if(i + 1 != integer_count && groups.separates(integer_count - i - 1))
+						out.append(fmt.thousand_separator);
+				}
+			}
+
+			if(decimal_places != 0) {
+				out.append(fmt.decimal_separator);
+				append_ascii(out, fraction, fraction + fraction_kept);
+				out.append(decimal_places - fraction_kept, L'0');
+			}
+
+			if(negative) {
+				if(fmt.negative_order == 0) {
+					out.push_back(L')');
+				} else if(fmt.negative_order == 3) {
+					out.append(fmt.negative_sign);
+				} else if(fmt.negative_order == 4) {
+					out.push_back(L' ');
+					out.append(fmt.negative_sign);
+				}
+			}
+		}
+
+		bool is_blank(wchar_t c) {
+			return c == L' ' || c == L'\t' || c == 0x00A0 || c == 0x202F;
+		}
+		bool starts_with(std::wstring_view text, wchar_t const* prefix) {
+			auto const prefix_view = std::wstring_view(prefix);
+			return prefix_view.length() != 0 && text.substr(0, prefix_view.length()) == prefix_view;
+		}
+		bool ends_with(std::wstring_view text, wchar_t const* suffix) {
+			auto const suffix_view = std::wstring_view(suffix);
+			return suffix_view.length() != 0 && text.length() >= suffix_view.length() && text.substr(text.length() - suffix_view.length()) == suffix_view;
+		}
+		std::wstring_view trim_blanks(std::wstring_view text) {
+			while(text.length() != 0 && is_blank(text.front()))
+				text.remove_prefix(1);
+			while(text.length() != 0 && is_blank(text.back()))
+				text.remove_suffix(1);
+			return text;
+		}
+
+		struct normalized_number {
+			char characters[400];
+			uint32_t length = 0;
+			bool is_integral = true;
+		};
+
+		// rewrites the number in the form from_chars accepts: separators removed, the decimal separator as '.', and any sign as a leading '-'
+		bool normalize_number(std::wstring_view text, number_format const& fmt, bool allow_exponent, normalized_number& out) {
+			text = trim_blanks(text);
+
+			bool negative = false;
+			if(text.length() >= 2 && text.front() == L'(' && text.back() == L')') {
+				negative = true;
+				text = trim_blanks(text.substr(1, text.length() - 2));
+			} else if(starts_with(text, fmt.negative_sign)) {
+				negative = true;
+				text = trim_blanks(text.substr(std::wstring_view(fmt.negative_sign).length()));
+			} else if(text.length() != 0 && (text.front() == L'-' || text.front() == 0x2212)) {
+				negative = true;
+				text = trim_blanks(text.substr(1));
+			} else if(text.length() != 0 && text.front() == L'+') {
+				text = trim_blanks(text.substr(1));
+			} else if(ends_with(text, fmt.negative_sign)) {
+				negative = true;
+				text = trim_blanks(text.substr(0, text.length() - std::wstring_view(fmt.negative_sign).length()));
+			} else if(text.length() != 0 && (text.back() == L'-' || text.back() == 0x2212)) {
+				negative = true;
+				text = trim_blanks(text.substr(0, text.length() - 1));
+			}
+
+			auto push = [&](char c) {
+				if(out.length == sizeof(out.characters))
+					return false;
+				out.characters[out.length++] = c;
+				return true;
+			};
+
+			if(negative)
+				push('-');
+
+			auto const decimal_length = std::wstring_view(fmt.decimal_separator).length();
+			auto const thousand_length = std::wstring_view(fmt.thousand_separator).length();
+			bool const blank_separator = thousand_length == 1 && is_blank(fmt.thousand_separator[0]);
+
+			bool any_digits = false;
+			bool in_fraction = false;
+			while(text.length() != 0) {
+				auto const c = text.front();
+				if(c >= L'0' && c <= L'9') {
+					if(!push(char(c)))
+						return false;
+					any_digits = true;
+					text.remove_prefix(1);
+				} else if(!in_fraction && starts_with(text, fmt.decimal_separator)) {
+					if(!push('.'))
+						return false;
+					in_fraction = true;
+					out.is_integral = false;
+					text.remove_prefix(decimal_length);
+				} else if(!in_fraction && starts_with(text, fmt.thousand_separator)) {
+					text.remove_prefix(thousand_length);
+				} else if(!in_fraction && blank_separator && is_blank(c)) {
+					// typed text often has an ordinary space where the locale uses a non-breaking one
+					text.remove_prefix(1);
+				} else if(allow_exponent && any_digits && (c == L'e' || c == L'E')) {
+					out.is_integral = false;
+					break;
+				} else {
+					return false;
+				}
+			}
+			if(!any_digits)
+				return false;
+
+			if(text.length() != 0) { // the exponent
+				push('e');
+				text.remove_prefix(1);
+				if(text.length() != 0 && (text.front() == L'-' || text.front() == L'+')) {
+					push(char(text.front()));
+					text.remove_prefix(1);
+				}
+				if(text.length() == 0)
+					return false;
+				for(auto c : text) {
+					if(c < L'0' || c > L'9' || !push(char(c)))
+						return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	void append_formatted_integer(std::wstring& out, int64_t value, uint32_t decimal_places, number_format const& fmt) {
+		char digits[24];
+		auto const end = digits + sizeof(digits);
+		auto const magnitude = value < 0 ? uint64_t(0) - uint64_t(value) : uint64_t(value);
+		auto const start = write_digits_backwards(end, magnitude);
+		append_number(out, value < 0, start, end, end, end, decimal_places, fmt);
+	}
+
+	void append_formatted_decimal(std::wstring& out, double value, uint32_t decimal_places, number_format const& fmt) {
+		// the largest double has 309 integer digits; digits[0] is left free for a carry out of the rounding
+		char digits[330];
+		auto const result = std::to_chars(digits + 1, digits + sizeof(digits), value, std::chars_format::fixed, 6);
+		if(result.ec != std::errc{})
+			return;
+
+		auto integer_start = digits + 1;
+		bool const negative = *integer_start == '-';
+		if(negative)
+			++integer_start;
+		auto const point = std::find(integer_start, result.ptr, '.');
+		append_number(out, negative, integer_start, point, point == result.ptr ? point : point + 1, result.ptr, decimal_places, fmt);
+	}
+
+	double parse_formatted_decimal(std::wstring_view text, number_format const& fmt) {
+		normalized_number n;
+		if(!normalize_number(text, fmt, true, n))
+			return 0.0;
+
+		double result = 0.0;
+		auto const r = std::from_chars(n.characters, n.characters + n.length, result);
+		if(r.ec != std::errc{} || r.ptr != n.characters + n.length)
+			return 0.0;
+		return result;
+	}
+
+	int64_t parse_formatted_integer(std::wstring_view text, number_format const& fmt) {
+		normalized_number n;
+		if(!normalize_number(text, fmt, true, n))
+			return 0;
+
+		if(n.is_integral) {
+			int64_t result = 0;
+			auto const r = std::from_chars(n.characters, n.characters + n.length, result);
+			if(r.ec != std::errc{} || r.ptr != n.characters + n.length)
+				return 0;
+			return result;
+		}
+
+		double result = 0.0;
+		auto const r = std::from_chars(n.characters, n.characters + n.length, result);
+		if(r.ec != std::errc{} || r.ptr != n.characters + n.length)
+			return 0;
+		// as VarI8FromStr does, halves round to even
+		result = std::nearbyint(result);
+		if(!(result >= -9223372036854775808.0 && result < 9223372036854775808.0))
+			return 0;
+		return int64_t(result);
+	}
+}
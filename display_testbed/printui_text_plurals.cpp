@@ -0,0 +1,32 @@
+#include "printui_text_data_definitions.hpp"
+#include "printui_plural_rules.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace printui::text {
+	namespace {
+		using plural_rules::cardinal_rule;
+		using plural_rules::ordinal_rule;
+		using plural_rules::cardinal_rules;
+		using plural_rules::ordinal_rules;
+
+		static_assert(std::is_sorted(std::begin(cardinal_rules), std::end(cardinal_rules), [](cardinal_rule const& a, cardinal_rule const& b) { return a.locale < b.locale; }));
+		static_assert(std::is_sorted(std::begin(ordinal_rules), std::end(ordinal_rules), [](ordinal_rule const& a, ordinal_rule const& b) { return a.locale < b.locale; }));
+
+		template<typename T, size_t N>
+		auto find_rule(T const (&rules)[N], std::wstring_view locale) -> decltype(rules[0].fn) {
+			auto it = std::lower_bound(std::begin(rules), std::end(rules), locale, [](T const& r, std::wstring_view l) { return r.locale < l; });
+			if(it != std::end(rules) && it->locale == locale)
+				return it->fn;
+			return nullptr;
+		}
+	}
+
+	cardinal_plural_fn find_cardinal_plural_rule(std::wstring_view locale) {
+		return find_rule(cardinal_rules, locale);
+	}
+	ordinal_plural_fn find_ordinal_plural_rule(std::wstring_view locale) {
+		return find_rule(ordinal_rules, locale);
+	}
+}
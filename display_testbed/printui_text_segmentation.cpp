@@ -0,0 +1,731 @@
+#include "printui_text_data_definitions.hpp"
+#include "printui_unicode_tables.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define PRINTUI_SEGMENTATION_SSE2
+#endif
+
+namespace printui::text {
+	namespace {
+		using unicode::bidi_class;
+		using unicode::word_break;
+		using unicode::grapheme_break;
+
+		uint16_t unicode_record(uint32_t c) noexcept {
+			if(c >= 0x110000)
+				c = 0xFFFD;
+			return unicode::records[unicode::blocks[uint32_t(unicode::block_of[c >> unicode::block_shift]) * unicode::block_size + (c & (unicode::block_size - 1))]];
+		}
+		bidi_class record_bidi_class(uint16_t r) noexcept {
+			return bidi_class(r & 0x1F);
+		}
+		word_break record_word_break(uint16_t r) noexcept {
+			return word_break((r >> 5) & 0x1F);
+		}
+		grapheme_break record_grapheme_break(uint16_t r) noexcept {
+			return grapheme_break((r >> 10) & 0x0F);
+		}
+		bool record_is_pictographic(uint16_t r) noexcept {
+			return (r & 0x4000) != 0;
+		}
+		bool record_is_white_space(uint16_t r) noexcept {
+			return (r & 0x8000) != 0;
+		}
+
+		// the number of code units at the start of the text that are all below 0x100
+		size_t latin1_prefix(std::wstring_view text) noexcept {
+			size_t i = 0;
+#ifdef PRINTUI_SEGMENTATION_SSE2
+			constexpr size_t per_vector = 16 / sizeof(wchar_t);
+			__m128i const high_bits = sizeof(wchar_t) == 2 ? _mm_set1_epi16(int16_t(0xFF00)) : _mm_set1_epi32(int32_t(0xFFFFFF00));
+			__m128i const zero = _mm_setzero_si128();
+			for(; i + per_vector <= text.length(); i += per_vector) {
+				auto v = _mm_and_si128(_mm_loadu_si128((__m128i const*)(text.data() + i)), high_bits);
+				auto is_latin1 = uint32_t(_mm_movemask_epi8(sizeof(wchar_t) == 2 ? _mm_cmpeq_epi16(v, zero) : _mm_cmpeq_epi32(v, zero)));
+				if(is_latin1 != 0xFFFF)
+					return i + size_t(std::countr_one(is_latin1)) / sizeof(wchar_t);
+			}
+#endif
+			while(i < text.length() && uint32_t(text[i]) < 0x100)
+				++i;
+			return i;
+		}
+
+		// a codepoint of the text being segmented
+		struct segmented_char {
+			uint32_t codepoint = 0;
+			uint32_t unit = 0; // its first code unit
+			uint16_t record = 0;
+		};
+
+		void decode_for_segmentation(std::vector<segmented_char>& out, std::wstring_view text) {
+			out.clear();
+			out.reserve(text.length());
+			for(uint32_t i = 0; i < uint32_t(text.length()); ++i) {
+				uint32_t c = uint32_t(text[i]) & 0xFFFF;
+				auto const first = i;
+				if(is_high_surrogate(uint16_t(c)) && i + 1 < uint32_t(text.length()) && is_low_surrogate(uint16_t(text[i + 1]))) {
+					c = assemble_codepoint(uint16_t(c), uint16_t(text[i + 1]));
+					++i;
+				}
+				out.push_back(segmented_char{ c, first, unicode_record(c) });
+			}
+		}
+
+		// UAX #29 extended grapheme clusters; sets char_stop where one starts
+		void mark_grapheme_stops(logical_attributes* out, std::vector<segmented_char> const& chars) {
+			uint32_t regional_indicators = 0; // how many immediately precede the current character
+			bool in_pictographic = false; // whether the text so far ends in Extended_Pictographic Extend*
+			bool zwj_after_pictographic = false;
+
+			for(size_t k = 0; k < chars.size(); ++k) {
+				auto const b = record_grapheme_break(chars[k].record);
+				bool stop = true;
+				if(k != 0) {
+					auto const a = record_grapheme_break(chars[k - 1].record);
+					if(a == grapheme_break::cr && b == grapheme_break::lf) // GB3
+						stop = false;
+					else if(a == grapheme_break::cr || a == grapheme_break::lf || a == grapheme_break::control) // GB4
+						stop = true;
+					else if(b == grapheme_break::cr || b == grapheme_break::lf || b == grapheme_break::control) // GB5
+						stop = true;
+					else if(a == grapheme_break::l && (b == grapheme_break::l || b == grapheme_break::v || b == grapheme_break::lv || b == grapheme_break::lvt)) // GB6
+						stop = false;
+					else if((a == grapheme_break::lv || a == grapheme_break::v) && (b == grapheme_break::v || b == grapheme_break::t)) // GB7
+						stop = false;
+					else if((a == grapheme_break::lvt || a == grapheme_break::t) && b == grapheme_break::t) // GB8
+						stop = false;
+					else if(b == grapheme_break::extend || b == grapheme_break::zwj || b == grapheme_break::spacingmark || a == grapheme_break::prepend) // GB9, GB9a, GB9b
+						stop = false;
+					else if(zwj_after_pictographic && record_is_pictographic(chars[k].record)) // GB11
+						stop = false;
+					else if(a == grapheme_break::regional_indicator && b == grapheme_break::regional_indicator && (regional_indicators & 1) != 0) // GB12, GB13
+						stop = false;
+				}
+				if(stop)
+					out[chars[k].unit].flags |= logical_attributes::char_stop;
+
+				regional_indicators = b == grapheme_break::regional_indicator ? regional_indicators + 1 : 0;
+				zwj_after_pictographic = b == grapheme_break::zwj && in_pictographic;
+				in_pictographic = record_is_pictographic(chars[k].record) || (b == grapheme_break::extend && in_pictographic);
+			}
+		}
+
+		bool word_break_ignored(word_break w) noexcept {
+			return w == word_break::extend || w == word_break::format || w == word_break::zwj;
+		}
+		bool word_break_newline(word_break w) noexcept {
+			return w == word_break::newline || w == word_break::cr || w == word_break::lf;
+		}
+		bool word_break_letter(word_break w) noexcept {
+			return w == word_break::aletter || w == word_break::hebrew_letter;
+		}
+		bool word_break_mid_letter(word_break w) noexcept {
+			return w == word_break::midletter || w == word_break::midnumlet || w == word_break::single_quote;
+		}
+		bool word_break_mid_number(word_break w) noexcept {
+			return w == word_break::midnum || w == word_break::midnumlet || w == word_break::single_quote;
+		}
+
+		// UAX #29 word boundaries; sets word_stop where a word that is not just white space starts
+		void mark_word_stops(logical_attributes* out, std::vector<segmented_char> const& chars) {
+			auto const n = int32_t(chars.size());
+			auto wb = [&](int32_t k) { return record_word_break(chars[k].record); };
+			// rule WB4: extend, format and zwj belong to the character before them, unless that is the start of the text or a newline
+			auto attached_to = [&](int32_t k) {
+				while(k > 0 && word_break_ignored(wb(k)) && !word_break_newline(wb(k - 1)))
+					--k;
+				return k;
+			};
+			constexpr auto none = word_break(0xFF);
+
+			for(int32_t k = 0; k < n; ++k) {
+				auto const b = wb(k);
+				bool boundary = true;
+				if(k != 0) {
+					auto const a = wb(k - 1);
+					if(a == word_break::cr && b == word_break::lf) { // WB3
+						boundary = false;
+					} else if(word_break_newline(a) || word_break_newline(b)) { // WB3a, WB3b
+						boundary = true;
+					} else if(a == word_break::zwj && record_is_pictographic(chars[k].record)) { // WB3c
+						boundary = false;
+					} else if(a == word_break::wsegspace && b == word_break::wsegspace) { // WB3d
+						boundary = false;
+					} else if(word_break_ignored(b)) { // WB4
+						boundary = false;
+					} else {
+						auto const p = attached_to(k - 1);
+						auto const a1 = wb(p);
+						// the classes either side of a1 and b are only needed by a few of the rules
+						auto a2 = [&]() {
+							return p > 0 ? wb(attached_to(p - 1)) : none;
+						};
+						auto c = [&]() {
+							for(int32_t r = k + 1; r < n; ++r) {
+								if(!word_break_ignored(wb(r)))
+									return wb(r);
+							}
+							return none;
+						};
+
+						if(word_break_letter(a1) && word_break_letter(b)) // WB5
+							boundary = false;
+						else if(word_break_letter(a1) && word_break_mid_letter(b) && word_break_letter(c())) // WB6
+							boundary = false;
+						else if(word_break_mid_letter(a1) && word_break_letter(b) && word_break_letter(a2())) // WB7
+							boundary = false;
+						else if(a1 == word_break::hebrew_letter && b == word_break::single_quote) // WB7a
+							boundary = false;
+						else if(a1 == word_break::hebrew_letter && b == word_break::double_quote && c() == word_break::hebrew_letter) // WB7b
+							boundary = false;
+						else if(a1 == word_break::double_quote && b == word_break::hebrew_letter && a2() == word_break::hebrew_letter) // WB7c
+							boundary = false;
+						else if((a1 == word_break::numeric || word_break_letter(a1)) && b == word_break::numeric) // WB8, WB9
+							boundary = false;
+						else if(a1 == word_break::numeric && word_break_letter(b)) // WB10
+							boundary = false;
+						else if(word_break_mid_number(a1) && b == word_break::numeric && a2() == word_break::numeric) // WB11
+							boundary = false;
+						else if(a1 == word_break::numeric && word_break_mid_number(b) && c() == word_break::numeric) // WB12
+							boundary = false;
+						else if(a1 == word_break::katakana && b == word_break::katakana) // WB13
+							boundary = false;
+						else if((word_break_letter(a1) || a1 == word_break::numeric || a1 == word_break::katakana || a1 == word_break::extendnumlet) && b == word_break::extendnumlet) // WB13a
+							boundary = false;
+						else if(a1 == word_break::extendnumlet && (word_break_letter(b) || b == word_break::numeric || b == word_break::katakana)) // WB13b
+							boundary = false;
+						else if(a1 == word_break::regional_indicator && b == word_break::regional_indicator) { // WB15, WB16
+							int32_t preceding = 0;
+							for(int32_t q = p; q >= 0 && wb(q) == word_break::regional_indicator; q = q > 0 ? attached_to(q - 1) : -1)
+								++preceding;
+							boundary = (preceding & 1) == 0;
+						}
+					}
+				}
+				if(boundary && !record_is_white_space(chars[k].record))
+					out[chars[k].unit].flags |= logical_attributes::word_stop;
+			}
+		}
+
+		bool is_isolate_initiator(bidi_class t) noexcept {
+			return t == bidi_class::lri || t == bidi_class::rli || t == bidi_class::fsi;
+		}
+		bool removed_by_x9(bidi_class t) noexcept {
+			return t == bidi_class::rle || t == bidi_class::lre || t == bidi_class::rlo || t == bidi_class::lro || t == bidi_class::pdf || t == bidi_class::bn;
+		}
+		bool is_neutral_or_isolate(bidi_class t) noexcept {
+			return t == bidi_class::b || t == bidi_class::s || t == bidi_class::ws || t == bidi_class::on
+				|| t == bidi_class::lri || t == bidi_class::rli || t == bidi_class::fsi || t == bidi_class::pdi;
+		}
+		// for N0 and N1, numbers count as right to left
+		bidi_class strong_direction(bidi_class t) noexcept {
+			if(t == bidi_class::l)
+				return bidi_class::l;
+			if(t == bidi_class::r || t == bidi_class::al || t == bidi_class::en || t == bidi_class::an)
+				return bidi_class::r;
+			return bidi_class::on;
+		}
+
+		uint32_t canonical_bracket(uint32_t c) noexcept {
+			if(c == 0x2329)
+				return 0x3008;
+			if(c == 0x232A)
+				return 0x3009;
+			return c;
+		}
+		unicode::paired_bracket const* find_bracket(uint32_t c) noexcept {
+			auto it = std::lower_bound(std::begin(unicode::paired_brackets), std::end(unicode::paired_brackets), c,
+				[](unicode::paired_bracket const& b, uint32_t v) { return b.codepoint < v; });
+			if(it != std::end(unicode::paired_brackets) && it->codepoint == c)
+				return it;
+			return nullptr;
+		}
+
+		// resolves the levels of a single paragraph, following UAX #9
+		class bidi_resolver {
+			std::vector<segmented_char> const& chars;
+			uint32_t first;
+			uint32_t last;
+			uint8_t paragraph_level;
+			bool arabic_number_context;
+
+			std::vector<bidi_class> original; // X9 and the N rules look at the classes before anything was resolved
+			std::vector<bidi_class> types;
+			std::vector<uint8_t> levels;
+			std::vector<uint8_t> embedding_levels; // the levels from X1 to X8, which sos and eos are based on
+			std::vector<uint32_t> matching_pdi; // for isolate initiators, the index of their pdi or n if there is none
+			std::vector<bool> has_initiator; // for pdis
+
+			uint32_t size() const {
+				return last - first;
+			}
+			uint32_t codepoint(uint32_t i) const {
+				return chars[first + i].codepoint;
+			}
+
+			// rule P2 applied to [from, to), skipping isolates
+			bool first_strong_is_rtl(uint32_t from, uint32_t to) const {
+				for(uint32_t i = from; i < to; ++i) {
+					if(original[i] == bidi_class::l)
+						return false;
+					if(original[i] == bidi_class::r || original[i] == bidi_class::al)
+						return true;
+					if(is_isolate_initiator(original[i]))
+						i = matching_pdi[i];
+				}
+				return false;
+			}
+
+			void match_isolates() {
+				matching_pdi.assign(size(), size());
+				has_initiator.assign(size(), false);
+				std::vector<uint32_t> open;
+				for(uint32_t i = 0; i < size(); ++i) {
+					if(is_isolate_initiator(original[i])) {
+						open.push_back(i);
+					} else if(original[i] == bidi_class::pdi && !open.empty()) {
+						matching_pdi[open.back()] = i;
+						has_initiator[i] = true;
+						open.pop_back();
+					}
+				}
+			}
+
+			// rules X1 to X8
+			void resolve_explicit_levels() {
+				struct directional_status {
+					uint8_t level;
+					bidi_class override_status;
+					bool isolate;
+				};
+				constexpr uint8_t max_depth = 125;
+
+				std::vector<directional_status> stack;
+				stack.reserve(max_depth + 2);
+				stack.push_back(directional_status{ paragraph_level, bidi_class::on, false });
+				uint32_t overflow_isolates = 0;
+				uint32_t overflow_embeddings = 0;
+				uint32_t valid_isolates = 0;
+
+				auto apply_override = [&](uint32_t i) {
+					levels[i] = stack.back().level;
+					if(stack.back().override_status != bidi_class::on)
+						types[i] = stack.back().override_status;
+				};
+
+				for(uint32_t i = 0; i < size(); ++i) {
+					auto const t = original[i];
+					switch(t) {
+						case bidi_class::rle:
+						case bidi_class::lre:
+						case bidi_class::rlo:
+						case bidi_class::lro:
+						{
+							levels[i] = stack.back().level;
+							bool const rtl = t == bidi_class::rle || t == bidi_class::rlo;
+							auto const level = uint8_t(rtl ? ((stack.back().level + 1) | 1) : ((stack.back().level + 2) & ~1));
+							if(level <= max_depth && overflow_isolates == 0 && overflow_embeddings == 0) {
+								stack.push_back(directional_status{ level, t == bidi_class::rlo ? bidi_class::r : (t == bidi_class::lro ? bidi_class::l : bidi_class::on), false });
+							} else if(overflow_isolates == 0) {
+								++overflow_embeddings;
+							}
+							break;
+						}
+						case bidi_class::rli:
+						case bidi_class::lri:
+						case bidi_class::fsi:
+						{
+							apply_override(i);
+							bool const rtl = t == bidi_class::rli || (t == bidi_class::fsi && first_strong_is_rtl(i + 1, matching_pdi[i]));
+							auto const level = uint8_t(rtl ? ((stack.back().level + 1) | 1) : ((stack.back().level + 2) & ~1));
+							if(level <= max_depth && overflow_isolates == 0 && overflow_embeddings == 0) {
+								++valid_isolates;
+								stack.push_back(directional_status{ level, bidi_class::on, true });
+							} else {
+								++overflow_isolates;
+							}
+							break;
+						}
+						case bidi_class::pdi:
+							if(overflow_isolates > 0) {
+								--overflow_isolates;
+							} else if(valid_isolates > 0) {
+								overflow_embeddings = 0;
+								while(!stack.back().isolate)
+									stack.pop_back();
+								stack.pop_back();
+								--valid_isolates;
+							}
+							apply_override(i);
+							break;
+						case bidi_class::pdf:
+							levels[i] = stack.back().level;
+							if(overflow_isolates > 0) {
+							} else if(overflow_embeddings > 0) {
+								--overflow_embeddings;
+							} else if(!stack.back().isolate && stack.size() >= 2) {
+								stack.pop_back();
+							}
+							break;
+						case bidi_class::b:
+							levels[i] = paragraph_level;
+							break;
+						case bidi_class::bn:
+							levels[i] = stack.back().level;
+							break;
+						default:
+							apply_override(i);
+							break;
+					}
+				}
+			}
+
+			// rules W1 to W7, N0 to N2 and I1 to I2 for one isolating run sequence
+			void resolve_sequence(std::vector<uint32_t> const& seq) {
+				auto const level = embedding_levels[seq.front()];
+
+				uint8_t level_before = paragraph_level;
+				for(auto j = seq.front(); j-- > 0; ) {
+					if(!removed_by_x9(original[j])) {
+						level_before = embedding_levels[j];
+						break;
+					}
+				}
+				uint8_t level_after = paragraph_level;
+				if(!is_isolate_initiator(original[seq.back()])) {
+					for(auto j = seq.back() + 1; j < size(); ++j) {
+						if(!removed_by_x9(original[j])) {
+							level_after = embedding_levels[j];
+							break;
+						}
+					}
+				}
+				auto const sos = (std::max(level, level_before) & 1) != 0 ? bidi_class::r : bidi_class::l;
+				auto const eos = (std::max(level, level_after) & 1) != 0 ? bidi_class::r : bidi_class::l;
+				auto const embedding = (level & 1) != 0 ? bidi_class::r : bidi_class::l;
+				auto const n = seq.size();
+				auto t = [&](size_t k) -> bidi_class& { return types[seq[k]]; };
+
+				// W1
+				for(size_t k = 0; k < n; ++k) {
+					if(t(k) == bidi_class::nsm) {
+						if(k == 0)
+							t(k) = sos;
+						else if(is_isolate_initiator(t(k - 1)) || t(k - 1) == bidi_class::pdi)
+							t(k) = bidi_class::on;
+						else
+							t(k) = t(k - 1);
+					}
+				}
+				// W2, W3
+				{
+					auto last_strong = sos;
+					bool at_start = true;
+					for(size_t k = 0; k < n; ++k) {
+						if(t(k) == bidi_class::l || t(k) == bidi_class::r || t(k) == bidi_class::al) {
+							last_strong = t(k);
+							at_start = false;
+						} else if(t(k) == bidi_class::en) {
+							if(last_strong == bidi_class::al || (at_start && arabic_number_context))
+								t(k) = bidi_class::an;
+						}
+					}
+					for(size_t k = 0; k < n; ++k) {
+						if(t(k) == bidi_class::al)
+							t(k) = bidi_class::r;
+					}
+				}
+				// W4
+				for(size_t k = 1; k + 1 < n; ++k) {
+					if(t(k) == bidi_class::es && t(k - 1) == bidi_class::en && t(k + 1) == bidi_class::en)
+						t(k) = bidi_class::en;
+					else if(t(k) == bidi_class::cs && t(k - 1) == bidi_class::en && t(k + 1) == bidi_class::en)
+						t(k) = bidi_class::en;
+					else if(t(k) == bidi_class::cs && t(k - 1) == bidi_class::an && t(k + 1) == bidi_class::an)
+						t(k) = bidi_class::an;
+				}
+				// W5
+				for(size_t k = 0; k < n; ) {
+					if(t(k) != bidi_class::et) {
+						++k;
+						continue;
+					}
+					auto run_end = k;
+					while(run_end < n && t(run_end) == bidi_class::et)
+						++run_end;
+					if((k > 0 && t(k - 1) == bidi_class::en) || (run_end < n && t(run_end) == bidi_class::en)) {
+						for(auto j = k; j < run_end; ++j)
+							t(j) = bidi_class::en;
+					}
+					k = run_end;
+				}
+				// W6, W7
+				{
+					auto last_strong = sos;
+					for(size_t k = 0; k < n; ++k) {
+						if(t(k) == bidi_class::es || t(k) == bidi_class::et || t(k) == bidi_class::cs)
+							t(k) = bidi_class::on;
+						if(t(k) == bidi_class::l || t(k) == bidi_class::r)
+							last_strong = t(k);
+						else if(t(k) == bidi_class::en && last_strong == bidi_class::l)
+							t(k) = bidi_class::l;
+					}
+				}
+				resolve_brackets(seq, sos, embedding);
+				// N1, N2
+				for(size_t k = 0; k < n; ) {
+					if(!is_neutral_or_isolate(t(k))) {
+						++k;
+						continue;
+					}
+					auto run_end = k;
+					while(run_end < n && is_neutral_or_isolate(t(run_end)))
+						++run_end;
+					auto const before = k > 0 ? strong_direction(t(k - 1)) : sos;
+					auto const after = run_end < n ? strong_direction(t(run_end)) : eos;
+					auto const resolved = before == after ? before : embedding;
+					for(auto j = k; j < run_end; ++j)
+						t(j) = resolved;
+					k = run_end;
+				}
+				// I1, I2
+				for(size_t k = 0; k < n; ++k) {
+					auto& l = levels[seq[k]];
+					if((l & 1) == 0) {
+						if(t(k) == bidi_class::r)
+							l += 1;
+						else if(t(k) == bidi_class::an || t(k) == bidi_class::en)
+							l += 2;
+					} else if(t(k) == bidi_class::l || t(k) == bidi_class::en || t(k) == bidi_class::an) {
+						l += 1;
+					}
+				}
+			}
+
+			// rule N0
+			void resolve_brackets(std::vector<uint32_t> const& seq, bidi_class sos, bidi_class embedding) {
+				struct bracket_pair {
+					size_t open;
+					size_t close;
+				};
+				struct open_bracket {
+					uint32_t closing;
+					size_t position;
+				};
+				constexpr size_t max_open = 63;
+
+				// BD16
+				std::vector<bracket_pair> pairs;
+				std::vector<open_bracket> open;
+				for(size_t k = 0; k < seq.size(); ++k) {
+					if(types[seq[k]] != bidi_class::on)
+						continue;
+					auto b = find_bracket(codepoint(seq[k]));
+					if(!b)
+						continue;
+					if(b->opening) {
+						if(open.size() == max_open)
+							break;
+						open.push_back(open_bracket{ canonical_bracket(b->pair), k });
+					} else {
+						auto const c = canonical_bracket(b->codepoint);
+						for(size_t d = open.size(); d-- > 0; ) {
+							if(open[d].closing == c) {
+								pairs.push_back(bracket_pair{ open[d].position, k });
+								open.resize(d);
+								break;
+							}
+						}
+					}
+				}
+				if(pairs.empty())
+					return;
+				std::sort(pairs.begin(), pairs.end(), [](bracket_pair const& a, bracket_pair const& b) { return a.open < b.open; });
+
+				auto set_bracket = [&](size_t k, bidi_class direction) {
+					types[seq[k]] = direction;
+					for(auto j = k + 1; j < seq.size() && original[seq[j]] == bidi_class::nsm; ++j)
+						types[seq[j]] = direction;
+				};
+				auto const opposite = embedding == bidi_class::l ? bidi_class::r : bidi_class::l;
+				for(auto const& p : pairs) {
+					bool found_embedding = false;
+					bool found_opposite = false;
+					for(auto k = p.open + 1; k < p.close; ++k) {
+						auto const d = strong_direction(types[seq[k]]);
+						if(d == embedding)
+							found_embedding = true;
+						else if(d == opposite)
+							found_opposite = true;
+					}
+					if(found_embedding) {
+						set_bracket(p.open, embedding);
+						set_bracket(p.close, embedding);
+					} else if(found_opposite) {
+						auto context = sos;
+						for(auto k = p.open; k-- > 0; ) {
+							auto const d = strong_direction(types[seq[k]]);
+							if(d != bidi_class::on) {
+								context = d;
+								break;
+							}
+						}
+						auto const direction = context == opposite ? opposite : embedding;
+						set_bracket(p.open, direction);
+						set_bracket(p.close, direction);
+					}
+				}
+			}
+
+			// rule X10: level runs are joined into isolating run sequences where an isolate initiator is matched by a pdi
+			void resolve_implicit_levels() {
+				std::vector<std::vector<uint32_t>> runs;
+				std::vector<uint32_t> run_of(size(), 0);
+				for(uint32_t i = 0; i < size(); ++i) {
+					if(removed_by_x9(original[i]))
+						continue;
+					if(runs.empty() || levels[runs.back().back()] != levels[i])
+						runs.emplace_back();
+					runs.back().push_back(i);
+					run_of[i] = uint32_t(runs.size() - 1);
+				}
+
+				std::vector<uint32_t> seq;
+				for(auto const& run : runs) {
+					if(original[run.front()] == bidi_class::pdi && has_initiator[run.front()])
+						continue;
+					seq = run;
+					while(is_isolate_initiator(original[seq.back()]) && matching_pdi[seq.back()] < size()) {
+						auto const& next = runs[run_of[matching_pdi[seq.back()]]];
+						seq.insert(seq.end(), next.begin(), next.end());
+					}
+					resolve_sequence(seq);
+				}
+			}
+
+			// characters removed by X9 take the level of the one before them, and rule L1 resets
+			// separators, and the white space before them and at the end of the paragraph, to the paragraph level
+			void finish_levels() {
+				for(uint32_t i = 0; i < size(); ++i) {
+					if(removed_by_x9(original[i]))
+						levels[i] = i > 0 ? levels[i - 1] : paragraph_level;
+				}
+				bool at_end = true;
+				for(auto i = size(); i-- > 0; ) {
+					auto const t = original[i];
+					if(t == bidi_class::s || t == bidi_class::b) {
+						levels[i] = paragraph_level;
+						at_end = true;
+					} else if(t == bidi_class::ws || is_isolate_initiator(t) || t == bidi_class::pdi || removed_by_x9(t)) {
+						if(at_end)
+							levels[i] = paragraph_level;
+					} else {
+						at_end = false;
+					}
+				}
+			}
+
+		public:
+			bidi_resolver(std::vector<segmented_char> const& chars, uint32_t first, uint32_t last, uint8_t paragraph_level, bool arabic_number_context)
+				: chars(chars), first(first), last(last), paragraph_level(paragraph_level), arabic_number_context(arabic_number_context) {
+			}
+
+			void resolve(logical_attributes* out) {
+				original.resize(size());
+				for(uint32_t i = 0; i < size(); ++i)
+					original[i] = record_bidi_class(chars[first + i].record);
+				types = original;
+				levels.assign(size(), paragraph_level);
+
+				match_isolates();
+				resolve_explicit_levels();
+				embedding_levels = levels;
+				resolve_implicit_levels();
+				finish_levels();
+
+				for(uint32_t i = 0; i < size(); ++i) {
+					auto const unit_end = first + i + 1 < chars.size() ? chars[first + i + 1].unit : chars[first + i].unit + (chars[first + i].codepoint >= 0x10000 ? 2 : 1);
+					for(auto u = chars[first + i].unit; u < unit_end; ++u)
+						out[u].bidi_level = levels[i];
+				}
+			}
+		};
+	}
+
+	void segment_text(logical_attributes* out, std::wstring_view text, bool ltr, bool arabic_number_context) {
+		std::fill(out, out + text.length(), logical_attributes{});
+		if(text.empty())
+			return;
+
+		std::vector<segmented_char> chars;
+		decode_for_segmentation(chars, text);
+
+		bool const latin1 = latin1_prefix(text) == text.length();
+		if(latin1) {
+			// latin 1 has no combining characters, so every character but the lf of a crlf starts a grapheme cluster
+			for(uint32_t i = 0; i < uint32_t(text.length()); ++i) {
+				if(i == 0 || text[i] != L'\n' || text[i - 1] != L'\r')
+					out[i].flags |= logical_attributes::char_stop;
+			}
+		} else {
+			mark_grapheme_stops(out, chars);
+		}
+		// nor does it have right to left characters, so left to right text stays at level 0 unless its digits are arabic numbers
+		if(!latin1 || !ltr || arabic_number_context) {
+			uint32_t paragraph_start = 0;
+			for(uint32_t k = 0; k < uint32_t(chars.size()); ++k) {
+				if(record_bidi_class(chars[k].record) == bidi_class::b && !(chars[k].codepoint == L'\r' && k + 1 < chars.size() && chars[k + 1].codepoint == L'\n')) {
+					bidi_resolver(chars, paragraph_start, k + 1, ltr ? 0 : 1, arabic_number_context).resolve(out);
+					paragraph_start = k + 1;
+				}
+			}
+			if(paragraph_start < chars.size())
+				bidi_resolver(chars, paragraph_start, uint32_t(chars.size()), ltr ? 0 : 1, arabic_number_context).resolve(out);
+		}
+		mark_word_stops(out, chars);
+
+		for(size_t k = 0; k < chars.size(); ++k) {
+			if(record_is_white_space(chars[k].record)) {
+				out[chars[k].unit].flags |= logical_attributes::white_space;
+			} else if(k > 0 && record_is_white_space(chars[k - 1].record)) {
+				out[chars[k].unit].flags |= logical_attributes::soft_break;
+			}
+		}
+	}
+
+	std::vector<bidi_run> visual_runs(logical_attributes const* attributes, uint32_t count) {
+		std::vector<bidi_run> runs;
+		uint8_t highest = 0;
+		uint8_t lowest_odd = 0xFF;
+		for(uint32_t i = 0; i < count; ++i) {
+			auto const level = attributes[i].bidi_level;
+			if(runs.empty() || runs.back().level != level)
+				runs.push_back(bidi_run{ i, i, level });
+			runs.back().end = i + 1;
+			highest = std::max(highest, level);
+			if((level & 1) != 0)
+				lowest_odd = std::min(lowest_odd, level);
+		}
+
+		// from the highest level down to the lowest odd one, reverse every sequence of runs at that level or higher
+		for(uint32_t level = highest; level >= lowest_odd && level > 0; --level) {
+			for(size_t i = 0; i < runs.size(); ) {
+				if(runs[i].level < level) {
+					++i;
+					continue;
+				}
+				auto end = i;
+				while(end < runs.size() && runs[end].level >= level)
+					++end;
+				std::reverse(runs.begin() + i, runs.begin() + end);
+				i = end;
+			}
+		}
+		return runs;
+	}
+}
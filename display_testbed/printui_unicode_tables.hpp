@@ -0,0 +1,1424 @@
+#ifndef PRINTUI_UNICODE_TABLES_HEADER
+#define PRINTUI_UNICODE_TABLES_HEADER
+
+// generated by unicode_table_generator.cpp from unicode 15.0.0; do not edit
+
+#include <cstdint>
+
+namespace printui::text::unicode {
+	enum class bidi_class : uint8_t {
+		l, r, al, en, es, et, an, cs, nsm, bn, b, s, ws, on, lre, lro, rle, rlo, pdf, lri, rli, fsi, pdi
+	};
+	enum class word_break : uint8_t {
+		other, cr, lf, newline, extend, zwj, regional_indicator, format, katakana, hebrew_letter, aletter, single_quote, double_quote, midnumlet, midletter, midnum, numeric, extendnumlet, wsegspace
+	};
+	enum class grapheme_break : uint8_t {
+		other, cr, lf, control, extend, zwj, regional_indicator, prepend, spacingmark, l, v, t, lv, lvt
+	};
+
+	// a property record is the bidi class (bits 0-4), word break (bits 5-9), grapheme break (bits 10-13),
+	// extended pictographic (bit 14) and white space (bit 15) of a codepoint; the record of c is
+	// records[blocks[block_of[c >> block_shift] * block_size + (c & (block_size - 1))]]
+	inline constexpr uint32_t block_shift = 7;
+	inline constexpr uint32_t block_size = 128;
+
+	inline constexpr uint16_t records[83] = {
+		3081,35851,34890,35947,35948,33834,3082,3083,33356,13,397,5,365,4,487,423,
+		7,515,455,493,320,557,35946,32775,16397,3305,3,461,333,4232,0,448,
+		480,1,289,321,449,7398,2,482,3298,322,518,486,7394,513,8320,512,
+		4224,7488,8192,128,9536,10560,11584,32780,4233,5289,3296,3297,429,3310,3312,3314,
+		3311,3313,33319,3315,3316,3317,3318,16704,16384,256,269,12608,13632,9,3309,6,
+		7392,6336,4237,
+	};
+	inline constexpr uint16_t block_of[8704] = {
+		0,1,2,2,2,3,4,5,2,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,
+		29,30,31,32,33,34,35,36,37,2,2,2,38,39,40,41,42,43,44,45,46,47,48,49,50,51,2,52,2,2,53,54,
+		55,56,57,58,59,60,61,62,63,64,60,65,66,67,68,69,70,70,71,60,60,60,72,73,2,74,75,76,77,78,60,79,
+		80,81,82,83,84,85,86,87,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,88,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		2,2,2,2,2,2,2,2,2,89,2,2,90,91,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,108,102,
+		103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,
+		107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,105,106,107,108,102,103,
+		104,105,106,107,108,102,103,104,105,106,107,108,102,103,104,109,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,110,111,112,112,113,114,115,116,117,118,
+		119,120,121,122,70,123,124,125,2,126,127,128,2,2,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,
+		147,148,149,150,151,152,153,70,154,155,70,156,157,158,159,70,160,161,162,163,164,165,70,70,166,167,168,169,70,170,171,172,
+		2,2,2,2,2,2,2,173,174,2,175,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,176,
+		2,2,2,2,2,2,2,2,177,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,2,2,2,2,178,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,2,2,2,2,179,180,181,182,70,70,70,70,183,70,184,185,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,186,
+		187,70,188,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,189,190,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,191,70,
+		70,70,192,193,194,70,195,70,196,197,198,2,2,199,200,201,70,70,70,70,202,203,70,70,70,70,70,70,70,70,204,70,
+		205,206,207,70,70,208,70,70,70,209,70,70,70,70,70,210,211,212,213,142,142,142,142,142,214,215,216,142,217,218,142,142,
+		219,220,221,222,223,224,225,226,225,225,227,225,228,229,230,231,232,233,234,225,235,236,60,237,224,224,224,224,224,224,224,238,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		240,241,242,243,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,241,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+		70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,239,
+	};
+	inline constexpr uint8_t blocks[31232] = {
+		0,0,0,0,0,0,0,0,0,1,2,3,4,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,6,6,7,
+		8,9,10,11,11,11,9,12,9,9,9,13,14,13,15,16,17,17,17,17,17,17,17,17,17,17,18,19,9,9,9,9,
+		9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,21,
+		9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,0,
+		0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		23,9,11,11,11,11,9,9,9,24,20,9,9,25,24,9,11,11,26,26,9,20,9,27,9,26,20,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,28,28,20,20,20,20,20,
+		20,20,28,28,28,28,28,28,28,28,28,28,28,28,28,28,20,20,28,28,28,28,28,28,9,9,9,9,9,9,28,28,
+		20,20,20,20,20,28,28,28,28,28,28,28,28,28,20,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,20,20,20,20,28,9,20,20,30,30,20,20,20,20,19,20,
+		30,30,30,30,9,9,20,27,20,20,20,30,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,20,
+		20,20,30,29,29,29,29,29,29,29,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,20,30,20,31,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,32,28,30,30,9,9,11,33,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,33,29,
+		33,29,29,33,29,29,33,29,33,33,33,33,33,33,33,33,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,34,
+		34,34,34,34,34,34,34,34,34,34,34,33,33,33,33,34,34,34,34,35,36,33,33,33,33,33,33,33,33,33,33,33,
+		37,37,37,37,37,37,9,9,38,11,11,38,14,39,9,9,29,29,29,29,29,29,29,29,29,29,29,38,40,38,38,38,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		42,42,42,42,42,42,42,42,42,42,11,42,43,38,41,41,29,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,41,29,29,29,29,29,29,29,37,9,29,
+		29,29,29,29,29,41,41,29,29,9,29,29,29,29,41,41,17,17,17,17,17,17,17,17,17,17,41,41,41,38,38,41,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,44,41,29,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,38,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,29,29,29,29,29,29,29,29,29,29,29,41,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		45,45,45,45,45,45,45,45,45,45,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,29,29,29,29,29,29,29,29,29,35,35,9,9,19,9,35,33,33,29,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,29,29,29,29,35,29,29,29,29,29,
+		29,29,29,29,35,29,29,29,35,29,29,29,29,29,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,29,29,29,33,33,33,33,
+		41,41,41,41,41,41,41,41,41,41,41,38,38,38,38,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,38,41,41,41,41,41,41,38,37,37,38,38,38,38,38,38,29,29,29,29,29,29,29,29,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,37,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,46,29,20,46,46,
+		46,29,29,29,29,29,29,29,29,46,46,46,46,29,46,46,20,29,29,29,29,29,29,29,20,20,20,20,20,20,20,20,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,29,46,46,30,20,20,20,20,20,20,20,20,30,30,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,30,30,30,20,20,20,20,30,30,29,20,48,46,
+		46,29,29,29,29,30,30,46,46,30,30,46,46,29,20,30,30,30,30,30,30,30,30,48,30,30,30,30,20,20,30,20,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,20,20,11,11,30,30,30,30,30,30,30,11,20,30,29,30,
+		30,29,29,46,30,20,20,20,20,20,20,30,30,30,30,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,20,20,30,20,20,30,30,29,30,46,46,
+		46,29,29,30,30,30,30,29,29,30,30,29,29,29,30,30,30,29,30,30,30,30,30,30,30,20,20,20,20,30,20,30,
+		30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,29,29,20,20,20,29,30,30,30,30,30,30,30,30,30,30,
+		30,29,29,46,30,20,20,20,20,20,20,20,20,20,30,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,30,30,29,20,46,46,
+		46,29,29,29,29,29,30,29,29,46,30,46,46,29,30,30,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,11,30,30,30,30,30,30,30,20,29,29,29,29,29,29,
+		30,29,46,46,30,20,20,20,20,20,20,20,20,30,30,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,30,30,29,20,48,29,
+		46,29,29,29,29,30,30,46,46,30,30,46,46,29,30,30,30,30,30,30,30,29,29,48,30,30,30,30,20,20,30,20,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,29,20,30,20,20,20,20,20,20,30,30,30,20,20,20,30,20,20,20,20,30,30,30,20,20,30,20,30,20,20,
+		30,30,30,20,20,30,30,30,20,20,20,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,48,46,
+		29,46,46,30,30,30,46,46,46,30,46,46,46,29,30,30,20,30,30,30,30,30,30,48,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,9,9,9,9,9,9,11,9,30,30,30,30,30,
+		29,46,46,46,29,20,20,20,20,20,20,20,20,30,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,29,20,29,29,
+		29,46,46,46,46,30,29,29,29,30,29,29,29,29,30,30,30,30,30,30,30,29,29,30,20,20,20,30,30,20,30,30,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,30,
+		20,29,46,46,30,20,20,20,20,20,20,20,20,30,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,30,30,29,20,46,48,
+		46,46,48,46,46,30,48,46,46,30,46,46,29,29,30,30,30,30,30,30,30,48,48,30,30,30,30,30,30,20,20,30,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,20,20,46,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,29,46,46,20,20,20,20,20,20,20,20,20,30,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,20,48,46,
+		46,29,29,29,29,30,46,46,46,30,46,46,46,29,49,30,30,30,30,30,20,20,20,48,30,30,30,30,30,30,30,20,
+		20,20,29,29,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,
+		30,29,46,46,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,30,20,30,30,
+		20,20,20,20,20,20,20,30,30,30,29,30,30,30,30,48,46,46,29,29,29,30,29,30,46,46,46,46,46,46,46,48,
+		30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,46,46,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,30,50,29,29,29,29,29,29,29,30,30,30,30,11,
+		30,30,30,30,30,30,30,29,29,29,29,29,29,29,29,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,30,50,29,29,29,29,29,29,29,29,29,30,30,30,
+		30,30,30,30,30,30,30,30,29,29,29,29,29,29,29,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,30,30,30,30,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,29,30,29,30,29,9,9,9,9,46,46,
+		20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,46,
+		29,29,29,29,29,30,29,29,20,20,20,20,20,29,29,29,29,29,29,29,29,29,29,29,30,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,
+		30,30,30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,51,51,29,29,29,29,46,29,29,29,29,29,29,51,29,29,46,46,29,29,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,30,46,46,29,29,30,30,30,30,29,29,
+		29,30,51,51,51,30,30,51,51,51,51,51,51,51,30,30,30,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,29,51,46,29,29,51,51,51,51,51,51,29,30,51,47,47,47,47,47,47,47,47,47,47,51,51,51,29,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,30,20,30,30,30,30,30,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,
+		52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+		52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+		52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+		53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		53,53,53,53,53,53,53,53,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+		54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+		54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,30,20,30,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,30,
+		20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,29,29,29,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,
+		9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		8,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,30,30,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,46,30,30,30,30,30,30,30,30,30,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,46,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,30,29,29,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,46,29,29,29,29,29,29,29,46,46,
+		46,46,46,46,46,46,29,46,46,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,11,30,29,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,29,29,29,25,29,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,
+		20,20,20,20,20,29,29,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,29,20,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		29,29,29,46,46,46,46,29,29,46,46,46,30,30,30,30,46,46,29,46,46,46,46,46,46,29,29,29,30,30,30,30,
+		9,30,30,30,9,9,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,46,46,29,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,46,29,46,29,29,29,29,29,29,29,30,
+		29,51,29,51,51,29,29,29,29,29,29,29,29,46,46,46,46,46,46,29,29,29,29,29,29,29,29,29,29,30,30,29,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,29,29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,48,29,29,29,29,29,46,29,46,46,46,
+		46,46,29,46,46,20,20,20,20,20,20,20,20,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,46,29,29,29,29,46,46,29,29,46,29,29,29,20,20,47,47,47,47,47,47,47,47,47,47,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,29,46,29,29,46,46,46,29,46,29,29,29,46,46,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,46,46,46,46,46,46,46,46,29,29,29,29,29,29,29,29,46,46,29,29,30,30,30,30,30,30,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,20,20,20,47,47,47,47,47,47,47,47,47,47,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,29,30,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,46,29,29,29,29,29,29,29,20,20,20,20,29,20,20,20,20,20,20,29,20,20,46,29,29,20,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,20,20,20,20,20,20,20,20,30,20,30,20,30,20,30,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,9,20,9,
+		9,9,20,20,20,30,20,20,20,20,20,20,20,9,9,9,20,20,20,20,30,30,20,20,20,20,20,20,30,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,30,30,20,20,20,30,20,20,20,20,20,20,20,9,9,30,
+		8,8,8,8,8,8,8,55,8,8,8,0,56,57,58,59,9,9,9,9,9,9,9,9,60,60,9,9,9,9,9,9,
+		9,9,9,9,60,9,9,27,4,22,61,62,63,64,65,66,11,11,11,11,11,9,9,9,9,9,9,9,24,9,9,21,
+		21,9,9,9,14,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,21,9,9,9,9,9,9,9,9,9,9,8,
+		25,25,25,25,25,0,67,68,69,70,25,25,25,25,25,25,26,20,30,30,26,26,26,26,26,26,13,13,9,9,9,20,
+		26,26,26,26,26,26,26,26,26,26,13,13,9,9,9,30,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,
+		11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+		11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,20,9,9,9,9,20,9,9,20,20,20,20,20,20,20,20,20,20,9,20,9,9,9,20,20,20,20,20,9,9,
+		9,9,24,9,20,9,20,9,20,9,20,20,20,20,11,20,20,20,20,20,20,20,20,20,20,71,9,9,20,20,20,20,
+		9,9,9,9,9,20,20,20,20,20,9,9,9,9,20,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,9,9,9,30,30,30,30,9,9,9,9,24,24,24,24,24,24,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,24,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,11,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,9,9,9,9,
+		9,9,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,9,9,30,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,24,24,24,24,24,24,24,24,24,24,24,9,9,9,9,24,24,24,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,
+		20,20,71,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,24,24,9,9,9,9,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,
+		24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,24,24,9,
+		24,24,24,24,24,24,9,24,24,24,24,24,24,24,24,24,24,24,24,9,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,9,9,9,9,9,9,9,9,9,9,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,9,9,24,24,24,24,24,24,24,24,24,24,24,9,24,9,24,9,9,9,9,9,9,24,9,9,
+		9,24,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,24,24,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,24,9,9,24,9,9,9,9,24,9,24,9,9,9,9,24,24,24,9,24,9,9,9,9,9,9,9,9,
+		9,9,9,24,24,24,24,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,24,9,9,9,9,9,9,9,9,
+		9,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,24,24,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,9,9,9,9,24,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,9,9,9,9,9,9,20,20,20,20,29,29,29,20,20,30,30,30,30,30,9,9,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,30,20,30,30,30,30,30,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,
+		20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,28,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,
+		8,9,9,9,9,20,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,30,30,30,30,30,30,30,30,30,29,29,29,29,48,48,24,73,73,73,73,73,9,9,30,30,30,20,20,24,9,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,74,74,30,30,30,
+		74,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,9,73,73,73,73,
+		30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,72,30,72,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,30,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		47,47,47,47,47,47,47,47,47,47,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,9,29,29,29,29,29,29,29,29,29,29,9,28,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+		28,28,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,28,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,20,20,30,20,30,20,20,20,20,20,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,29,20,20,20,29,20,20,20,20,29,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,46,46,29,29,46,9,9,9,9,29,30,30,30,30,30,30,30,30,30,30,30,11,11,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,30,30,30,30,30,30,30,30,
+		46,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,46,46,46,46,46,46,46,46,46,
+		46,46,46,46,29,29,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,20,20,20,20,20,20,30,30,30,20,30,20,20,29,
+		47,47,47,47,47,47,47,47,47,47,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,29,29,29,29,29,29,29,29,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,29,29,29,29,29,29,29,29,29,29,29,46,46,30,30,30,30,30,30,30,30,30,30,30,30,
+		52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,30,30,30,
+		29,29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,46,46,29,29,29,29,46,46,29,29,46,46,
+		46,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,29,29,29,29,29,29,46,46,29,29,46,46,29,29,30,30,30,30,30,30,30,30,30,
+		20,20,20,29,20,20,20,20,20,20,20,20,29,46,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,51,29,51,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,30,29,29,29,30,30,29,29,30,30,30,30,30,29,29,
+		30,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,46,29,29,46,46,30,30,20,20,20,46,29,30,30,30,30,30,30,30,30,30,
+		30,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,9,9,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,46,46,29,46,46,29,46,46,30,46,29,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,76,76,76,76,75,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+		76,76,76,76,30,30,30,30,30,30,30,30,30,30,30,30,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+		53,53,53,53,53,53,53,30,30,30,30,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,
+		54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,54,30,30,30,30,
+		20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,30,30,30,30,30,34,29,34,
+		34,34,34,34,34,34,34,34,34,13,34,34,34,34,34,34,34,34,34,34,34,34,34,33,34,34,34,34,34,33,34,33,
+		34,34,33,34,34,33,34,34,34,34,34,34,34,34,34,34,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,38,38,38,38,38,38,38,9,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,
+		77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,77,41,41,41,41,41,41,41,41,41,41,41,41,38,9,9,9,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,19,9,9,27,19,9,9,9,9,9,30,30,30,30,30,30,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,9,9,9,21,21,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,21,21,21,14,9,15,30,19,18,9,9,9,9,9,9,9,9,9,11,
+		9,9,13,13,9,9,9,30,9,11,11,9,30,30,30,30,41,41,41,41,41,38,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,38,25,
+		30,9,9,11,11,11,9,60,9,9,9,13,14,13,15,16,17,17,17,17,17,17,17,17,17,17,18,19,9,9,9,9,
+		9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,21,
+		9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,9,9,9,9,
+		9,9,9,9,9,9,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+		73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,48,48,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		30,30,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,20,20,20,20,20,20,30,30,20,20,20,30,30,30,
+		11,11,9,9,9,11,11,30,9,9,9,9,9,9,9,30,0,0,0,0,0,0,0,0,0,78,78,78,9,9,77,77,
+		20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,30,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,
+		30,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+		28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,
+		9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,29,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,30,30,30,30,20,20,20,20,20,20,20,20,30,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,20,20,20,20,
+		20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		35,35,35,35,35,35,33,33,35,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,35,35,33,33,33,35,33,33,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,35,35,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,9,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,35,35,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,29,29,29,33,29,29,33,33,33,33,33,29,29,29,29,35,35,35,35,33,35,35,35,33,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,29,29,29,33,33,33,33,29,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,29,29,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,9,9,9,9,9,9,9,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,29,29,29,29,38,38,38,38,38,38,38,38,42,42,42,42,42,42,42,42,42,42,38,38,38,38,38,38,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,33,29,29,33,33,33,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,29,29,29,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,
+		33,33,33,33,33,33,33,35,33,33,33,33,33,33,33,33,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		41,41,41,41,41,41,29,29,29,29,29,29,29,29,29,29,29,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,29,29,29,29,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,33,33,33,33,33,33,33,33,33,
+		46,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,47,47,47,47,47,47,47,47,47,47,29,20,20,29,29,20,30,30,30,30,30,30,30,30,30,29,
+		29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,46,46,29,29,30,30,80,30,30,
+		30,30,29,30,30,30,30,30,30,30,30,30,30,80,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		29,29,29,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,29,29,29,29,29,46,29,29,29,29,29,29,29,29,30,47,47,47,47,47,47,47,47,47,47,
+		30,30,30,30,20,46,46,20,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,30,30,20,30,30,30,30,30,30,30,30,30,
+		29,29,46,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,29,29,29,29,29,46,
+		46,20,49,49,20,30,30,30,30,29,29,29,29,30,46,29,47,47,47,47,47,47,47,47,47,47,20,30,20,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,46,46,29,46,29,29,30,30,30,30,30,30,29,20,
+		20,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,30,20,30,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,
+		20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,
+		46,46,46,29,29,29,29,29,29,29,29,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		29,29,46,46,30,20,20,20,20,20,20,20,20,30,30,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,30,29,29,20,48,46,
+		29,46,46,46,46,30,30,46,46,30,30,46,46,46,30,30,20,30,30,30,30,30,30,48,30,30,30,30,30,20,20,20,
+		20,20,46,46,30,30,29,29,29,29,29,29,29,30,30,30,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,29,29,29,29,
+		46,46,29,29,29,46,29,20,20,20,20,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,29,20,
+		20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,48,46,46,29,29,29,29,29,29,46,29,46,46,48,46,29,
+		29,46,29,29,20,20,30,20,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,48,46,46,29,29,29,29,30,30,46,46,46,46,29,29,46,29,
+		29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,29,29,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,29,29,29,29,46,46,29,46,29,
+		29,30,30,30,20,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,29,46,29,46,46,29,29,29,29,29,29,46,29,20,30,30,30,30,30,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,29,
+		51,51,29,29,29,29,46,29,29,29,29,29,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,29,29,29,29,29,46,29,29,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,
+		20,20,20,20,20,20,20,30,30,20,30,30,20,20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,48,46,46,46,46,46,30,46,46,30,30,29,29,46,29,49,
+		46,49,46,29,30,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,46,29,29,29,29,30,30,29,29,46,46,46,46,
+		29,20,30,20,46,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,29,29,29,29,29,29,48,48,29,29,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,29,29,46,49,29,29,29,29,30,
+		30,30,30,30,30,30,30,29,30,30,30,30,30,30,30,30,20,29,29,29,29,29,29,46,46,29,29,29,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,49,49,49,49,49,49,29,29,29,29,29,29,29,29,29,29,29,29,29,46,29,29,30,30,30,20,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,29,29,29,29,29,29,29,30,29,29,29,29,29,29,46,48,
+		20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,30,46,29,29,29,29,29,29,29,46,29,29,46,29,29,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,29,29,30,30,30,29,30,29,29,30,29,
+		29,29,29,29,29,29,49,29,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		20,20,20,20,20,20,30,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,46,46,46,46,46,30,29,29,30,46,46,29,46,29,20,30,30,30,30,30,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,46,46,30,30,30,30,30,30,30,30,30,
+		29,29,49,46,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,46,46,29,29,29,29,29,30,30,30,46,46,
+		29,46,29,30,30,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,9,9,9,9,9,9,9,9,11,11,11,
+		11,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,58,
+		29,20,20,20,20,20,20,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,29,20,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+		46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+		46,46,46,46,46,46,46,46,30,30,30,30,30,30,30,29,29,29,29,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,9,20,29,30,30,30,30,30,30,30,30,30,30,30,46,46,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,73,73,73,73,30,73,73,73,73,73,73,73,30,73,73,30,
+		73,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		73,73,73,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,73,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,73,73,73,73,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,
+		20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,30,30,30,29,29,30,
+		25,25,25,25,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,48,46,29,29,29,30,30,30,46,48,48,48,48,48,25,25,25,25,25,25,25,25,29,29,29,29,29,
+		29,29,29,30,30,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,29,29,29,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,
+		30,30,20,30,30,20,20,30,30,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,30,20,30,20,20,20,
+		20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,30,20,20,20,20,30,30,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,30,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,30,
+		20,20,20,20,20,30,20,30,30,30,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,9,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,9,20,20,20,20,20,20,20,20,30,30,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+		17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,29,29,29,29,
+		30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		30,30,30,30,30,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		29,29,29,29,29,29,29,30,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,30,30,29,29,29,29,29,
+		29,29,30,29,29,30,29,29,29,29,29,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,30,30,30,29,29,29,29,29,29,29,20,20,20,20,20,20,20,30,30,
+		47,47,47,47,47,47,47,47,47,47,30,30,30,30,20,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,29,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,11,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,20,20,29,29,29,29,47,47,47,47,47,47,47,47,47,47,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		20,20,20,20,20,20,20,30,20,20,20,20,30,20,20,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,30,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,33,33,33,33,33,33,33,33,33,33,33,29,29,29,29,29,29,29,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+		35,35,35,35,29,29,29,29,29,29,29,35,33,33,33,33,45,45,45,45,45,45,45,45,45,45,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+		41,41,41,41,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,
+		38,41,41,38,41,38,38,41,38,41,41,41,41,41,41,41,41,41,41,38,41,41,41,41,38,41,38,41,38,38,38,38,
+		38,38,41,38,38,38,38,41,38,41,38,41,38,41,41,41,38,41,41,38,41,38,38,41,38,41,38,41,38,41,38,41,
+		38,41,41,38,41,38,38,41,41,41,41,38,41,41,41,41,41,41,41,38,41,41,41,41,38,41,41,41,41,38,41,38,
+		41,41,41,41,41,41,41,41,41,41,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,38,38,38,
+		38,41,41,41,38,41,41,41,41,41,38,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,9,9,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,72,72,72,72,72,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,72,72,72,
+		26,26,26,26,26,26,26,26,26,26,26,9,9,24,24,24,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,24,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,30,30,30,30,30,30,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,
+		20,20,20,20,20,20,20,20,20,20,9,9,24,24,24,24,71,71,20,20,20,20,20,20,20,20,20,20,20,20,71,71,
+		20,20,20,20,20,20,20,20,20,20,30,30,30,30,72,30,30,72,72,72,72,72,72,72,72,72,72,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,24,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,81,
+		30,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,30,30,30,30,30,30,30,30,30,30,72,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,72,30,30,72,72,72,72,72,72,72,72,72,30,72,72,72,72,
+		30,30,30,30,30,30,30,30,30,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		24,24,24,24,24,24,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,82,82,82,82,82,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,9,9,
+		9,9,9,9,9,9,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,24,72,72,72,72,24,24,24,24,24,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,24,24,24,24,24,72,72,72,72,72,72,
+		24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,24,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		9,9,9,9,9,9,9,9,9,9,9,9,72,72,72,72,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,72,72,72,72,72,72,72,72,9,9,9,9,9,9,9,9,9,9,72,72,72,72,72,72,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,72,72,72,72,72,72,72,72,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,72,72,24,24,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		9,9,9,9,9,9,9,9,9,9,9,9,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,9,24,24,24,24,
+		24,24,24,24,24,24,9,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,72,72,72,72,72,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,
+		24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+		24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,24,
+		24,24,24,24,24,24,72,72,72,72,72,72,72,72,24,24,24,24,24,24,24,24,24,24,24,24,24,24,72,72,72,72,
+		24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,24,24,24,24,24,24,24,24,24,72,72,72,72,72,72,72,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,30,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+		9,9,9,9,9,9,9,9,9,9,9,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,17,17,17,17,17,17,17,17,17,17,30,30,30,30,30,30,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+		72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,77,77,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+		30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,77,77,
+		0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+		56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+		29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	};
+
+	// the characters with a bidi paired bracket type, in codepoint order
+	struct paired_bracket {
+		uint32_t codepoint;
+		uint32_t pair;
+		bool opening;
+	};
+	inline constexpr paired_bracket paired_brackets[128] = {
+		paired_bracket{ 0x0028, 0x0029, true },
+		paired_bracket{ 0x0029, 0x0028, false },
+		paired_bracket{ 0x005B, 0x005D, true },
+		paired_bracket{ 0x005D, 0x005B, false },
+		paired_bracket{ 0x007B, 0x007D, true },
+		paired_bracket{ 0x007D, 0x007B, false },
+		paired_bracket{ 0x0F3A, 0x0F3B, true },
+		paired_bracket{ 0x0F3B, 0x0F3A, false },
+		paired_bracket{ 0x0F3C, 0x0F3D, true },
+		paired_bracket{ 0x0F3D, 0x0F3C, false },
+		paired_bracket{ 0x169B, 0x169C, true },
+		paired_bracket{ 0x169C, 0x169B, false },
+		paired_bracket{ 0x2045, 0x2046, true },
+		paired_bracket{ 0x2046, 0x2045, false },
+		paired_bracket{ 0x207D, 0x207E, true },
+		paired_bracket{ 0x207E, 0x207D, false },
+		paired_bracket{ 0x208D, 0x208E, true },
+		paired_bracket{ 0x208E, 0x208D, false },
+		paired_bracket{ 0x2308, 0x2309, true },
+		paired_bracket{ 0x2309, 0x2308, false },
+		paired_bracket{ 0x230A, 0x230B, true },
+		paired_bracket{ 0x230B, 0x230A, false },
+		paired_bracket{ 0x2329, 0x232A, true },
+		paired_bracket{ 0x232A, 0x2329, false },
+		paired_bracket{ 0x2768, 0x2769, true },
+		paired_bracket{ 0x2769, 0x2768, false },
+		paired_bracket{ 0x276A, 0x276B, true },
+		paired_bracket{ 0x276B, 0x276A, false },
+		paired_bracket{ 0x276C, 0x276D, true },
+		paired_bracket{ 0x276D, 0x276C, false },
+		paired_bracket{ 0x276E, 0x276F, true },
+		paired_bracket{ 0x276F, 0x276E, false },
+		paired_bracket{ 0x2770, 0x2771, true },
+		paired_bracket{ 0x2771, 0x2770, false },
+		paired_bracket{ 0x2772, 0x2773, true },
+		paired_bracket{ 0x2773, 0x2772, false },
+		paired_bracket{ 0x2774, 0x2775, true },
+		paired_bracket{ 0x2775, 0x2774, false },
+		paired_bracket{ 0x27C5, 0x27C6, true },
+		paired_bracket{ 0x27C6, 0x27C5, false },
+		paired_bracket{ 0x27E6, 0x27E7, true },
+		paired_bracket{ 0x27E7, 0x27E6, false },
+		paired_bracket{ 0x27E8, 0x27E9, true },
+		paired_bracket{ 0x27E9, 0x27E8, false },
+		paired_bracket{ 0x27EA, 0x27EB, true },
+		paired_bracket{ 0x27EB, 0x27EA, false },
+		paired_bracket{ 0x27EC, 0x27ED, true },
+		paired_bracket{ 0x27ED, 0x27EC, false },
+		paired_bracket{ 0x27EE, 0x27EF, true },
+		paired_bracket{ 0x27EF, 0x27EE, false },
+		paired_bracket{ 0x2983, 0x2984, true },
+		paired_bracket{ 0x2984, 0x2983, false },
+		paired_bracket{ 0x2985, 0x2986, true },
+		paired_bracket{ 0x2986, 0x2985, false },
+		paired_bracket{ 0x2987, 0x2988, true },
+		paired_bracket{ 0x2988, 0x2987, false },
+		paired_bracket{ 0x2989, 0x298A, true },
+		paired_bracket{ 0x298A, 0x2989, false },
+		paired_bracket{ 0x298B, 0x298C, true },
+		paired_bracket{ 0x298C, 0x298B, false },
+		paired_bracket{ 0x298D, 0x2990, true },
+		paired_bracket{ 0x298E, 0x298F, false },
+		paired_bracket{ 0x298F, 0x298E, true },
+		paired_bracket{ 0x2990, 0x298D, false },
+		paired_bracket{ 0x2991, 0x2992, true },
+		paired_bracket{ 0x2992, 0x2991, false },
+		paired_bracket{ 0x2993, 0x2994, true },
+		paired_bracket{ 0x2994, 0x2993, false },
+		paired_bracket{ 0x2995, 0x2996, true },
+		paired_bracket{ 0x2996, 0x2995, false },
+		paired_bracket{ 0x2997, 0x2998, true },
+		paired_bracket{ 0x2998, 0x2997, false },
+		paired_bracket{ 0x29D8, 0x29D9, true },
+		paired_bracket{ 0x29D9, 0x29D8, false },
+		paired_bracket{ 0x29DA, 0x29DB, true },
+		paired_bracket{ 0x29DB, 0x29DA, false },
+		paired_bracket{ 0x29FC, 0x29FD, true },
+		paired_bracket{ 0x29FD, 0x29FC, false },
+		paired_bracket{ 0x2E22, 0x2E23, true },
+		paired_bracket{ 0x2E23, 0x2E22, false },
+		paired_bracket{ 0x2E24, 0x2E25, true },
+		paired_bracket{ 0x2E25, 0x2E24, false },
+		paired_bracket{ 0x2E26, 0x2E27, true },
+		paired_bracket{ 0x2E27, 0x2E26, false },
+		paired_bracket{ 0x2E28, 0x2E29, true },
+		paired_bracket{ 0x2E29, 0x2E28, false },
+		paired_bracket{ 0x2E55, 0x2E56, true },
+		paired_bracket{ 0x2E56, 0x2E55, false },
+		paired_bracket{ 0x2E57, 0x2E58, true },
+		paired_bracket{ 0x2E58, 0x2E57, false },
+		paired_bracket{ 0x2E59, 0x2E5A, true },
+		paired_bracket{ 0x2E5A, 0x2E59, false },
+		paired_bracket{ 0x2E5B, 0x2E5C, true },
+		paired_bracket{ 0x2E5C, 0x2E5B, false },
+		paired_bracket{ 0x3008, 0x3009, true },
+		paired_bracket{ 0x3009, 0x3008, false },
+		paired_bracket{ 0x300A, 0x300B, true },
+		paired_bracket{ 0x300B, 0x300A, false },
+		paired_bracket{ 0x300C, 0x300D, true },
+		paired_bracket{ 0x300D, 0x300C, false },
+		paired_bracket{ 0x300E, 0x300F, true },
+		paired_bracket{ 0x300F, 0x300E, false },
+		paired_bracket{ 0x3010, 0x3011, true },
+		paired_bracket{ 0x3011, 0x3010, false },
+		paired_bracket{ 0x3014, 0x3015, true },
+		paired_bracket{ 0x3015, 0x3014, false },
+		paired_bracket{ 0x3016, 0x3017, true },
+		paired_bracket{ 0x3017, 0x3016, false },
+		paired_bracket{ 0x3018, 0x3019, true },
+		paired_bracket{ 0x3019, 0x3018, false },
+		paired_bracket{ 0x301A, 0x301B, true },
+		paired_bracket{ 0x301B, 0x301A, false },
+		paired_bracket{ 0xFE59, 0xFE5A, true },
+		paired_bracket{ 0xFE5A, 0xFE59, false },
+		paired_bracket{ 0xFE5B, 0xFE5C, true },
+		paired_bracket{ 0xFE5C, 0xFE5B, false },
+		paired_bracket{ 0xFE5D, 0xFE5E, true },
+		paired_bracket{ 0xFE5E, 0xFE5D, false },
+		paired_bracket{ 0xFF08, 0xFF09, true },
+		paired_bracket{ 0xFF09, 0xFF08, false },
+		paired_bracket{ 0xFF3B, 0xFF3D, true },
+		paired_bracket{ 0xFF3D, 0xFF3B, false },
+		paired_bracket{ 0xFF5B, 0xFF5D, true },
+		paired_bracket{ 0xFF5D, 0xFF5B, false },
+		paired_bracket{ 0xFF5F, 0xFF60, true },
+		paired_bracket{ 0xFF60, 0xFF5F, false },
+		paired_bracket{ 0xFF62, 0xFF63, true },
+		paired_bracket{ 0xFF63, 0xFF62, false },
+	};
+}
+
+#endif
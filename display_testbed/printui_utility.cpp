@@ -187,6 +187,7 @@ namespace printui {
 		}
 		if(keyboard_target && keyboard_target->get_layout_interface() == l)
 			set_keyboard_focus(nullptr);
+		rendering_interface.release_foreground_tile(l);
 	}
 
 	void window_data::safely_release_interface(layout_interface* v) {
@@ -217,48 +218,41 @@ namespace printui {
 		v.clear();
 	}
 
-	std::optional<undo_item> undo_buffer::undo(undo_item current_state) {
-		push_state(current_state);
+	std::optional<undo_item> undo_buffer::undo(edit_interface* from) {
+		if(from == nullptr || interal_buffer[buffer_position].from != from)
+			return std::optional<undo_item>{};
 
-		auto temp_back = buffer_position - 1;
-		if(temp_back < 0) {
-			temp_back += total_size;
+		auto result = interal_buffer[buffer_position];
+		--buffer_position;
+		if(buffer_position < 0) {
+			buffer_position += total_size;
 		}
-
-		if(interal_buffer[temp_back].from == current_state.from) {
-			buffer_position = temp_back;
-			return interal_buffer[temp_back];
+		return result;
+	}
+	std::optional<undo_item> undo_buffer::redo(edit_interface* from) {
+		auto temp_next = buffer_position + 1;
+		if(temp_next >= total_size) {
+			temp_next -= total_size;
 		}
 
-		return std::optional<undo_item>{};
-	}
-	std::optional<undo_item> undo_buffer::redo(undo_item current_state) {
-		if(interal_buffer[buffer_position] == current_state) {
-			auto temp_back = buffer_position + 1;
-			if(temp_back >= total_size) {
-				temp_back -= total_size;
-			}
+		if(from == nullptr || interal_buffer[temp_next].from != from)
+			return std::optional<undo_item>{};
 
-			if(interal_buffer[temp_back].from == current_state.from) {
-				buffer_position = temp_back;
-				return interal_buffer[buffer_position];
-			}
-		} 
-		return std::optional<undo_item>{};
+		buffer_position = temp_next;
+		return interal_buffer[buffer_position];
 	}
-	void undo_buffer::push_state(undo_item state) {
-		if(interal_buffer[buffer_position] != state) {
-			++buffer_position;
-			if(buffer_position >= total_size) {
-				buffer_position -= total_size;
-			}
-			
-			interal_buffer[buffer_position] = state;
-			auto temp_next = buffer_position + 1;
-			if(temp_next >= total_size) {
-				temp_next -= total_size;
-			}
-			interal_buffer[temp_next].from = nullptr;
+	void undo_buffer::push_change(undo_item change) {
+		++buffer_position;
+		if(buffer_position >= total_size) {
+			buffer_position -= total_size;
+		}
+
+		interal_buffer[buffer_position] = std::move(change);
+		// the slot after the latest change marks the end of the history, both for redo and for undo once the buffer has wrapped
+		auto temp_next = buffer_position + 1;
+		if(temp_next >= total_size) {
+			temp_next -= total_size;
 		}
+		interal_buffer[temp_next] = undo_item{};
 	}
 }
@@ -205,6 +205,8 @@ namespace printui {
 		);
 
 		if(m_hwnd) {
+			win.text_interface.arrangement_jobs.on_job_complete = [this]() { post_arrangements_ready(); };
+
 			win.double_click_ms = GetDoubleClickTime();
 			win.caret_blink_ms = GetCaretBlinkTime() * 2;
 			if(GetCaretBlinkTime() == INFINITE)
@@ -372,6 +374,7 @@ namespace printui {
 
 
 	void window_data::on_dpi_change() {
+		text_interface.arrangement_jobs.cancel_pending();
 		layout_size = int32_t(std::round(dynamic_settings.global_size_multiplier * float(dynamic_settings.layout_base_size) * dpi / 96.0f));
 		window_border = int32_t(std::round(float(dynamic_settings.window_border) * dpi / 96.0f));
 
@@ -513,6 +516,17 @@ namespace printui {
 			capture_key = -1;
 			return true;
 		}
+		if(dynamic_settings.frame_profiling && window_interface.is_ctrl_held_down() && window_interface.is_shift_held_down()) {
+			if(key_code == 'P') {
+				rendering_interface.profiler.show_overlay = !rendering_interface.profiler.show_overlay;
+				window_interface.invalidate_window();
+				return true;
+			} else if(key_code == 'T') {
+				file_system.write_file(L"frame_trace.json", rendering_interface.profiler.to_chrome_trace());
+				file_system.write_file(L"frame_statistics.txt", rendering_interface.profiler.statistics_report());
+				return true;
+			}
+		}
 		if(keyboard_target && scan_code != secondary_escape_sc) {
 			bool shift_held = window_interface.is_shift_held_down();
 			bool ctrl_held = window_interface.is_ctrl_held_down();
@@ -1592,6 +1606,10 @@ namespace printui {
 						if(app->keyboard_target)
 							app->keyboard_target->set_cursor_visibility(*app, true);
 						return 0;
+					case arrangements_ready_message:
+						app->window_interface.clear_arrangements_ready();
+						app->on_text_arrangements_ready();
+						return 0;
 					default:
 						break;
 				}
@@ -1768,6 +1786,14 @@ namespace printui {
 		return (void*)m_hwnd;
 	}
 
+	void os_win32_wrapper::post_arrangements_ready() {
+		if(!arrangements_ready_posted.exchange(true))
+			PostMessage((HWND)(m_hwnd), arrangements_ready_message, 0, 0);
+	}
+	void os_win32_wrapper::clear_arrangements_ready() {
+		arrangements_ready_posted = false;
+	}
+
 	void window_data::set_keyboard_focus(edit_interface* i) {
 		if(keyboard_target == i)
 			return;
@@ -9,13 +9,18 @@
 
 #include "printui_datatypes.hpp"
 #include <Windows.h>
+#include <atomic>
 
 namespace printui {
 
+	// posted when the text arrangement workers have finished something; at most one is ever waiting in the queue
+	inline constexpr UINT arrangements_ready_message = WM_APP;
+
 	struct os_win32_wrapper {
 	private:
 		HWND m_hwnd = nullptr;
 		bool cursor_visible = false;
+		std::atomic<bool> arrangements_ready_posted = false;
 	public:
 		os_win32_wrapper();
 		~os_win32_wrapper();
@@ -49,6 +54,8 @@ namespace printui {
 		void create_system_caret(int32_t width, int32_t height);
 		void move_system_caret(int32_t x, int32_t y);
 		void destroy_system_caret();
+		void post_arrangements_ready(); // may be called from any thread
+		void clear_arrangements_ready();
 	};
 
 	
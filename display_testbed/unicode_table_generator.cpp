@@ -0,0 +1,381 @@
+// writes printui_unicode_tables.hpp, the character properties used by printui_text_segmentation.cpp, and the
+// conformance data in ../Catch_text_parsing_tests/conformance that the tests check the segmenter against
+// it is not part of any project; build it on its own against icu, for example
+//     cl /std:c++17 /EHsc unicode_table_generator.cpp icu.lib         (windows 10 1903 and later ship icu)
+//     g++ -std=c++17 unicode_table_generator.cpp -licuuc -o unicode_table_generator
+// and run it from this directory after updating icu to the unicode version the tables should follow
+
+#ifdef _WIN32
+#include <icu.h>
+#else
+#include <unicode/ubidi.h>
+#include <unicode/ubrk.h>
+#include <unicode/uchar.h>
+#include <unicode/uversion.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	// must agree with the enumerations written out below
+	char const* const bidi_names[] = {
+		"l", "r", "al", "en", "es", "et", "an", "cs", "nsm", "bn", "b", "s", "ws", "on",
+		"lre", "lro", "rle", "rlo", "pdf", "lri", "rli", "fsi", "pdi"
+	};
+	char const* const word_names[] = {
+		"other", "cr", "lf", "newline", "extend", "zwj", "regional_indicator", "format", "katakana", "hebrew_letter",
+		"aletter", "single_quote", "double_quote", "midnumlet", "midletter", "midnum", "numeric", "extendnumlet", "wsegspace"
+	};
+	char const* const grapheme_names[] = {
+		"other", "cr", "lf", "control", "extend", "zwj", "regional_indicator", "prepend", "spacingmark", "l", "v", "t", "lv", "lvt"
+	};
+
+	uint32_t bidi_of(UChar32 c) {
+		switch(u_charDirection(c)) {
+			case U_LEFT_TO_RIGHT: return 0;
+			case U_RIGHT_TO_LEFT: return 1;
+			case U_RIGHT_TO_LEFT_ARABIC: return 2;
+			case U_EUROPEAN_NUMBER: return 3;
+			case U_EUROPEAN_NUMBER_SEPARATOR: return 4;
+			case U_EUROPEAN_NUMBER_TERMINATOR: return 5;
+			case U_ARABIC_NUMBER: return 6;
+			case U_COMMON_NUMBER_SEPARATOR: return 7;
+			case U_DIR_NON_SPACING_MARK: return 8;
+			case U_BOUNDARY_NEUTRAL: return 9;
+			case U_BLOCK_SEPARATOR: return 10;
+			case U_SEGMENT_SEPARATOR: return 11;
+			case U_WHITE_SPACE_NEUTRAL: return 12;
+			case U_OTHER_NEUTRAL: return 13;
+			case U_LEFT_TO_RIGHT_EMBEDDING: return 14;
+			case U_LEFT_TO_RIGHT_OVERRIDE: return 15;
+			case U_RIGHT_TO_LEFT_EMBEDDING: return 16;
+			case U_RIGHT_TO_LEFT_OVERRIDE: return 17;
+			case U_POP_DIRECTIONAL_FORMAT: return 18;
+			case U_LEFT_TO_RIGHT_ISOLATE: return 19;
+			case U_RIGHT_TO_LEFT_ISOLATE: return 20;
+			case U_FIRST_STRONG_ISOLATE: return 21;
+			case U_POP_DIRECTIONAL_ISOLATE: return 22;
+			default: return 0;
+		}
+	}
+	uint32_t word_of(UChar32 c) {
+		switch(u_getIntPropertyValue(c, UCHAR_WORD_BREAK)) {
+			case U_WB_CR: return 1;
+			case U_WB_LF: return 2;
+			case U_WB_NEWLINE: return 3;
+			case U_WB_EXTEND: return 4;
+			case U_WB_ZWJ: return 5;
+			case U_WB_REGIONAL_INDICATOR: return 6;
+			case U_WB_FORMAT: return 7;
+			case U_WB_KATAKANA: return 8;
+			case U_WB_HEBREW_LETTER: return 9;
+			case U_WB_ALETTER: return 10;
+			case U_WB_SINGLE_QUOTE: return 11;
+			case U_WB_DOUBLE_QUOTE: return 12;
+			case U_WB_MIDNUMLET: return 13;
+			case U_WB_MIDLETTER: return 14;
+			case U_WB_MIDNUM: return 15;
+			case U_WB_NUMERIC: return 16;
+			case U_WB_EXTENDNUMLET: return 17;
+			case U_WB_WSEGSPACE: return 18;
+			default: return 0;
+		}
+	}
+	uint32_t grapheme_of(UChar32 c) {
+		switch(u_getIntPropertyValue(c, UCHAR_GRAPHEME_CLUSTER_BREAK)) {
+			case U_GCB_CR: return 1;
+			case U_GCB_LF: return 2;
+			case U_GCB_CONTROL: return 3;
+			case U_GCB_EXTEND: return 4;
+			case U_GCB_ZWJ: return 5;
+			case U_GCB_REGIONAL_INDICATOR: return 6;
+			case U_GCB_PREPEND: return 7;
+			case U_GCB_SPACING_MARK: return 8;
+			case U_GCB_L: return 9;
+			case U_GCB_V: return 10;
+			case U_GCB_T: return 11;
+			case U_GCB_LV: return 12;
+			case U_GCB_LVT: return 13;
+			default: return 0;
+		}
+	}
+
+	constexpr uint32_t block_shift = 7;
+	constexpr uint32_t block_size = uint32_t(1) << block_shift;
+
+	void write_enum(FILE* f, char const* name, char const* const* names, size_t count) {
+		fprintf(f, "\tenum class %s : uint8_t {\n\t\t", name);
+		for(size_t i = 0; i < count; ++i) {
+			fprintf(f, "%s%s", names[i], i + 1 < count ? ", " : "\n");
+		}
+		fprintf(f, "\t};\n");
+	}
+	template<typename T>
+	void write_array(FILE* f, char const* type, char const* name, std::vector<T> const& values, int per_line) {
+		fprintf(f, "\tinline constexpr %s %s[%zu] = {", type, name, values.size());
+		for(size_t i = 0; i < values.size(); ++i) {
+			if(i % per_line == 0)
+				fprintf(f, "\n\t\t");
+			fprintf(f, "%u,", unsigned(values[i]));
+		}
+		fprintf(f, "\n\t};\n");
+	}
+
+	// Conformance data, in the formats of GraphemeBreakTest.txt, WordBreakTest.txt and BidiCharacterTest.txt so that
+	// the files from the unicode character database can be used in its place. The cases are every pair of a set of
+	// sample characters, with and without an extend between them, and random longer sequences of the samples; the
+	// expected results are what icu finds for them.
+
+	// at least one character of every class the segmenter distinguishes, with both latin 1 and other characters
+	constexpr UChar32 grapheme_samples[] = {
+		0x0020, 0x0041, 0x000D, 0x000A, 0x0001, 0x00AD, 0x0300, 0x0308, 0x200D, 0x1F1E6, 0x0600, 0x0903,
+		0x1100, 0x1160, 0x11A8, 0xAC00, 0xAC01, 0x00A9, 0x1F476, 0x1F3FF, 0x0378, 0x05D0
+	};
+	// icu takes the colon out of midletter, as cldr tailors it, so another midletter stands in for it
+	constexpr UChar32 word_samples[] = {
+		0x0001, 0x000D, 0x000A, 0x000B, 0x0085, 0x0020, 0x00A0, 0x3000, 0x0308, 0x200D, 0x00AD, 0x1F1E6,
+		0x3031, 0x05D0, 0x0041, 0x0061, 0x02C2, 0x0027, 0x0022, 0x002E, 0x00B7, 0x002C, 0x003B, 0x0030,
+		0x0661, 0x005F, 0x231A, 0x1F476, 0x0021, 0x0378
+	};
+	// paragraph separators are left out, since a test case is a single paragraph
+	constexpr UChar32 bidi_samples[] = {
+		0x0041, 0x05D0, 0x0627, 0x0030, 0x002B, 0x0024, 0x0660, 0x002C, 0x0300, 0x00AD, 0x0009, 0x0020,
+		0x0021, 0x202A, 0x202D, 0x202B, 0x202E, 0x202C, 0x2066, 0x2067, 0x2068, 0x2069,
+		0x0028, 0x0029, 0x005B, 0x005D, 0x2329, 0x232A, 0x3008, 0x3009, 0x1D7CE, 0x10900
+	};
+
+	std::vector<UChar> utf16_of(std::vector<UChar32> const& codepoints, std::vector<int32_t>& unit_of) {
+		std::vector<UChar> result;
+		unit_of.clear();
+		for(auto c : codepoints) {
+			unit_of.push_back(int32_t(result.size()));
+			if(c >= 0x10000) {
+				result.push_back(UChar(0xD800 + ((c - 0x10000) >> 10)));
+				result.push_back(UChar(0xDC00 + ((c - 0x10000) & 0x3FF)));
+			} else {
+				result.push_back(UChar(c));
+			}
+		}
+		unit_of.push_back(int32_t(result.size()));
+		return result;
+	}
+
+	// every pair of samples, each pair again with extend between them, then random sequences of three to max_length;
+	// the generator is only used for its raw output so that every standard library makes the same sequences
+	template<size_t N>
+	std::vector<std::vector<UChar32>> sample_sequences(UChar32 const (&samples)[N], bool with_extend, size_t random_count, size_t max_length) {
+		std::vector<std::vector<UChar32>> result;
+		for(auto a : samples) {
+			for(auto b : samples) {
+				result.push_back({ a, b });
+				if(with_extend)
+					result.push_back({ a, 0x0308, b });
+			}
+		}
+		std::mt19937 random(20261019);
+		for(size_t i = 0; i < random_count; ++i) {
+			std::vector<UChar32> sequence(3 + random() % (max_length - 2));
+			for(auto& c : sequence)
+				c = samples[random() % N];
+			result.push_back(sequence);
+		}
+		return result;
+	}
+
+	void write_conformance_header(FILE* f, char const* format_name) {
+		UVersionInfo version;
+		u_getUnicodeVersion(version);
+		fprintf(f, "# generated by display_testbed/unicode_table_generator.cpp from icu %s (unicode %u.%u.%u); do not edit\n", U_ICU_VERSION, version[0], version[1], version[2]);
+		fprintf(f, "# in the format of %s, which can replace this file\n", format_name);
+	}
+
+	bool write_break_test(char const* file_name, char const* format_name, UBreakIteratorType type, std::vector<std::vector<UChar32>> const& cases) {
+		FILE* f = fopen(file_name, "w");
+		if(!f) {
+			fprintf(stderr, "could not open %s\n", file_name);
+			return false;
+		}
+		write_conformance_header(f, format_name);
+		fprintf(f, "#\n");
+
+		for(auto& codepoints : cases) {
+			std::vector<int32_t> unit_of;
+			auto text = utf16_of(codepoints, unit_of);
+			UErrorCode status = U_ZERO_ERROR;
+			UBreakIterator* breaks = ubrk_open(type, "root", text.data(), int32_t(text.size()), &status);
+			if(U_FAILURE(status)) {
+				fprintf(stderr, "could not open a break iterator: %s\n", u_errorName(status));
+				fclose(f);
+				return false;
+			}
+			std::vector<bool> boundary(text.size() + 1, false);
+			for(auto b = ubrk_first(breaks); b != UBRK_DONE; b = ubrk_next(breaks))
+				boundary[size_t(b)] = true;
+			ubrk_close(breaks);
+
+			for(size_t i = 0; i < codepoints.size(); ++i)
+				fprintf(f, "%s %04X ", boundary[size_t(unit_of[i])] ? "\xC3\xB7" : "\xC3\x97", unsigned(codepoints[i]));
+			fprintf(f, "\xC3\xB7\n");
+		}
+		fclose(f);
+		return true;
+	}
+
+	bool removed_by_x9(UChar32 c) {
+		auto d = u_charDirection(c);
+		return d == U_LEFT_TO_RIGHT_EMBEDDING || d == U_RIGHT_TO_LEFT_EMBEDDING || d == U_LEFT_TO_RIGHT_OVERRIDE
+			|| d == U_RIGHT_TO_LEFT_OVERRIDE || d == U_POP_DIRECTIONAL_FORMAT || d == U_BOUNDARY_NEUTRAL;
+	}
+
+	bool write_bidi_test(char const* file_name, std::vector<std::vector<UChar32>> const& cases) {
+		FILE* f = fopen(file_name, "w");
+		if(!f) {
+			fprintf(stderr, "could not open %s\n", file_name);
+			return false;
+		}
+		write_conformance_header(f, "BidiCharacterTest.txt");
+		fprintf(f, "# code points; paragraph direction; resolved paragraph level; resolved levels; visual order\n#\n");
+
+		UBiDi* bidi = ubidi_open();
+		for(auto& codepoints : cases) {
+			std::vector<int32_t> unit_of;
+			auto text = utf16_of(codepoints, unit_of);
+			// icu resolves text that has nothing of the other direction as all of the paragraph level, arabic numbers
+			// included, since that orders the same; a second paragraph with an empty isolate of each direction keeps
+			// it from taking that shortcut without changing the levels of the first
+			text.insert(text.end(), { 0x2029, 0x2066, 0x2069, 0x2067, 0x2069 });
+			for(UBiDiLevel direction = 0; direction <= 1; ++direction) {
+				UErrorCode status = U_ZERO_ERROR;
+				ubidi_setPara(bidi, text.data(), int32_t(text.size()), direction, nullptr, &status);
+				UBiDiLevel const* levels = ubidi_getLevels(bidi, &status);
+				std::vector<int32_t> visual(size_t(ubidi_getResultLength(bidi)));
+				ubidi_getVisualMap(bidi, visual.data(), &status);
+				if(U_FAILURE(status)) {
+					fprintf(stderr, "could not resolve bidi levels: %s\n", u_errorName(status));
+					ubidi_close(bidi);
+					fclose(f);
+					return false;
+				}
+
+				for(size_t i = 0; i < codepoints.size(); ++i)
+					fprintf(f, "%s%04X", i != 0 ? " " : "", unsigned(codepoints[i]));
+				fprintf(f, ";%u;%u;", unsigned(direction), unsigned(direction));
+				for(size_t i = 0; i < codepoints.size(); ++i) {
+					if(removed_by_x9(codepoints[i]))
+						fprintf(f, "%sx", i != 0 ? " " : "");
+					else
+						fprintf(f, "%s%u", i != 0 ? " " : "", unsigned(levels[unit_of[i]]));
+				}
+				fprintf(f, ";");
+				bool first = true;
+				for(auto unit : visual) {
+					if(unit >= unit_of.back())
+						continue;
+					auto i = size_t(std::upper_bound(unit_of.begin(), unit_of.end(), unit) - unit_of.begin()) - 1;
+					if(unit != unit_of[i] || removed_by_x9(codepoints[i]))
+						continue;
+					fprintf(f, "%s%zu", first ? "" : " ", i);
+					first = false;
+				}
+				fprintf(f, "\n");
+			}
+		}
+		ubidi_close(bidi);
+		fclose(f);
+		return true;
+	}
+}
+
+int main() {
+	// packed as bidi class (bits 0-4), word break (5-9), grapheme break (10-13), extended pictographic (14), white space (15)
+	std::vector<uint16_t> records;
+	std::map<uint16_t, uint8_t> record_index;
+	std::vector<uint8_t> blocks;
+	std::map<std::vector<uint8_t>, uint16_t> block_index;
+	std::vector<uint16_t> block_of;
+
+	for(UChar32 base = 0; base < 0x110000; base += block_size) {
+		std::vector<uint8_t> block(block_size);
+		for(uint32_t i = 0; i < block_size; ++i) {
+			UChar32 c = base + UChar32(i);
+			auto packed = uint16_t(bidi_of(c) | (word_of(c) << 5) | (grapheme_of(c) << 10)
+				| (u_hasBinaryProperty(c, UCHAR_EXTENDED_PICTOGRAPHIC) ? 0x4000 : 0)
+				| (u_hasBinaryProperty(c, UCHAR_WHITE_SPACE) ? 0x8000 : 0));
+			auto found = record_index.find(packed);
+			if(found == record_index.end()) {
+				if(records.size() == 256) {
+					fprintf(stderr, "more than 256 distinct records\n");
+					return 1;
+				}
+				found = record_index.emplace(packed, uint8_t(records.size())).first;
+				records.push_back(packed);
+			}
+			block[i] = found->second;
+		}
+		auto found = block_index.find(block);
+		if(found == block_index.end()) {
+			found = block_index.emplace(block, uint16_t(blocks.size() / block_size)).first;
+			blocks.insert(blocks.end(), block.begin(), block.end());
+		}
+		block_of.push_back(found->second);
+	}
+
+	struct bracket {
+		uint32_t c;
+		uint32_t pair;
+		bool opening;
+	};
+	std::vector<bracket> brackets;
+	for(UChar32 c = 0; c < 0x110000; ++c) {
+		auto type = u_getIntPropertyValue(c, UCHAR_BIDI_PAIRED_BRACKET_TYPE);
+		if(type != U_BPT_NONE)
+			brackets.push_back(bracket{ uint32_t(c), uint32_t(u_getBidiPairedBracket(c)), type == U_BPT_OPEN });
+	}
+
+	FILE* f = fopen("printui_unicode_tables.hpp", "w");
+	if(!f) {
+		fprintf(stderr, "could not open printui_unicode_tables.hpp\n");
+		return 1;
+	}
+
+	UVersionInfo version;
+	u_getUnicodeVersion(version);
+	fprintf(f, "#ifndef PRINTUI_UNICODE_TABLES_HEADER\n#define PRINTUI_UNICODE_TABLES_HEADER\n\n");
+	fprintf(f, "// generated by unicode_table_generator.cpp from unicode %u.%u.%u; do not edit\n\n", version[0], version[1], version[2]);
+	fprintf(f, "#include <cstdint>\n\nnamespace printui::text::unicode {\n");
+	write_enum(f, "bidi_class", bidi_names, std::size(bidi_names));
+	write_enum(f, "word_break", word_names, std::size(word_names));
+	write_enum(f, "grapheme_break", grapheme_names, std::size(grapheme_names));
+	fprintf(f, "\n\t// a property record is the bidi class (bits 0-4), word break (bits 5-9), grapheme break (bits 10-13),\n");
+	fprintf(f, "\t// extended pictographic (bit 14) and white space (bit 15) of a codepoint; the record of c is\n");
+	fprintf(f, "\t// records[blocks[block_of[c >> block_shift] * block_size + (c & (block_size - 1))]]\n");
+	fprintf(f, "\tinline constexpr uint32_t block_shift = %u;\n", block_shift);
+	fprintf(f, "\tinline constexpr uint32_t block_size = %u;\n\n", block_size);
+	write_array(f, "uint16_t", "records", records, 16);
+	write_array(f, "uint16_t", "block_of", block_of, 32);
+	write_array(f, "uint8_t", "blocks", blocks, 32);
+
+	fprintf(f, "\n\t// the characters with a bidi paired bracket type, in codepoint order\n");
+	fprintf(f, "\tstruct paired_bracket {\n\t\tuint32_t codepoint;\n\t\tuint32_t pair;\n\t\tbool opening;\n\t};\n");
+	fprintf(f, "\tinline constexpr paired_bracket paired_brackets[%zu] = {\n", brackets.size());
+	for(auto& b : brackets) {
+		fprintf(f, "\t\tpaired_bracket{ 0x%04X, 0x%04X, %s },\n", b.c, b.pair, b.opening ? "true" : "false");
+	}
+	fprintf(f, "\t};\n}\n\n#endif\n");
+	fclose(f);
+
+	fprintf(stdout, "%zu records, %zu blocks\n", records.size(), blocks.size() / block_size);
+
+	if(!write_break_test("../Catch_text_parsing_tests/conformance/grapheme_break_test.txt", "GraphemeBreakTest.txt", UBRK_CHARACTER, sample_sequences(grapheme_samples, true, 2000, 8))
+		|| !write_break_test("../Catch_text_parsing_tests/conformance/word_break_test.txt", "WordBreakTest.txt", UBRK_WORD, sample_sequences(word_samples, true, 4000, 8))
+		|| !write_bidi_test("../Catch_text_parsing_tests/conformance/bidi_character_test.txt", sample_sequences(bidi_samples, false, 3000, 12))) {
+		return 1;
+	}
+	return 0;
+}